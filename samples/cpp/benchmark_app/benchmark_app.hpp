@@ -83,6 +83,33 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for load mode
+static const char load_mode_message[] =
+    "Optional. Load generation mode. 'closed' (default) resubmits every infer request as soon as it completes and "
+    "measures peak throughput. 'fixed' and 'poisson' submit inferences open-loop with fixed or exponentially "
+    "distributed inter-arrival times at the rate given by -qps, and report queueing delay separately from service "
+    "time. Requires async API.";
+
+/// @brief message for target arrival rate
+static const char qps_message[] =
+    "Optional. Target arrival rate in inferences per second for 'fixed' and 'poisson' load modes. "
+    "When -slo is set, it is the starting point of the throughput-at-SLO search.";
+
+/// @brief message for latency SLO
+static const char slo_message[] =
+    "Optional. Latency service level objective in milliseconds for 'fixed' and 'poisson' load modes. "
+    "When set, the arrival rate is searched for the highest throughput whose end-to-end latency percentile "
+    "given by -slo_percentile stays within the objective.";
+
+/// @brief message for latency SLO percentile
+static const char slo_percentile_message[] =
+    "Optional. Latency percentile checked against -slo. The valid range is (0, 100]. The default value is 99.";
+
+/// @brief message for number of SLO search steps
+static const char slo_search_steps_message[] =
+    "Optional. Number of bisection steps of the throughput-at-SLO search. Every step runs for -t seconds "
+    "or -niter inferences. The default value is 6.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -275,6 +302,21 @@ DEFINE_string(nstreams, "AUTO", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Load generation mode
+DEFINE_string(load_mode, "closed", load_mode_message);
+
+/// @brief Target arrival rate for open-loop load modes
+DEFINE_double(qps, 0, qps_message);
+
+/// @brief Latency SLO in milliseconds for open-loop load modes
+DEFINE_double(slo, 0, slo_message);
+
+/// @brief The percentile which is checked against the latency SLO
+DEFINE_double(slo_percentile, 99, slo_percentile_message);
+
+/// @brief Number of bisection steps of the throughput-at-SLO search
+DEFINE_uint32(slo_search_steps, 6, slo_search_steps_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint32(b, 0, batch_size_message);
@@ -385,6 +427,11 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -load_mode \"<closed/fixed/poisson>\"   " << load_mode_message << std::endl;
+    std::cout << "    -qps \"<double>\"           " << qps_message << std::endl;
+    std::cout << "    -slo \"<double>\"           " << slo_message << std::endl;
+    std::cout << "    -slo_percentile           " << slo_percentile_message << std::endl;
+    std::cout << "    -slo_search_steps         " << slo_search_steps_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -23,7 +23,8 @@
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, size_t group_id, const double latency, const double queueing)>
+    QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution
 /// time.
@@ -42,12 +43,24 @@ public:
         _request.set_callback([&](const std::exception_ptr& ptr) {
             // TODO: Add exception ptr rethrow in proper thread
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
+            _callbackQueue(_id,
+                           _lat_group_id,
+                           get_execution_time_in_milliseconds(),
+                           get_queueing_time_in_milliseconds());
         });
     }
 
     void start_async() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.start_async();
+    }
+
+    /// @brief Starts the request which was due at `arrivalTime`. The time between the arrival and the actual start
+    /// is reported as queueing delay.
+    void start_async(Time::time_point arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = arrivalTime;
         _request.start_async();
     }
 
@@ -57,9 +70,13 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
+        _callbackQueue(_id,
+                       _lat_group_id,
+                       get_execution_time_in_milliseconds(),
+                       get_queueing_time_in_milliseconds());
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -84,6 +101,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queueing_time_in_milliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -97,6 +119,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -116,7 +139,8 @@ public:
                                                                         this,
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
-                                                                        std::placeholders::_3)));
+                                                                        std::placeholders::_3,
+                                                                        std::placeholders::_4)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -137,6 +161,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingLatencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -146,9 +171,10 @@ public:
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
-    void put_idle_request(size_t id, size_t lat_group_id, const double latency) {
+    void put_idle_request(size_t id, size_t lat_group_id, const double latency, const double queueing) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingLatencies.push_back(queueing);
         if (enable_lat_groups) {
             _latency_groups[lat_group_id].push_back(latency);
         }
@@ -179,6 +205,11 @@ public:
         return _latencies;
     }
 
+    /// @brief Returns delays between the arrival and the start of each completed request, in completion order
+    std::vector<double> get_queueing_latencies() {
+        return _queueingLatencies;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -192,6 +223,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingLatencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
 };
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,6 +56,23 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_load_mode != "closed" && FLAGS_load_mode != "fixed" && FLAGS_load_mode != "poisson") {
+        throw std::logic_error("Incorrect load mode. Please set -load_mode option to `closed`, `fixed` or `poisson`.");
+    }
+    if (FLAGS_load_mode != "closed") {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop load modes require async API.");
+        }
+        if (FLAGS_qps <= 0) {
+            throw std::logic_error("Open-loop load modes require a positive arrival rate. Please set -qps option.");
+        }
+        if (FLAGS_slo < 0) {
+            throw std::logic_error("The latency SLO must not be negative.");
+        }
+        if (FLAGS_slo_percentile > 100 || FLAGS_slo_percentile <= 0) {
+            throw std::logic_error("The SLO percentile value is incorrect. The applicable values range is (0, 100].");
+        }
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
                                "either `throughput`(tput) or `latency' value.");
@@ -927,71 +945,45 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
+        auto prepare_request = [&](const InferReqWrap::Ptr& inferRequest) {
+            if (inferenceOnly) {
+                return;
             }
+            auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
-
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
-                }
-
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
-                    if (!std::any_of(inputs.begin(),
-                                     inputs.end(),
-                                     [](const std::pair<const std::string, benchmark_app::InputInfo>& info) {
-                                         return ov::layout::has_batch(info.second.layout);
-                                     })) {
-                        slog::warn
-                            << "No batch dimension was found, asssuming batch to be 1. Beware: this might affect "
-                               "FPS calculation."
-                            << slog::endl;
-                    }
-                }
-
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
-                }
+            if (FLAGS_pcseq) {
+                inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+            }
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+                if (!std::any_of(inputs.begin(),
+                                 inputs.end(),
+                                 [](const std::pair<const std::string, benchmark_app::InputInfo>& info) {
+                                     return ov::layout::has_batch(info.second.layout);
+                                 })) {
+                    slog::warn << "No batch dimension was found, asssuming batch to be 1. Beware: this might affect "
+                                  "FPS calculation."
+                               << slog::endl;
                 }
             }
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->start_async();
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                inferRequest->set_tensor(inputName, data);
             }
-            ++iteration;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+            if (useGpuMem) {
+                auto outputTensors =
+                    ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+                }
+            }
+        };
 
+        auto update_progress = [&](ProgressBar& progressBar, uint64_t elapsed) {
             if (niter > 0) {
                 progressBar.add_progress(1);
             } else {
@@ -1000,16 +992,203 @@ int main(int argc, char* argv[]) {
                 // progress interval. Previously covered progress intervals must be
                 // skipped.
                 auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                size_t newProgress = elapsed / progressIntervalTime - progressCnt;
                 progressBar.add_progress(newProgress);
                 progressCnt += newProgress;
             }
-        }
+        };
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
+        /** Start inference & calculate performance **/
+        /** to align number if iterations to guarantee that last infer requests are
+         * executed in the same conditions **/
+        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
+        const bool openLoop = FLAGS_load_mode != "closed";
+        std::vector<double> totalLatencies;
+        double totalDuration = 0;
+        if (!openLoop) {
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
+
+                prepare_request(inferRequest);
+
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    // As the inference request is currently idle, the wait() adds no
+                    // additional overhead (and should return immediately). The primary
+                    // reason for calling the method is exception checking/re-throwing.
+                    // Callback, that governs the actual execution can handle errors as
+                    // well, but as it uses just error codes it has no details like ‘what()’
+                    // method of `std::exception` So, rechecking for any exceptions here.
+                    inferRequest->wait();
+                    inferRequest->start_async();
+                }
+                ++iteration;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+                update_progress(progressBar, execTime);
+            }
+
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
+            totalLatencies = inferRequestsQueue.get_latencies();
+            totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
+        } else {
+            // Open-loop trial: inferences arrive on a schedule which does not depend on completions, so the
+            // time an arrival waits for an idle infer request is accounted as queueing delay instead of being
+            // hidden by a slower submission rate.
+            struct OpenLoopTrial {
+                double target_qps = 0;
+                double achieved_qps = 0;
+                size_t iterations = 0;
+                size_t frames = 0;
+                double duration = 0;
+                std::vector<double> service;
+                std::vector<double> queueing;
+                std::vector<double> total;
+            };
+            auto run_open_loop = [&](double qps, bool showProgress) {
+                inferRequestsQueue.reset_times();
+                iteration = 0;
+                processedFramesN = 0;
+                progressCnt = 0;
+                ArrivalSchedule schedule(FLAGS_load_mode == "poisson", qps);
+                startTime = Time::now();
+                while (true) {
+                    const auto offset = schedule.next();
+                    if (!((niter != 0LL && iteration < niter) ||
+                          (duration_nanoseconds != 0LL && (uint64_t)offset.count() < duration_nanoseconds))) {
+                        break;
+                    }
+                    const auto arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(offset);
+                    std::this_thread::sleep_until(arrivalTime);
+
+                    inferRequest = inferRequestsQueue.get_idle_request();
+                    if (!inferRequest) {
+                        IE_THROW() << "No idle Infer Requests!";
+                    }
+                    prepare_request(inferRequest);
+                    inferRequest->wait();
+                    inferRequest->start_async(arrivalTime);
+                    ++iteration;
+
+                    processedFramesN += batchSize;
+                    if (showProgress) {
+                        update_progress(progressBar, offset.count());
+                    }
+                }
+                inferRequestsQueue.wait_all();
+
+                OpenLoopTrial trial;
+                trial.target_qps = qps;
+                trial.iterations = iteration;
+                trial.frames = processedFramesN;
+                trial.duration = inferRequestsQueue.get_duration_in_milliseconds();
+                trial.achieved_qps = 1000.0 * iteration / trial.duration;
+                trial.service = inferRequestsQueue.get_latencies();
+                trial.queueing = inferRequestsQueue.get_queueing_latencies();
+                trial.total.resize(trial.service.size());
+                std::transform(trial.service.begin(),
+                               trial.service.end(),
+                               trial.queueing.begin(),
+                               trial.total.begin(),
+                               std::plus<double>());
+                return trial;
+            };
+            auto meets_slo = [](const OpenLoopTrial& trial) {
+                return LatencyDistribution(trial.total).percentile(FLAGS_slo_percentile) <= FLAGS_slo;
+            };
+            auto trial_to_json = [&](const OpenLoopTrial& trial) {
+                nlohmann::json js;
+                js["target_qps"] = trial.target_qps;
+                js["achieved_qps"] = trial.achieved_qps;
+                js["latency"] = LatencyDistribution(trial.total).percentile(FLAGS_slo_percentile);
+                js["meets_slo"] = meets_slo(trial);
+                return js;
+            };
+
+            OpenLoopTrial result;
+            if (FLAGS_slo == 0) {
+                result = run_open_loop(FLAGS_qps, true);
+            } else {
+                // Throughput-at-SLO search: the rate is doubled (or halved) from -qps until the SLO outcome flips,
+                // then the boundary between the highest passing and the lowest failing rate is bisected.
+                nlohmann::json::array_t trials;
+                auto run_trial = [&](double qps) {
+                    auto trial = run_open_loop(qps, false);
+                    trials.push_back(trial_to_json(trial));
+                    slog::info << "SLO search: " << double_to_string(qps) << " QPS -> "
+                               << double_to_string(LatencyDistribution(trial.total).percentile(FLAGS_slo_percentile))
+                               << " ms" << (meets_slo(trial) ? "" : " (violated)") << slog::endl;
+                    return trial;
+                };
+                // Rates are bounded, so an SLO which is never (or always) met does not loop forever
+                const size_t maxScalingSteps = 16;
+                OpenLoopTrial passed, failed;
+                auto trial = run_trial(FLAGS_qps);
+                (meets_slo(trial) ? passed : failed) = trial;
+                for (size_t step = 0; step < maxScalingSteps && (passed.target_qps == 0 || failed.target_qps == 0);
+                     ++step) {
+                    trial = run_trial(passed.target_qps == 0 ? failed.target_qps / 2 : passed.target_qps * 2);
+                    (meets_slo(trial) ? passed : failed) = trial;
+                }
+                for (size_t step = 0; step < FLAGS_slo_search_steps && passed.target_qps != 0 && failed.target_qps != 0;
+                     ++step) {
+                    trial = run_trial((passed.target_qps + failed.target_qps) / 2);
+                    (meets_slo(trial) ? passed : failed) = trial;
+                }
+                result = passed.target_qps != 0 ? passed : failed;
+
+                const double throughputAtSlo = passed.target_qps != 0 ? passed.achieved_qps : 0;
+                slog::info << "Throughput at SLO (" << double_to_string(FLAGS_slo_percentile)
+                           << " percentile <= " << double_to_string(FLAGS_slo)
+                           << " ms): " << double_to_string(throughputAtSlo * batchSize) << " FPS" << slog::endl;
+                if (statistics) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("latency SLO (ms)", "slo", FLAGS_slo),
+                         StatisticsVariant("SLO percentile", "slo_percentile", FLAGS_slo_percentile),
+                         StatisticsVariant("throughput at SLO", "throughput_at_slo", throughputAtSlo * batchSize),
+                         StatisticsVariant("SLO search", "slo_search", trials)});
+                }
+            }
+
+            iteration = result.iterations;
+            processedFramesN = result.frames;
+            totalLatencies = result.total;
+            totalDuration = result.duration;
+
+            LatencyDistribution totalDistribution(result.total);
+            LatencyDistribution queueingDistribution(result.queueing);
+            LatencyDistribution serviceDistribution(result.service);
+            slog::info << "Load mode:  " << FLAGS_load_mode << ", target " << double_to_string(result.target_qps)
+                       << " QPS, achieved " << double_to_string(result.achieved_qps) << " QPS" << slog::endl;
+            slog::info << "End-to-end latency:" << slog::endl;
+            totalDistribution.write_to_slog();
+            slog::info << "Queueing delay:" << slog::endl;
+            queueingDistribution.write_to_slog();
+            slog::info << "Service time:" << slog::endl;
+            serviceDistribution.write_to_slog();
+
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("load mode", "load_mode", FLAGS_load_mode),
+                     StatisticsVariant("target QPS", "target_qps", result.target_qps),
+                     StatisticsVariant("achieved QPS", "achieved_qps", result.achieved_qps),
+                     StatisticsVariant("end-to-end latency", "latency_distribution", totalDistribution),
+                     StatisticsVariant("queueing delay", "queueing_distribution", queueingDistribution),
+                     StatisticsVariant("service time", "service_distribution", serviceDistribution)});
+            }
+        }
 
-        LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        LatencyMetrics generalLatency(totalLatencies, "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1027,7 +1206,6 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / generalLatency.median_or_percentile
                                            : 1000.0 * processedFramesN / totalDuration;
 
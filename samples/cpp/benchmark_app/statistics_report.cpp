@@ -4,6 +4,7 @@
 
 // clang-format off
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <utility>
@@ -281,6 +282,63 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
     max = latencies.back();
 };
 
+LatencyDistribution::LatencyDistribution(std::vector<double> latencies) : sorted_latencies(std::move(latencies)) {
+    if (sorted_latencies.empty()) {
+        throw std::logic_error("Latency distribution class expects non-empty vector of latencies at construction.");
+    }
+    std::sort(sorted_latencies.begin(), sorted_latencies.end());
+}
+
+double LatencyDistribution::percentile(double p) const {
+    const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted_latencies.size()));
+    return sorted_latencies[std::min(std::max<size_t>(rank, 1), sorted_latencies.size()) - 1];
+}
+
+static const std::vector<std::pair<std::string, double>> reported_percentiles = {{"p50", 50},
+                                                                                 {"p90", 90},
+                                                                                 {"p99", 99},
+                                                                                 {"p99.9", 99.9}};
+
+void LatencyDistribution::write_to_slog() const {
+    for (const auto& p : reported_percentiles) {
+        slog::info << "\t" << std::left << std::setw(12) << p.first + ":" << double_to_string(percentile(p.second))
+                   << " ms" << slog::endl;
+    }
+}
+
+const nlohmann::json LatencyDistribution::to_json() const {
+    nlohmann::json js;
+    js["count"] = sorted_latencies.size();
+    js["min"] = sorted_latencies.front();
+    js["average"] =
+        std::accumulate(sorted_latencies.begin(), sorted_latencies.end(), 0.0) / sorted_latencies.size();
+    js["max"] = sorted_latencies.back();
+    for (const auto& p : reported_percentiles) {
+        js[p.first] = percentile(p.second);
+    }
+
+    // Buckets follow the 1-2-5 series starting from 1 us, so histograms of different runs can be compared directly.
+    // Only the range between the first and the last non-empty bucket is reported.
+    js["histogram"] = nlohmann::json::array();
+    static const double steps[] = {1, 2, 5};
+    auto it = sorted_latencies.begin();
+    for (double decade = 0.001; it != sorted_latencies.end(); decade *= 10) {
+        for (double step : steps) {
+            const double upper_bound = decade * step;
+            const auto next = std::upper_bound(it, sorted_latencies.end(), upper_bound);
+            const auto count = static_cast<size_t>(std::distance(it, next));
+            if (count != 0 || !js["histogram"].empty()) {
+                js["histogram"].push_back({{"upper_bound", upper_bound}, {"count", count}});
+            }
+            it = next;
+            if (it == sorted_latencies.end()) {
+                break;
+            }
+        }
+    }
+    return js;
+}
+
 std::string StatisticsVariant::to_string() const {
     switch (type) {
     case INT:
@@ -291,11 +349,14 @@ std::string StatisticsVariant::to_string() const {
         return s_val;
     case ULONGLONG:
         return std::to_string(ull_val);
-    case METRICS:
+    case METRICS: {
         std::ostringstream str;
         metrics_val.write_to_stream(str);
         return str.str();
     }
+    case JSON:
+        return json_val.dump();
+    }
     throw std::invalid_argument("StatisticsVariant::to_string : invalid type is provided");
 }
 
@@ -320,6 +381,9 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         }
         arr.push_back(metrics_val.to_json());
     } break;
+    case JSON:
+        js[json_name] = json_val;
+        break;
     default:
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
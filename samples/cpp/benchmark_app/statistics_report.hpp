@@ -52,9 +52,30 @@ private:
     size_t percentile_boundary = 50;
 };
 
+/// @brief Responsible for calculating percentiles and the histogram of a latency distribution
+class LatencyDistribution {
+public:
+    LatencyDistribution() {}
+
+    explicit LatencyDistribution(std::vector<double> latencies);
+
+    /// @brief Returns the nearest-rank percentile, `p` is in (0, 100]
+    double percentile(double p) const;
+
+    void write_to_slog() const;
+    const nlohmann::json to_json() const;
+
+    bool empty() const {
+        return sorted_latencies.empty();
+    }
+
+private:
+    std::vector<double> sorted_latencies;
+};
+
 class StatisticsVariant {
 public:
-    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS };
+    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS, JSON };
 
     StatisticsVariant(std::string csv_name, std::string json_name, int v)
         : csv_name(csv_name),
@@ -91,6 +112,16 @@ public:
           json_name(json_name),
           metrics_val(v),
           type(METRICS) {}
+    StatisticsVariant(std::string csv_name, std::string json_name, const LatencyDistribution& v)
+        : csv_name(csv_name),
+          json_name(json_name),
+          json_val(v.to_json()),
+          type(JSON) {}
+    StatisticsVariant(std::string csv_name, std::string json_name, const nlohmann::json::array_t& v)
+        : csv_name(csv_name),
+          json_name(json_name),
+          json_val(v),
+          type(JSON) {}
 
     ~StatisticsVariant() {}
 
@@ -101,6 +132,7 @@ public:
     unsigned long long ull_val;
     std::string s_val;
     LatencyMetrics metrics_val;
+    nlohmann::json json_val;
     Type type;
 
     std::string to_string() const;
@@ -24,6 +24,28 @@
 #    include <opencv2/core.hpp>
 #endif
 
+namespace {
+// the interval is validated before the exponential distribution is constructed from it
+double arrival_interval_ns(double qps) {
+    if (!(qps > 0)) {
+        throw std::logic_error("Arrival rate must be positive");
+    }
+    return 1e9 / qps;
+}
+}  // namespace
+
+ArrivalSchedule::ArrivalSchedule(bool poisson, double qps, uint32_t seed)
+    : _poisson(poisson),
+      _interval_ns(arrival_interval_ns(qps)),
+      _generator(seed),
+      _distribution(1.0 / _interval_ns) {}
+
+ns ArrivalSchedule::next() {
+    const auto offset = ns(static_cast<ns::rep>(_offset_ns));
+    _offset_ns += _poisson ? _distribution(_generator) : _interval_ns;
+    return offset;
+}
+
 namespace benchmark_app {
 bool InputInfo::is_image() const {
     if ((layout != "NCHW") && (layout != "NHWC") && (layout != "CHW") && (layout != "HWC"))
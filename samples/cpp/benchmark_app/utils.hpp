@@ -8,6 +8,7 @@
 #include <iomanip>
 #include <map>
 #include <openvino/openvino.hpp>
+#include <random>
 #include <samples/slog.hpp>
 #include <string>
 #include <vector>
@@ -33,6 +34,23 @@ inline std::string double_to_string(const double number) {
     return ss.str();
 };
 
+/// @brief Generates arrival times of an open-loop load with fixed or exponentially distributed (Poisson
+/// process) inter-arrival times.
+class ArrivalSchedule {
+public:
+    ArrivalSchedule(bool poisson, double qps, uint32_t seed = 0);
+
+    /// @brief Returns the offset of the next arrival from the start of the schedule
+    ns next();
+
+private:
+    bool _poisson;
+    double _interval_ns;
+    double _offset_ns = 0;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _distribution;
+};
+
 namespace benchmark_app {
 struct InputInfo {
     ov::element::Type type;
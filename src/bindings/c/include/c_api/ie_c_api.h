@@ -58,6 +58,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -303,6 +304,16 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_completion_event
+ * @brief Describes one finished asynchronous request reaped from a completion queue
+ */
+typedef struct ie_completion_event {
+    ie_infer_request_t *request;  //!< The request which has finished
+    void *user_data;              //!< The user data given when the request was attached to the queue
+    IEStatusCode status;          //!< Status of the finished inference: OK(0) for success
+} ie_completion_event_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -684,6 +695,19 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_infer_async(i
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback);
 
+/**
+ * @brief Attaches the infer request to a completion queue. Every following asynchronous inference of the request
+ * posts an ie_completion_event_t to the queue instead of calling a user callback. Replaces the callback set by
+ * ie_infer_set_completion_callback().
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance. NULL detaches the request from its current queue.
+ * @param user_data An opaque value returned in every event of the request, e.g. a slot index of the caller.
+ * @note The queue must outlive all in-flight requests attached to it.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *user_data);
+
 /**
  * @brief Waits for the result to become available. Blocks until specified timeout elapses or the result becomes available, whichever comes first.
  * @ingroup InferRequest
@@ -705,8 +729,84 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_wait(ie_infer
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Sets the deadline of the inferences of the request. An inference not completed by the deadline is aborted and
+ * reported by the INFER_CANCELLED status. Returns NOT_IMPLEMENTED if the device cannot abort the inferences.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param timeout Time in milliseconds from now the inferences must be completed in, a negative value removes the deadline.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_deadline(ie_infer_request_t *infer_request, const int64_t timeout);
+
+/**
+ * @brief Gives the memory of the input and output blobs back to the device, if the device pools it between the infer requests
+ * of the executable network. The blobs still held by the caller keep their data and are used by the next inference of the request.
+ * It is a hint, the devices not pooling the memory ignore it.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_release_blobs(ie_infer_request_t *infer_request);
+
+/**
+ * @brief Marks the input as ready for the next inference, so the device may start the layers depending only on the ready inputs
+ * while the rest of them are being prepared. The data of the input blob must not be changed until the inference.
+ * It is a hint, the devices not starting the inference early ignore it.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param name Name of the input blob.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_input_ready(ie_infer_request_t *infer_request, const char *name);
+
 /** @} */ // end of InferRequest
 
+// CompletionQueue
+
+/**
+ * @defgroup CompletionQueue CompletionQueue
+ * @ingroup ie_c_api
+ * Set of functions allowing a single thread to reap many asynchronous infer requests by polling
+ * instead of handling per-request callbacks.
+ * @{
+ */
+
+/**
+ * @brief Creates a completion queue. Use the ie_completion_queue_free() method to free memory.
+ * @ingroup CompletionQueue
+ * @param capacity Expected maximum number of requests in flight. The queue grows beyond it if needed,
+ * but no memory is allocated on completion while this capacity is not exceeded.
+ * @param queue A pointer to the newly created ie_completion_queue_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(const size_t capacity, ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance. All attached requests must be finished before.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the ie_completion_queue_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Reaps finished requests from the queue in the order of completion.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param events A caller-owned array receiving up to max_events events.
+ * @param max_events Size of the events array.
+ * @param timeout Maximum duration in milliseconds to block for if the queue is empty
+ * @note There are special cases when timeout is equal some value of the WaitMode enum:
+ * * 0 - Immediately returns the available events. It does not block.
+ * * -1 - waits until at least one event becomes available
+ * @param num_events A pointer to the number of events written to the array.
+ * @return Status code of the operation: OK(0) if at least one event was reaped, RESULT_NOT_READY on timeout.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_poll(ie_completion_queue_t *queue, ie_completion_event_t *events,
+    const size_t max_events, const int64_t timeout, size_t *num_events);
+
+/** @} */ // end of CompletionQueue
+
 // Network
 
 /**
@@ -978,6 +1078,32 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory(const tens
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDesc, void *ptr, size_t size, ie_blob_t **blob);
 
+/**
+ * @brief Creates a blob with the given tensor descriptor which wraps caller-owned memory and can be pointed
+ * to other caller-owned memory later by ie_blob_rebind_memory() without any allocation.
+ * @ingroup Blob
+ * @param tensorDesc Tensor descriptor for Blob creation.
+ * @param ptr Pointer to the caller-owned memory.
+ * @param size Length of the caller-owned array in elements. If 0, it is assumed equal to the dot product of dims.
+ * @param blob A pointer to the newly created blob.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory_wrapper(const tensor_desc_t *tensorDesc, void *ptr, size_t size, ie_blob_t **blob);
+
+/**
+ * @brief Points a blob created by ie_blob_make_memory_wrapper() to another caller-owned memory.
+ * The operation does not allocate memory.
+ * @ingroup Blob
+ * @param blob A pointer to the blob created by ie_blob_make_memory_wrapper().
+ * @param ptr Pointer to the caller-owned memory.
+ * @param size Length of the caller-owned array in elements. If 0, it is assumed equal to the dot product of dims.
+ * @note Devices may keep the address of a blob passed to ie_infer_request_set_blob(), so set the blob to the
+ * infer request again after rebinding.
+ * @return Status code of the operation: OK(0) for success, PARAMETER_MISMATCH if the memory is too small
+ * or the blob was not created by ie_blob_make_memory_wrapper().
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_rebind_memory(ie_blob_t *blob, void *ptr, size_t size);
+
 /**
  * @brief Creates a blob describing given roi_t instance based on the given blob with pre-allocated memory.
  * @ingroup Blob
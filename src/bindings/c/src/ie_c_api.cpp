@@ -10,11 +10,15 @@
 #include <vector>
 #include <set>
 #include <algorithm>
+#include <numeric>
+#include <functional>
 #include <chrono>
 #include <tuple>
 #include <memory>
 #include <streambuf>
 #include <istream>
+#include <mutex>
+#include <condition_variable>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "ie_compound_blob.h"
@@ -46,12 +50,45 @@ struct ie_infer_request {
     IE::InferRequest object;
 };
 
+/**
+ * @class caller_memory_allocator
+ * @brief This allocator exposes caller-owned memory to a blob. The memory can be replaced without reallocating the blob.
+ */
+class caller_memory_allocator : public IE::IAllocator {
+public:
+    caller_memory_allocator(void *ptr, size_t byte_size) : _ptr(ptr), _byte_size(byte_size) {}
+
+    void *lock(void *, IE::LockOp) noexcept override {
+        return _ptr;
+    }
+
+    void unlock(void *) noexcept override {}
+
+    void *alloc(size_t size) noexcept override {
+        return size <= _byte_size ? this : nullptr;
+    }
+
+    bool free(void *) noexcept override {
+        return true;
+    }
+
+    void rebind(void *ptr, size_t byte_size) noexcept {
+        _ptr = ptr;
+        _byte_size = byte_size;
+    }
+
+private:
+    void *_ptr;
+    size_t _byte_size;
+};
+
 /**
  * @struct ie_blob
  * @brief This struct represents a universal container in the Inference Engine
  */
 struct ie_blob {
     IE::Blob::Ptr object;
+    std::shared_ptr<caller_memory_allocator> caller_memory;  // set only for blobs made by ie_blob_make_memory_wrapper
 };
 
 /**
@@ -62,6 +99,37 @@ struct ie_network {
     IE::CNNNetwork object;
 };
 
+/**
+ * @struct ie_completion_queue
+ * @brief This struct collects finished asynchronous requests until they are reaped by ie_completion_queue_poll().
+ * Events are kept in a ring buffer which is allocated once at creation and only grows when it overflows.
+ */
+struct ie_completion_queue {
+    std::mutex mutex;
+    std::condition_variable cond_var;
+    std::vector<ie_completion_event_t> events;
+    size_t head = 0;
+    size_t count = 0;
+
+    void push(const ie_completion_event_t &event) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (count == events.size()) {
+                std::vector<ie_completion_event_t> grown(std::max<size_t>(1, 2 * events.size()));
+                for (size_t i = 0; i < count; ++i) {
+                    grown[i] = events[(head + i) % events.size()];
+                }
+                events.swap(grown);
+                head = 0;
+            }
+            events[(head + count) % events.size()] = event;
+            ++count;
+        }
+        cond_var.notify_one();
+    }
+};
+
+
 /**
  * @struct mem_stringbuf
  * @brief This struct puts memory buffer to stringbuf.
@@ -1306,6 +1374,29 @@ IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request,
     return status;
 }
 
+IEStatusCode ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *user_data) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        if (queue == nullptr) {
+            infer_request->object.SetCompletionCallback([]() {});
+        } else {
+            auto fun = [=](IE::InferRequest, IE::StatusCode status_code) {
+                auto it = status_map.find(status_code);
+                queue->push({infer_request, user_data, it != status_map.end() ? it->second : IEStatusCode::UNEXPECTED});
+            };
+            infer_request->object.SetCompletionCallback<std::function<void(IE::InferRequest, IE::StatusCode)>>(fun);
+        }
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int64_t timeout) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1337,6 +1428,102 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_request_set_deadline(ie_infer_request_t *infer_request, const int64_t timeout) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        auto deadline = std::chrono::steady_clock::time_point::max();
+        if (timeout >= 0)
+            deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+        infer_request->object.SetDeadline(deadline);
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_release_blobs(ie_infer_request_t *infer_request) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        infer_request->object.ReleaseBlobs();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_infer_request_set_input_ready(ie_infer_request_t *infer_request, const char *name) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || name == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        infer_request->object.SetInputReady(name);
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_completion_queue_create(const size_t capacity, ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        std::unique_ptr<ie_completion_queue_t> _queue(new ie_completion_queue_t);
+        _queue->events.resize(std::max<size_t>(1, capacity));
+        *queue = _queue.release();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_completion_queue_poll(ie_completion_queue_t *queue, ie_completion_event_t *events,
+    const size_t max_events, const int64_t timeout, size_t *num_events) {
+    if (queue == nullptr || events == nullptr || max_events == 0 || num_events == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    *num_events = 0;
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    auto has_events = [queue] { return queue->count != 0; };
+    if (timeout < 0) {
+        queue->cond_var.wait(lock, has_events);
+    } else if (!queue->cond_var.wait_for(lock, std::chrono::milliseconds(timeout), has_events)) {
+        return IEStatusCode::RESULT_NOT_READY;
+    }
+
+    const size_t n = std::min(max_events, queue->count);
+    for (size_t i = 0; i < n; ++i) {
+        events[i] = queue->events[queue->head];
+        queue->head = (queue->head + 1) % queue->events.size();
+    }
+    queue->count -= n;
+    *num_events = n;
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -1469,6 +1656,100 @@ IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDe
     return status;
 }
 
+template <typename T>
+IE::Blob::Ptr make_wrapper_blob(const IE::TensorDesc &tensor, const std::shared_ptr<IE::IAllocator> &allocator) {
+    auto blob = IE::make_shared_blob<T>(tensor, allocator);
+    blob->allocate();
+    return blob;
+}
+
+IEStatusCode ie_blob_make_memory_wrapper(const tensor_desc_t *tensorDesc, void *ptr, size_t size, ie_blob_t **blob) {
+    if (tensorDesc == nullptr || ptr == nullptr || blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    IE::Precision prec;
+    for (auto it : precision_map) {
+        if (it.second == tensorDesc->precision) {
+            prec = it.first;
+            break;
+        }
+    }
+
+    IE::Layout l = IE::Layout::NCHW;
+    for (auto it : layout_map) {
+        if (it.second == tensorDesc->layout) {
+            l = it.first;
+            break;
+        }
+    }
+
+    IE::SizeVector dims_vector;
+    for (size_t i = 0; i < tensorDesc->dims.ranks; ++i) {
+        dims_vector.push_back(tensorDesc->dims.dims[i]);
+    }
+
+    IEStatusCode status = IEStatusCode::OK;
+    try {
+        IE::TensorDesc tensor(prec, dims_vector, l);
+        const size_t elements = std::accumulate(dims_vector.begin(), dims_vector.end(), size_t(1), std::multiplies<size_t>());
+        if (size == 0) {
+            size = elements;
+        }
+        if (size < elements) {
+            return IEStatusCode::PARAMETER_MISMATCH;
+        }
+        auto allocator = std::make_shared<caller_memory_allocator>(ptr, size * prec.size());
+
+        std::unique_ptr<ie_blob_t> _blob(new ie_blob_t);
+        if (prec == IE::Precision::U8) {
+            _blob->object = make_wrapper_blob<uint8_t>(tensor, allocator);
+        } else if (prec == IE::Precision::U16) {
+            _blob->object = make_wrapper_blob<uint16_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I8 || prec == IE::Precision::BIN || prec == IE::Precision::I4 || prec == IE::Precision::U4) {
+            _blob->object = make_wrapper_blob<int8_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I16 || prec == IE::Precision::FP16 || prec == IE::Precision::Q78) {
+            _blob->object = make_wrapper_blob<int16_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I32) {
+            _blob->object = make_wrapper_blob<int32_t>(tensor, allocator);
+        } else if (prec == IE::Precision::U32) {
+            _blob->object = make_wrapper_blob<uint32_t>(tensor, allocator);
+        } else if (prec == IE::Precision::I64) {
+            _blob->object = make_wrapper_blob<int64_t>(tensor, allocator);
+        } else if (prec == IE::Precision::U64) {
+            _blob->object = make_wrapper_blob<uint64_t>(tensor, allocator);
+        } else if  (prec == IE::Precision::FP32) {
+            _blob->object = make_wrapper_blob<float>(tensor, allocator);
+        }  else if  (prec == IE::Precision::FP64) {
+            _blob->object = make_wrapper_blob<double>(tensor, allocator);
+        } else {
+            _blob->object = make_wrapper_blob<uint8_t>(tensor, allocator);
+        }
+        _blob->caller_memory = allocator;
+        *blob = _blob.release();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_blob_rebind_memory(ie_blob_t *blob, void *ptr, size_t size) {
+    if (blob == nullptr || ptr == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    if (blob->caller_memory == nullptr) {
+        return IEStatusCode::PARAMETER_MISMATCH;
+    }
+
+    const size_t byte_size = size == 0 ? blob->object->byteSize() : size * blob->object->element_size();
+    if (byte_size < blob->object->byteSize()) {
+        return IEStatusCode::PARAMETER_MISMATCH;
+    }
+    blob->caller_memory->rebind(ptr, byte_size);
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory_with_roi(const ie_blob_t *inputBlob, const roi_t *roi, ie_blob_t **blob) {
     if (inputBlob == nullptr || roi == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
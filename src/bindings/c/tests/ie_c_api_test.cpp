@@ -1321,6 +1321,101 @@ TEST(ie_infer_request_infer_async, inferAsyncWaitTime) {
     ie_core_free(&core);
 }
 
+TEST(ie_completion_queue_poll, pollEmptyQueue) {
+    ie_completion_queue_t *queue = nullptr;
+    IE_ASSERT_OK(ie_completion_queue_create(4, &queue));
+    ASSERT_NE(nullptr, queue);
+
+    ie_completion_event_t events[4];
+    size_t num_events = 1;
+    EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_poll(queue, events, 4, 0, &num_events));
+    EXPECT_EQ(0, num_events);
+    EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_poll(queue, events, 4, 10, &num_events));
+    EXPECT_EQ(0, num_events);
+
+    ie_completion_queue_free(&queue);
+    EXPECT_EQ(nullptr, queue);
+}
+
+TEST(ie_completion_queue_poll, reapAsyncRequests) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    // capacity is deliberately smaller than the number of requests to exercise the queue growth
+    const size_t num_requests = 3;
+    ie_completion_queue_t *queue = nullptr;
+    IE_EXPECT_OK(ie_completion_queue_create(1, &queue));
+    EXPECT_NE(nullptr, queue);
+
+    cv::Mat image = cv::imread(input_image);
+    ie_infer_request_t *infer_requests[num_requests] = {};
+    for (size_t i = 0; i < num_requests; ++i) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        EXPECT_NE(nullptr, infer_requests[i]);
+
+        ie_blob_t *blob = nullptr;
+        IE_EXPECT_OK(ie_infer_request_get_blob(infer_requests[i], "data", &blob));
+        Mat2Blob(image, blob);
+        ie_blob_free(&blob);
+
+        IE_EXPECT_OK(ie_infer_request_set_completion_queue(infer_requests[i], queue, reinterpret_cast<void *>(i)));
+    }
+
+    for (size_t i = 0; i < num_requests; ++i) {
+        IE_EXPECT_OK(ie_infer_request_infer_async(infer_requests[i]));
+    }
+
+    std::vector<bool> reaped(num_requests, false);
+    size_t total_events = 0;
+    while (!HasFailure() && total_events < num_requests) {
+        ie_completion_event_t events[num_requests];
+        size_t num_events = 0;
+        IE_ASSERT_OK(ie_completion_queue_poll(queue, events, num_requests, -1, &num_events));
+        ASSERT_GT(num_events, 0);
+        for (size_t e = 0; e < num_events; ++e) {
+            const size_t idx = reinterpret_cast<size_t>(events[e].user_data);
+            ASSERT_LT(idx, num_requests);
+            EXPECT_EQ(infer_requests[idx], events[e].request);
+            IE_EXPECT_OK(events[e].status);
+            EXPECT_FALSE(reaped[idx]);
+            reaped[idx] = true;
+
+            ie_blob_t *output_blob = nullptr;
+            IE_EXPECT_OK(ie_infer_request_get_blob(events[e].request, "fc_out", &output_blob));
+            ie_blob_buffer_t buffer;
+            IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+            float *output_data = (float *)(buffer.buffer);
+            EXPECT_NEAR(output_data[9], 0.f, 1.e-5);
+            ie_blob_free(&output_blob);
+        }
+        total_events += num_events;
+    }
+    EXPECT_EQ(num_requests, total_events);
+
+    for (size_t i = 0; i < num_requests; ++i) {
+        IE_EXPECT_OK(ie_infer_request_wait(infer_requests[i], -1));
+        IE_EXPECT_OK(ie_infer_request_set_completion_queue(infer_requests[i], nullptr, nullptr));
+        ie_infer_request_free(&infer_requests[i]);
+    }
+    ie_completion_queue_free(&queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_infer_request_set_batch, setBatch) {
     ie_core_t *core = nullptr;
     IE_ASSERT_OK(ie_core_create("", &core));
@@ -1408,6 +1503,147 @@ TEST(ie_infer_request_set_batch, setNegativeBatch) {
     ie_core_free(&core);
 }
 
+TEST(ie_infer_request_set_deadline, setDeadline) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_infer_request_t *infer_request = nullptr;
+    IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_request));
+    EXPECT_NE(nullptr, infer_request);
+
+    // the deadline passes before the inference starts
+    IE_EXPECT_OK(ie_infer_request_set_deadline(infer_request, 0));
+    EXPECT_EQ(IEStatusCode::INFER_CANCELLED, ie_infer_request_infer(infer_request));
+
+    IE_EXPECT_OK(ie_infer_request_set_deadline(infer_request, -1));
+    IE_EXPECT_OK(ie_infer_request_infer(infer_request));
+
+    EXPECT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_set_deadline(nullptr, 0));
+
+    ie_infer_request_free(&infer_request);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
+TEST(ie_infer_request_release_blobs, releaseBlobs) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {"CPU_POOLED_REQUEST_BLOBS", "YES", nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_infer_request_t *infer_request = nullptr;
+    IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_request));
+    EXPECT_NE(nullptr, infer_request);
+
+    ie_blob_t *blob = nullptr;
+    IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "data", &blob));
+    cv::Mat image = cv::imread(input_image);
+    Mat2Blob(image, blob);
+    IE_EXPECT_OK(ie_infer_request_infer(infer_request));
+
+    ie_blob_t *output_blob = nullptr;
+    IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "fc_out", &output_blob));
+    ie_blob_buffer_t buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+    const float expected = ((float *)(buffer.buffer))[9];
+
+    // the blobs held by the caller keep their data after the release
+    IE_EXPECT_OK(ie_infer_request_release_blobs(infer_request));
+    IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+    EXPECT_EQ(expected, ((float *)(buffer.buffer))[9]);
+
+    // the released input blob is taken back with its data by the next inference
+    IE_EXPECT_OK(ie_infer_request_infer(infer_request));
+    ie_blob_t *next_output_blob = nullptr;
+    IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "fc_out", &next_output_blob));
+    IE_EXPECT_OK(ie_blob_get_buffer(next_output_blob, &buffer));
+    EXPECT_NEAR(expected, ((float *)(buffer.buffer))[9], 1.e-5);
+
+    EXPECT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_release_blobs(nullptr));
+
+    ie_blob_free(&next_output_blob);
+    ie_blob_free(&output_blob);
+    ie_blob_free(&blob);
+    ie_infer_request_free(&infer_request);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
+TEST(ie_infer_request_set_input_ready, setInputReady) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_infer_request_t *infer_request = nullptr;
+    IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_request));
+    EXPECT_NE(nullptr, infer_request);
+
+    ie_blob_t *blob = nullptr;
+    IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "data", &blob));
+    cv::Mat image = cv::imread(input_image);
+    Mat2Blob(image, blob);
+    IE_EXPECT_OK(ie_infer_request_infer(infer_request));
+
+    ie_blob_t *output_blob = nullptr;
+    IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "fc_out", &output_blob));
+    ie_blob_buffer_t buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+    const float expected = ((float *)(buffer.buffer))[9];
+
+    // the inference started early on the ready input gives the same result
+    IE_EXPECT_OK(ie_infer_request_set_input_ready(infer_request, "data"));
+    IE_EXPECT_OK(ie_infer_request_infer(infer_request));
+    IE_EXPECT_OK(ie_blob_get_buffer(output_blob, &buffer));
+    EXPECT_NEAR(expected, ((float *)(buffer.buffer))[9], 1.e-5);
+
+    EXPECT_EQ(IEStatusCode::NOT_ALLOCATED, ie_infer_request_set_input_ready(infer_request, "unknown"));
+    EXPECT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_set_input_ready(infer_request, nullptr));
+    EXPECT_EQ(IEStatusCode::GENERAL_ERROR, ie_infer_request_set_input_ready(nullptr, "data"));
+
+    ie_blob_free(&output_blob);
+    ie_blob_free(&blob);
+    ie_infer_request_free(&infer_request);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory, makeMemory) {
 
     dimensions_t dim_t;
@@ -1444,6 +1680,41 @@ TEST(ie_blob_make_memory_from_preallocated, makeMemoryfromPreallocated) {
     ie_blob_free(&blob);
 }
 
+TEST(ie_blob_make_memory_wrapper, rebindMemory) {
+    dimensions_t dim_t;
+    dim_t.ranks = 4 ;
+    dim_t.dims[0] = 1, dim_t.dims[1] = 3, dim_t.dims[2] = 4, dim_t.dims[3] = 4;
+    tensor_desc tensor;
+    tensor.dims = dim_t ;
+    tensor.precision = precision_e::FP32;
+    tensor.layout = layout_e::NCHW;
+    float first[48] = {0}, second[48] = {0}, small[8] = {0};
+
+    ie_blob_t *blob = nullptr;
+    IE_EXPECT_OK(ie_blob_make_memory_wrapper(&tensor, first, 0, &blob));
+    ASSERT_NE(nullptr, blob);
+
+    ie_blob_buffer_t buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &buffer));
+    EXPECT_EQ(first, buffer.buffer);
+
+    IE_EXPECT_OK(ie_blob_rebind_memory(blob, second, 48));
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &buffer));
+    EXPECT_EQ(second, buffer.buffer);
+
+    EXPECT_EQ(IEStatusCode::PARAMETER_MISMATCH, ie_blob_rebind_memory(blob, small, 8));
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &buffer));
+    EXPECT_EQ(second, buffer.buffer);
+
+    ie_blob_t *not_wrapper = nullptr;
+    IE_EXPECT_OK(ie_blob_make_memory(&tensor, &not_wrapper));
+    EXPECT_EQ(IEStatusCode::PARAMETER_MISMATCH, ie_blob_rebind_memory(not_wrapper, first, 48));
+    EXPECT_EQ(IEStatusCode::PARAMETER_MISMATCH, ie_blob_make_memory_wrapper(&tensor, small, 8, &blob));
+
+    ie_blob_free(&not_wrapper);
+    ie_blob_free(&blob);
+}
+
 TEST(ie_blob_make_memory_with_roi, makeMemorywithROI) {
 
     dimensions_t dim_t;
@@ -9,9 +9,12 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -19,6 +22,66 @@
 
 namespace py = pybind11;
 
+namespace {
+// Wraps tensor memory into numpy array without copying, the array keeps the tensor alive.
+py::array array_from_tensor(const ov::Tensor& tensor) {
+    auto holder = new ov::Tensor(tensor);
+    py::capsule owner(holder, [](void* ptr) {
+        delete reinterpret_cast<ov::Tensor*>(ptr);
+    });
+    return py::array(Common::ov_type_to_dtype().at(tensor.get_element_type()),
+                     tensor.get_shape(),
+                     tensor.get_strides(),
+                     tensor.data(),
+                     owner);
+}
+
+// Numpy array which can be shared with the runtime as is: C-contiguous and of the port precision.
+// Other arrays are converted once here, before the GIL is released.
+py::array as_shareable_array(const py::handle& data, const ov::element::Type& type) {
+    const auto& dtype = Common::ov_type_to_dtype().at(type);
+    py::array array = py::array::ensure(data);
+    if (!array) {
+        throw py::type_error("infer_batch: inputs must be numpy arrays or Tensors!");
+    }
+    const bool is_contiguous = py::array::c_style == (array.flags() & py::array::c_style);
+    if (!is_contiguous || !array.dtype().equal(dtype)) {
+        array = py::module::import("numpy").attr("ascontiguousarray")(array, dtype);
+    }
+    return array;
+}
+
+ov::Tensor tensor_on_array(py::array& array, const ov::element::Type& type) {
+    // runtime doesn't write into input tensors, so read-only arrays can be shared too
+    return ov::Tensor(type, ov::Shape(array.shape(), array.shape() + array.ndim()), const_cast<void*>(array.data()));
+}
+
+// Calls the function when the scope is left, by an exception too. The function must not throw.
+template <typename F>
+class ScopeExit {
+public:
+    explicit ScopeExit(F f) : _f(std::move(f)) {}
+    ScopeExit(ScopeExit&& other) : _f(std::move(other._f)), _active(other._active) {
+        other._active = false;
+    }
+    ScopeExit(const ScopeExit&) = delete;
+    ScopeExit& operator=(const ScopeExit&) = delete;
+    ~ScopeExit() {
+        if (_active)
+            _f();
+    }
+
+private:
+    F _f;
+    bool _active = true;
+};
+
+template <typename F>
+ScopeExit<F> on_scope_exit(F f) {
+    return ScopeExit<F>(std::move(f));
+}
+}  // namespace
+
 class AsyncInferQueue {
 public:
     AsyncInferQueue(std::vector<InferRequestWrapper> requests,
@@ -98,6 +161,7 @@ public:
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        _callback = f_callback;
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
@@ -130,12 +194,231 @@ public:
         }
     }
 
+    // Runs all jobs on the queue requests and returns their results. The GIL is released once for the
+    // whole batch; completions are collected on the C++ side and no Python callback is called per job.
+    // Inputs and outputs are bound to numpy memory directly whenever dtype and layout allow it.
+    py::object infer_batch(const py::list& inputs, const py::object& outputs) {
+        wait_all();
+
+        const auto& model_inputs = _requests[0]._inputs;
+        const auto& model_outputs = _requests[0]._outputs;
+        const size_t jobs = inputs.size();
+
+        // Convert inputs while the GIL is held, `arrays` keeps shared memory alive until the batch is done
+        std::vector<py::array> arrays;
+        std::vector<std::vector<ov::Tensor>> job_inputs(jobs);
+        for (size_t job = 0; job < jobs; ++job) {
+            py::object item = inputs[job];
+            py::list items;
+            if (py::isinstance<py::list>(item) || py::isinstance<py::tuple>(item)) {
+                items = py::list(item);
+            } else {
+                items.append(item);
+            }
+            if (items.size() != model_inputs.size()) {
+                throw py::value_error("infer_batch: job " + std::to_string(job) + " has " +
+                                      std::to_string(items.size()) + " inputs, but model expects " +
+                                      std::to_string(model_inputs.size()));
+            }
+            for (size_t idx = 0; idx < items.size(); ++idx) {
+                if (py::isinstance<ov::Tensor>(items[idx])) {
+                    job_inputs[job].push_back(Common::cast_to_tensor(items[idx]));
+                } else {
+                    const auto type = model_inputs[idx].get_element_type();
+                    arrays.push_back(as_shareable_array(items[idx], type));
+                    job_inputs[job].push_back(tensor_on_array(arrays.back(), type));
+                }
+            }
+        }
+
+        // Outputs with static shapes are written directly into numpy arrays, either into slices of the
+        // user provided `outputs` array or into arrays allocated here. Dynamic outputs are copied on completion.
+        std::vector<std::vector<ov::Tensor>> job_outputs(jobs, std::vector<ov::Tensor>(model_outputs.size()));
+        std::vector<std::vector<py::object>> job_arrays(jobs, std::vector<py::object>(model_outputs.size()));
+        std::vector<bool> is_static(model_outputs.size());
+        for (size_t idx = 0; idx < model_outputs.size(); ++idx) {
+            is_static[idx] = model_outputs[idx].get_partial_shape().is_static();
+        }
+        if (!outputs.is_none()) {
+            if (model_outputs.size() != 1 || !is_static[0]) {
+                throw py::value_error("infer_batch: preallocated outputs are supported only for models with a "
+                                      "single output of static shape");
+            }
+            if (!py::isinstance<py::array>(outputs)) {
+                throw py::type_error("infer_batch: outputs must be a numpy array!");
+            }
+            auto array = outputs.cast<py::array>();
+            const auto type = model_outputs[0].get_element_type();
+            const auto shape = model_outputs[0].get_shape();
+            const size_t job_bytes = ov::shape_size(shape) * type.size();
+            const bool is_contiguous = py::array::c_style == (array.flags() & py::array::c_style);
+            const bool is_batch_shape = array.ndim() > 0 && static_cast<size_t>(array.shape(0)) == jobs &&
+                                        static_cast<size_t>(array.nbytes()) == jobs * job_bytes;
+            if (!is_contiguous || !array.writeable() || !is_batch_shape ||
+                !array.dtype().equal(Common::ov_type_to_dtype().at(type))) {
+                throw py::value_error("infer_batch: outputs must be a writeable C-contiguous array of shape "
+                                      "[len(inputs), *output_shape] and output precision");
+            }
+            auto data = static_cast<uint8_t*>(array.mutable_data());
+            for (size_t job = 0; job < jobs; ++job) {
+                job_outputs[job][0] = ov::Tensor(type, shape, data + job * job_bytes);
+            }
+        } else {
+            for (size_t job = 0; job < jobs; ++job) {
+                for (size_t idx = 0; idx < model_outputs.size(); ++idx) {
+                    if (!is_static[idx])
+                        continue;
+                    const auto type = model_outputs[idx].get_element_type();
+                    py::array array(Common::ov_type_to_dtype().at(type), model_outputs[idx].get_shape());
+                    job_outputs[job][idx] = tensor_on_array(array, type);
+                    job_arrays[job][idx] = array;
+                }
+            }
+        }
+
+        std::vector<std::exception_ptr> errors;
+        const auto record_error = [&] {
+            std::lock_guard<std::mutex> lock(_mutex);
+            errors.push_back(std::current_exception());
+        };
+        // Callbacks reference local state of this batch, bring back the regular ones however the batch ends.
+        // Declared before the GIL is released, so it runs with the GIL held.
+        const auto restore_callbacks = on_scope_exit([&] {
+            if (_callback) {
+                set_custom_callbacks(_callback);
+            } else {
+                set_default_callbacks();
+            }
+        });
+        {
+            py::gil_scoped_release release;
+            // Remember request tensors to restore them after the batch, bound ones point to numpy memory
+            std::vector<std::vector<ov::Tensor>> saved_inputs(_requests.size());
+            std::vector<std::vector<ov::Tensor>> saved_outputs(_requests.size());
+            for (size_t handle = 0; handle < _requests.size(); ++handle) {
+                auto& request = _requests[handle]._request;
+                for (size_t idx = 0; idx < model_inputs.size(); ++idx) {
+                    saved_inputs[handle].push_back(request.get_input_tensor(idx));
+                }
+                for (size_t idx = 0; idx < model_outputs.size(); ++idx) {
+                    saved_outputs[handle].push_back(is_static[idx] ? request.get_output_tensor(idx) : ov::Tensor());
+                }
+            }
+
+            std::vector<size_t> handle_job(_requests.size());
+            // The jobs are finished and the requests are unbound from numpy memory before it is freed, also when
+            // a job fails. A failure of a job is reported by its callback and by the wait of its request.
+            const auto restore_requests = on_scope_exit([&] {
+                for (auto&& request : _requests) {
+                    try {
+                        request._request.wait();
+                    } catch (...) {
+                        record_error();
+                    }
+                }
+                for (size_t handle = 0; handle < _requests.size(); ++handle) {
+                    auto& request = _requests[handle]._request;
+                    try {
+                        for (size_t idx = 0; idx < model_inputs.size(); ++idx) {
+                            request.set_input_tensor(idx, saved_inputs[handle][idx]);
+                        }
+                        for (size_t idx = 0; idx < model_outputs.size(); ++idx) {
+                            if (is_static[idx]) {
+                                request.set_output_tensor(idx, saved_outputs[handle][idx]);
+                            }
+                        }
+                    } catch (...) {
+                        record_error();
+                    }
+                }
+            });
+            for (size_t handle = 0; handle < _requests.size(); ++handle) {
+                _requests[handle]._request.set_callback([&, handle](std::exception_ptr exception_ptr) {
+                    _requests[handle]._end_time = Time::now();
+                    const size_t job = handle_job[handle];
+                    try {
+                        if (exception_ptr) {
+                            std::rethrow_exception(exception_ptr);
+                        }
+                        for (size_t idx = 0; idx < model_outputs.size(); ++idx) {
+                            if (is_static[idx])
+                                continue;
+                            auto result = _requests[handle]._request.get_output_tensor(idx);
+                            job_outputs[job][idx] = ov::Tensor(result.get_element_type(), result.get_shape());
+                            std::memcpy(job_outputs[job][idx].data(), result.data(), result.get_byte_size());
+                        }
+                    } catch (...) {
+                        record_error();
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _idle_handles.push(handle);
+                    }
+                    _cv.notify_one();
+                });
+            }
+
+            for (size_t job = 0; job < jobs; ++job) {
+                size_t handle;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _cv.wait(lock, [this] {
+                        return !_idle_handles.empty();
+                    });
+                    if (!errors.empty())
+                        break;
+                    handle = _idle_handles.front();
+                    _idle_handles.pop();
+                }
+                auto& request = _requests[handle]._request;
+                try {
+                    // make sure the previous job has returned from its callback
+                    request.wait();
+                    handle_job[handle] = job;
+                    for (size_t idx = 0; idx < model_inputs.size(); ++idx) {
+                        request.set_input_tensor(idx, job_inputs[job][idx]);
+                    }
+                    for (size_t idx = 0; idx < model_outputs.size(); ++idx) {
+                        if (is_static[idx]) {
+                            request.set_output_tensor(idx, job_outputs[job][idx]);
+                        }
+                    }
+                    _requests[handle]._start_time = Time::now();
+                    request.start_async();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    errors.push_back(std::current_exception());
+                    _idle_handles.push(handle);
+                    break;
+                }
+            }
+        }
+        if (!errors.empty()) {
+            std::rethrow_exception(errors.front());
+        }
+
+        if (!outputs.is_none()) {
+            return outputs;
+        }
+        py::list results;
+        for (size_t job = 0; job < jobs; ++job) {
+            py::dict result;
+            for (size_t idx = 0; idx < model_outputs.size(); ++idx) {
+                result[py::cast(model_outputs[idx])] =
+                    is_static[idx] ? job_arrays[job][idx] : array_from_tensor(job_outputs[job][idx]);
+            }
+            results.append(result);
+        }
+        return results;
+    }
+
     std::vector<InferRequestWrapper> _requests;
     std::queue<size_t> _idle_handles;
     std::vector<py::object> _user_ids;  // user ID can be any Python object
     std::mutex _mutex;
     std::condition_variable _cv;
     std::queue<py::error_already_set> _errors;
+    py::function _callback;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -203,6 +486,38 @@ void regclass_AsyncInferQueue(py::module m) {
         self.set_custom_callbacks(f_callback);
     });
 
+    cls.def(
+        "infer_batch",
+        [](AsyncInferQueue& self, const py::list& inputs, const py::object& outputs) {
+            return self.infer_batch(inputs, outputs);
+        },
+        py::arg("inputs"),
+        py::arg("outputs") = py::none(),
+        R"(
+            Runs inference of many jobs on the queue requests with a single GIL release.
+
+            Jobs are dispatched and reaped on the C++ side, callbacks set with set_callback
+            are not called for them. Numpy arrays that are C-contiguous and already have the
+            precision of the model input are shared with the runtime without a copy, other
+            arrays are converted once before the batch starts.
+
+            Parameters
+            ----------
+            inputs : list
+                One item per job: a numpy array for single-input models or a list
+                of numpy arrays/Tensors in the order of model inputs.
+
+            outputs : numpy.ndarray, optional
+                Preallocated C-contiguous array of shape [len(inputs), *output_shape]
+                filled in place. Supported for models with a single static output.
+
+            Returns
+            ----------
+            infer_batch : Union[list, numpy.ndarray]
+                `outputs` if it was provided, otherwise a list with a dictionary
+                of results per job keyed by model outputs.
+        )");
+
     cls.def("__len__", [](AsyncInferQueue& self) {
         return self._requests.size();
     });
@@ -365,6 +365,65 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+def test_infer_queue_infer_batch(device):
+    core = Core()
+    param = ops.parameter([2, 2], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, 2)
+    callback_calls = []
+    infer_queue.set_callback(lambda request, userdata: callback_calls.append(userdata))
+    data = [np.random.normal(size=(2, 2)).astype(np.float32) for _ in range(10)]
+
+    results = infer_queue.infer_batch(data)
+    assert len(results) == len(data)
+    for inputs, result in zip(data, results):
+        assert np.array_equal(result[compiled.outputs[0]], np.maximum(inputs, 0))
+    assert not callback_calls
+
+    # inputs of other precision are converted, outputs are written in place
+    outputs = np.zeros((len(data), 2, 2), dtype=np.float32)
+    assert infer_queue.infer_batch([[arr.astype(np.float64)] for arr in data], outputs) is outputs
+    assert np.array_equal(outputs, np.maximum(np.stack(data), 0))
+
+    with pytest.raises(ValueError):
+        infer_queue.infer_batch(data, np.zeros((1, 2, 2), dtype=np.float32))
+
+    # regular asynchronous flow keeps working with user callback
+    infer_queue.start_async({0: data[0]}, "after_batch")
+    infer_queue.wait_all()
+    assert callback_calls == ["after_batch"]
+
+
+def test_infer_queue_infer_batch_failed_job(device):
+    core = Core()
+    param_a = ops.parameter([-1], np.float32)
+    param_b = ops.parameter([-1], np.float32)
+    model = Model(ops.add(param_a, param_b), [param_a, param_b])
+    compiled = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled, 2)
+    callback_calls = []
+    infer_queue.set_callback(lambda request, userdata: callback_calls.append(userdata))
+
+    # the inputs are converted to temporary arrays, which are freed when the batch fails
+    data = [[np.ones(3), np.ones(3)] for _ in range(8)]
+    # the inputs of the job do not broadcast, so its inference fails
+    data[3][1] = np.ones(4)
+    with pytest.raises(RuntimeError):
+        infer_queue.infer_batch(data)
+    assert not callback_calls
+
+    # the requests are unbound from the freed arrays and the queue is reused
+    data = [[np.full(3, job, np.float32), np.ones(3, np.float32)] for job in range(8)]
+    results = infer_queue.infer_batch(data)
+    for job, result in enumerate(results):
+        assert np.array_equal(result[compiled.outputs[0]], np.full(3, job + 1, np.float32))
+
+    infer_queue.start_async({0: np.ones(3, np.float32), 1: np.ones(3, np.float32)}, "after_batch")
+    infer_queue.wait_all()
+    assert callback_calls == ["after_batch"]
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
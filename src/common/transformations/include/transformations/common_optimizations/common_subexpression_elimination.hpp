@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API CommonSubexpressionElimination;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief CommonSubexpressionElimination transformation replaces the operations computing the same value
+ * with the first one of them. The operations are equal when they have the same type, attributes (read via
+ * AttributeVisitor, the content of Constants included), runtime info and consume the same outputs.
+ * Parameters, Results, stateful, random and sub-graph based operations are never merged, the bodies
+ * of the latter are processed recursively.
+ */
+class ngraph::pass::CommonSubexpressionElimination: public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+
+    /**
+     * @brief Returns the number of the operations eliminated by the last run of the transformation
+     * per operation type
+     */
+    const std::map<std::string, size_t>& get_eliminated_nodes() const {
+        return m_eliminated_nodes;
+    }
+
+private:
+    bool eliminate(const std::shared_ptr<ngraph::Function>& f);
+
+    std::map<std::string, size_t> m_eliminated_nodes;
+};
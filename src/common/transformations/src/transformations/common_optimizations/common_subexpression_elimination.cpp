@@ -0,0 +1,279 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "itt.hpp"
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/log.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/op/util/multi_subgraph_base.hpp>
+#include <openvino/op/util/op_types.hpp>
+#include <openvino/op/util/read_value_base.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::CommonSubexpressionElimination, "CommonSubexpressionElimination", 0);
+
+namespace {
+
+using Buffer = std::pair<const void*, size_t>;
+
+// Writes the attributes of an operation to a string, the buffers (the values of Constants) are kept aside
+// to be compared only with the ones of the operations having the same other attributes.
+class AttributesCollector : public ngraph::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (auto shape = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            add(name, shape->get());
+        } else if (auto dimension = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            add(name, dimension->get());
+        } else {
+            m_comparable = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        m_buffers.emplace_back(adapter.get_ptr(), adapter.size());
+        add(name, adapter.size());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_comparable = false;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        add(name, static_cast<int64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        add(name, static_cast<uint64_t>(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        addVector(name, std::vector<int64_t>(adapter.get().begin(), adapter.get().end()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        addVector(name, std::vector<uint64_t>(adapter.get().begin(), adapter.get().end()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+
+    bool comparable() const {
+        return m_comparable;
+    }
+
+    std::string attributes() const {
+        return m_attributes.str();
+    }
+
+    const std::vector<Buffer>& buffers() const {
+        return m_buffers;
+    }
+
+private:
+    template <typename T>
+    void add(const std::string& name, const T& value) {
+        // the floating point values are written exactly
+        m_attributes.precision(17);
+        m_attributes << name << '=' << value << ';';
+    }
+
+    template <typename T>
+    void addVector(const std::string& name, const std::vector<T>& values) {
+        m_attributes.precision(17);
+        m_attributes << name << "=[";
+        for (const auto& value : values)
+            m_attributes << value << ',';
+        m_attributes << "];";
+    }
+
+    std::ostringstream m_attributes;
+    std::vector<Buffer> m_buffers;
+    bool m_comparable = true;
+};
+
+struct Candidate {
+    std::shared_ptr<ngraph::Node> node;
+    std::vector<Buffer> buffers;
+};
+
+bool is_mergeable(const std::shared_ptr<ngraph::Node>& node) {
+    return !ov::op::util::is_parameter(node) && !ov::op::util::is_output(node) && !ov::op::util::is_sink(node) &&
+           !ov::is_type<ov::op::util::ReadValueBase>(node) && !ov::is_type<ngraph::opset8::RandomUniform>(node) &&
+           !ov::is_type<ov::op::util::MultiSubGraphOp>(node) && node->get_output_size() != 0 &&
+           node->get_control_dependencies().empty() && node->get_control_dependents().empty();
+}
+
+bool is_fused_names(const std::string& key) {
+    static const std::string fused_names = ngraph::FusedNames::get_type_info_static();
+    return key == fused_names;
+}
+
+bool same_runtime_info(const ngraph::Node& lhs, const ngraph::Node& rhs) {
+    const auto& lhs_info = lhs.get_rt_info();
+    const auto& rhs_info = rhs.get_rt_info();
+    for (const auto& item : lhs_info) {
+        if (is_fused_names(item.first))
+            continue;
+        auto other = rhs_info.find(item.first);
+        try {
+            if (other == rhs_info.end() || !(item.second == other->second))
+                return false;
+        } catch (...) {
+            // the values can not be compared
+            return false;
+        }
+    }
+    return true;
+}
+
+bool same_buffers(const std::vector<Buffer>& lhs, const std::vector<Buffer>& rhs) {
+    for (size_t i = 0; i < lhs.size(); i++) {
+        if (lhs[i].second != rhs[i].second ||
+            (lhs[i].first != rhs[i].first && std::memcmp(lhs[i].first, rhs[i].first, lhs[i].second) != 0))
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+bool ngraph::pass::CommonSubexpressionElimination::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    RUN_ON_FUNCTION_SCOPE(CommonSubexpressionElimination);
+    m_eliminated_nodes.clear();
+    const bool rewritten = eliminate(f);
+
+    size_t total = 0;
+    for (const auto& item : m_eliminated_nodes) {
+        NGRAPH_DEBUG << "CommonSubexpressionElimination: " << item.second << " of " << item.first << " eliminated";
+        total += item.second;
+    }
+    NGRAPH_DEBUG << "CommonSubexpressionElimination: " << total << " operations eliminated in " << f->get_friendly_name();
+    return rewritten;
+}
+
+bool ngraph::pass::CommonSubexpressionElimination::eliminate(const std::shared_ptr<ngraph::Function>& f) {
+    bool graph_rewritten = false;
+
+    // the operations are visited in the topological order, so the inputs of an operation are already merged
+    // and the equal operations consume the same outputs
+    std::unordered_map<std::string, std::vector<Candidate>> candidates;
+    for (const auto& node : f->get_ordered_ops()) {
+        // Recursively apply transformation for sub-graph based operations
+        if (auto multi_sub_graph = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+            for (size_t i = 0; i < multi_sub_graph->get_internal_subgraphs_size(); i++) {
+                if (auto sub_graph = multi_sub_graph->get_function(static_cast<int>(i)))
+                    graph_rewritten |= eliminate(sub_graph);
+            }
+        }
+
+        if (!is_mergeable(node))
+            continue;
+
+        AttributesCollector collector;
+        std::vector<Buffer> buffers;
+        std::ostringstream key;
+        key << node->get_type_info().name << ':' << node->get_type_info().version_id << '(';
+        for (const auto& input : node->input_values())
+            key << input.get_node()->get_instance_id() << '.' << input.get_index() << ',';
+        key << ')';
+        // the visit of the Constant attributes scans the whole value, so the value is taken directly
+        if (auto constant = ov::as_type_ptr<ngraph::opset8::Constant>(node)) {
+            key << constant->get_element_type() << constant->get_shape() << ';';
+            buffers.emplace_back(constant->get_data_ptr(), constant->get_byte_size());
+        } else if (node->visit_attributes(collector) && collector.comparable()) {
+            key << collector.attributes();
+            buffers = collector.buffers();
+        } else {
+            continue;
+        }
+        for (const auto& item : node->get_rt_info()) {
+            if (!is_fused_names(item.first))
+                key << item.first << ';';
+        }
+
+        auto& same_key = candidates[key.str()];
+        auto root = std::find_if(same_key.begin(), same_key.end(), [&](const Candidate& candidate) {
+            return same_buffers(candidate.buffers, buffers) && same_runtime_info(*candidate.node, *node);
+        });
+        if (root == same_key.end()) {
+            same_key.push_back({node, std::move(buffers)});
+            continue;
+        }
+
+        // an output consumed by a Result is kept if its name can not be moved to the replacement
+        bool replaced = true;
+        for (size_t i = 0; i < node->get_output_size(); i++) {
+            const bool output_replaced = replace_output_update_name(node->output(i), root->node->output(i));
+            replaced &= output_replaced;
+            graph_rewritten |= output_replaced;
+        }
+        if (replaced) {
+            copy_runtime_info({root->node, node}, root->node);
+            m_eliminated_nodes[node->get_type_info().name]++;
+        }
+    }
+    return graph_rewritten;
+}
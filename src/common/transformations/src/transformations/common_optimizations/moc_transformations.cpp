@@ -58,6 +58,7 @@
 #include <transformations/common_optimizations/nearest_neighbor_upsampling_fusion.hpp>
 #include <transformations/common_optimizations/ric_fusion.hpp>
 #include <transformations/common_optimizations/matmul_multiply_fusion.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::MOCTransformations, "MOCTransformations", 0);
 
@@ -104,6 +105,9 @@ bool ngraph::pass::MOCTransformations::run_on_model(const std::shared_ptr<ngraph
     manager.register_pass<ngraph::pass::FuseFilteringBoxesBySize>();
     manager.register_pass<ngraph::pass::Validate>();
 
+    // merges the duplicated sub-graphs before the fusions, so each of them is matched once
+    manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+
     manager.register_pass<ngraph::pass::ConvertQuantizeDequantize>();
     manager.register_pass<ngraph::pass::SimplifyShapeOfSubGraph>();
     if (!m_use_shapes) {
@@ -10,6 +10,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -70,6 +71,150 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
+
+// Sequential NUMPY auto-broadcast implementation
+template <typename T, typename U, typename Functor>
+void numpy_autobroadcast(const T* arg0,
+                         const T* arg1,
+                         U* out,
+                         const Shape& arg0_shape,
+                         const Shape& arg1_shape,
+                         Functor elementwise_functor) {
+    size_t const shape_rank = std::max(arg0_shape.size(), arg1_shape.size()) + 1;
+
+    // TODO: Use compiler-specific alloca() or variable-length array
+    std::vector<size_t> tmp(shape_rank * 2);
+
+    size_t* strides0 = tmp.data();
+    size_t* strides1 = tmp.data() + shape_rank;
+
+    row_major_strides(arg0_shape, strides0, shape_rank);
+    row_major_strides(arg1_shape, strides1, shape_rank);
+
+    size_t const padding0 = shape_rank - arg0_shape.size();
+    size_t const padding1 = shape_rank - arg1_shape.size();
+
+    Shape output_shape(shape_rank, 0);
+
+    size_t axis = 0;
+
+    for (size_t i = 0; i < shape_rank; i++) {
+        auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
+        auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
+
+        output_shape[i] = std::max(dim0, dim1);
+
+        if (dim0 != dim1)
+            axis = std::max(axis, i);
+    }
+    if (axis == 0) {
+        for (size_t i = 0, end = strides0[0]; i < end; ++i)
+            out[i] = elementwise_functor(arg0[i], arg1[i]);
+    } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
+        axis = calculate_fixed_axis(axis, strides0);
+
+        numpy_autobroadcast_binop<0, 1>(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_shape,
+                                        arg1_shape,
+                                        strides0,
+                                        strides1,
+                                        padding0,
+                                        padding1,
+                                        output_shape,
+                                        axis,
+                                        strides1[axis],
+                                        elementwise_functor);
+    } else if (strides1[axis] == 1 && value_with_padding_or(arg1_shape, padding1, axis, 1) == 1) {
+        axis = calculate_fixed_axis(axis, strides1);
+
+        numpy_autobroadcast_binop<1, 0>(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_shape,
+                                        arg1_shape,
+                                        strides0,
+                                        strides1,
+                                        padding0,
+                                        padding1,
+                                        output_shape,
+                                        axis,
+                                        strides0[axis],
+                                        elementwise_functor);
+    } else
+        numpy_autobroadcast_binop<1, 1>(arg0,
+                                        arg1,
+                                        out,
+                                        arg0_shape,
+                                        arg1_shape,
+                                        strides0,
+                                        strides1,
+                                        padding0,
+                                        padding1,
+                                        output_shape,
+                                        axis,
+                                        strides0[axis],
+                                        elementwise_functor);
+}
+
+// Splits the output by its outermost non-trivial dimension and broadcasts every slice
+// independently. Slices never overlap, so the result is identical to the sequential one.
+template <typename T, typename U, typename Functor>
+void numpy_autobroadcast_parallel(const T* arg0,
+                                  const T* arg1,
+                                  U* out,
+                                  const Shape& arg0_shape,
+                                  const Shape& arg1_shape,
+                                  Functor elementwise_functor) {
+    Shape shape0 = arg0_shape;
+    Shape shape1 = arg1_shape;
+    const auto leading_dim = [](const Shape& shape, size_t rank) {
+        return shape.size() == rank ? shape.front() : 1;
+    };
+    // skip leading axes which are 1 for both inputs
+    size_t rank = std::max(shape0.size(), shape1.size());
+    while (rank > 1 && leading_dim(shape0, rank) == 1 && leading_dim(shape1, rank) == 1) {
+        if (shape0.size() == rank)
+            shape0.erase(shape0.begin());
+        if (shape1.size() == rank)
+            shape1.erase(shape1.begin());
+        --rank;
+    }
+
+    const size_t dim0 = rank > 0 ? leading_dim(shape0, rank) : 1;
+    const size_t dim1 = rank > 0 ? leading_dim(shape1, rank) : 1;
+    const size_t slices = std::max(dim0, dim1);
+    const Shape slice_shape0 = shape0.size() == rank && rank > 0 ? Shape(shape0.begin() + 1, shape0.end()) : shape0;
+    const Shape slice_shape1 = shape1.size() == rank && rank > 0 ? Shape(shape1.begin() + 1, shape1.end()) : shape1;
+
+    size_t out_slice_size = 1;
+    for (size_t i = 0; i + 1 < rank; ++i) {
+        const size_t sub_rank = rank - 1;
+        const size_t d0 = i < sub_rank - slice_shape0.size() ? 1 : slice_shape0[i - (sub_rank - slice_shape0.size())];
+        const size_t d1 = i < sub_rank - slice_shape1.size() ? 1 : slice_shape1[i - (sub_rank - slice_shape1.size())];
+        out_slice_size *= std::max(d0, d1);
+    }
+
+    constexpr size_t min_slice_size = 64;
+    if (slices < 2 || out_slice_size < min_slice_size || !parallel::is_worth_splitting(slices, out_slice_size)) {
+        numpy_autobroadcast(arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
+        return;
+    }
+
+    const size_t stride0 = dim0 == 1 ? 0 : shape_size(slice_shape0);
+    const size_t stride1 = dim1 == 1 ? 0 : shape_size(slice_shape1);
+    parallel::for_ranges(slices, out_slice_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            numpy_autobroadcast(arg0 + i * stride0,
+                                arg1 + i * stride1,
+                                out + i * out_slice_size,
+                                slice_shape0,
+                                slice_shape1,
+                                elementwise_functor);
+        }
+    });
+}
 }  // namespace internal
 
 /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -99,9 +244,11 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = elementwise_functor(arg0[i], arg1[i]);
-        }
+        parallel::for_ranges(shape_size(arg0_shape), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                out[i] = elementwise_functor(arg0[i], arg1[i]);
+            }
+        });
         break;
     case op::AutoBroadcastType::NUMPY:
         // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -125,104 +272,14 @@ void autobroadcast_binop(const T* arg0,
         //                 Output shape
         //                 ------------
         //                 [ 3, 2, 6]
-        {
-            using namespace internal;
-
-            size_t const shape_rank = std::max(arg0_shape.size(), arg1_shape.size()) + 1;
-
-            // TODO: Use compiler-specific alloca() or variable-length array
-            std::vector<size_t> tmp(shape_rank * 2);
-
-            size_t* strides0 = tmp.data();
-            size_t* strides1 = tmp.data() + shape_rank;
-
-            row_major_strides(arg0_shape, strides0, shape_rank);
-            row_major_strides(arg1_shape, strides1, shape_rank);
-
-            size_t const padding0 = shape_rank - arg0_shape.size();
-            size_t const padding1 = shape_rank - arg1_shape.size();
-
-            Shape output_shape(shape_rank, 0);
-
-            size_t axis = 0;
-
-            for (size_t i = 0; i < shape_rank; i++) {
-                auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
-                auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
-
-                output_shape[i] = std::max(dim0, dim1);
-
-                if (dim0 != dim1)
-                    axis = std::max(axis, i);
-            }
-#if 0
-                        // Universal function without optimisations
-                        CoordinateTransformBasic arg0_transform(arg0_shape);
-                        CoordinateTransformBasic arg1_transform(arg1_shape);
-                        U *dst = out;
-
-                        for(CoordinateIterator it(output_shape),
-                            ite = CoordinateIterator::end();
-                            it != ite;
-                            ++it)
-                        {
-                            const Coordinate& output_coord = *it;
-                            size_t const idx0 = arg0_transform.index(output_coord);
-                            size_t const idx1 = arg1_transform.index(output_coord);
-                            *dst++ = elementwise_functor(arg0[idx0], arg1[idx1]);
-                        }
-#else
-
-            if (axis == 0) {
-                for (size_t i = 0, end = strides0[0]; i < end; ++i)
+        if (arg0_shape == arg1_shape) {
+            parallel::for_ranges(shape_size(arg0_shape), 1, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
                     out[i] = elementwise_functor(arg0[i], arg1[i]);
-            } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
-                axis = calculate_fixed_axis(axis, strides0);
-
-                numpy_autobroadcast_binop<0, 1>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides1[axis],
-                                                elementwise_functor);
-            } else if (strides1[axis] == 1 && value_with_padding_or(arg1_shape, padding1, axis, 1) == 1) {
-                axis = calculate_fixed_axis(axis, strides1);
-
-                numpy_autobroadcast_binop<1, 0>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides0[axis],
-                                                elementwise_functor);
-            } else
-                numpy_autobroadcast_binop<1, 1>(arg0,
-                                                arg1,
-                                                out,
-                                                arg0_shape,
-                                                arg1_shape,
-                                                strides0,
-                                                strides1,
-                                                padding0,
-                                                padding1,
-                                                output_shape,
-                                                axis,
-                                                strides0[axis],
-                                                elementwise_functor);
-#endif
+                }
+            });
+        } else {
+            internal::numpy_autobroadcast_parallel(arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
         }
         break;
     case op::AutoBroadcastType::PDPD:
@@ -11,40 +11,58 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
 namespace details {
+struct DotDims {
+    size_t I;
+    size_t K;
+    size_t J;
+};
+
+// 2D inputs shapes are interpreted as {I, K} x {K, J}
+// If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
+// If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
+inline DotDims get_dot_dims(const Shape& arg0_shape, const Shape& arg1_shape) {
+    const size_t arg0_rank = arg0_shape.size();
+    const size_t arg1_rank = arg1_shape.size();
+    return {arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2],
+            arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2],
+            arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1]};
+}
+
+// Computes a single output row. The innermost loop walks contiguous memory of arg1 and
+// out, so it is vectorized by the compiler, while every output element still accumulates
+// its products in ascending k order, exactly as the naive i-j-k loop does.
+template <typename T>
+void dot_row(const T* arg0_row, const T* arg1, T* out_row, const DotDims& dims) {
+    std::fill(out_row, out_row + dims.J, T{0});
+    for (size_t k = 0; k < dims.K; ++k) {
+        const T a = arg0_row[k];
+        const T* arg1_row = arg1 + k * dims.J;
+        for (size_t j = 0; j < dims.J; ++j) {
+            out_row[j] += a * arg1_row[j];
+        }
+    }
+}
+
 template <typename T>
 void dot(const T* arg0,
          const T* arg1,
          T* out,
          const Shape& arg0_shape,
          const Shape& arg1_shape,
-         const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
-    const size_t arg0_rank = arg0_shape.size();
-    const size_t arg1_rank = arg1_shape.size();
-
-    // 2D inputs shapes are interpreted as {I, K} x {K, J}
-    // If first input is 1D tensor of shape {K}, it is interpreted as {1, K}
-    // If second input is 1D tensor of shape {K}, it is interpreted as {K, 1}
-    const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
-    const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
-    const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
-
-    for (size_t i = 0; i < I_dim; ++i) {
-        for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
-            for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
-            }
+         const Shape& /* out_shape */) {
+    const auto dims = get_dot_dims(arg0_shape, arg1_shape);
+    parallel::for_ranges(dims.I, dims.K * dims.J, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            dot_row(arg0 + i * dims.K, arg1, out + i * dims.J, dims);
         }
-    }
+    });
 }
 
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -208,14 +226,19 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    const auto dims = details::get_dot_dims(dot_arg0_shape, dot_arg1_shape);
+    // Batches and rows inside them are independent, so they are split across threads together
+    // to keep all threads busy both for a few large matrices and for many small ones.
+    parallel::for_ranges(output_batch_size * dims.I, dims.K * dims.J, [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx) {
+            const size_t batch = idx / dims.I;
+            const size_t row = idx % dims.I;
+            details::dot_row(arg0_data + batch * arg0_offset + row * dims.K,
+                             arg1_data + batch * arg1_offset,
+                             out + batch * output_offset + row * dims.J,
+                             dims);
+        }
+    });
 }
 }  // namespace reference
 }  // namespace runtime
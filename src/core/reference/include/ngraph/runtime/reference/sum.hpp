@@ -8,6 +8,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -58,24 +59,16 @@ void kahan_summation(const T& elem, T& compensation, T& sum) {
 
 template <typename T>
 void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes) {
-    constexpr bool dont_keep_dims_in_output = false;
-    const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
-
-    std::vector<T> cs(shape_size(out_shape), 0);
-    std::fill(out, out + shape_size(out_shape), 0);
-
-    const auto in_strides = row_major_strides(in_shape);
-    const auto out_strides = row_major_strides(out_shape);
-
-    CoordinateTransformBasic input_transform(in_shape);
-    for (const Coordinate& input_coord : input_transform) {
-        const Coordinate output_coord = reduce(input_coord, reduction_axes, dont_keep_dims_in_output);
-
-        const size_t in_idx = std::inner_product(input_coord.begin(), input_coord.end(), in_strides.begin(), 0);
-        const size_t out_idx = std::inner_product(output_coord.begin(), output_coord.end(), out_strides.begin(), 0);
-
-        details::kahan_summation(arg[in_idx], cs[out_idx], out[out_idx]);
-    }
+    parallel::for_each_reduction(in_shape,
+                                 reduction_axes,
+                                 [&](size_t out_idx, size_t base, const parallel::ReducedOffsets& reduced_offsets) {
+                                     T sum = 0;
+                                     T cs = 0;
+                                     reduced_offsets.for_each([&](size_t offset) {
+                                         details::kahan_summation(arg[base + offset], cs, sum);
+                                     });
+                                     out[out_idx] = sum;
+                                 });
 }
 }  // namespace reference
 }  // namespace runtime
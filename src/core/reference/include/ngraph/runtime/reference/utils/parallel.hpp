@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace parallel {
+/// \brief Minimal amount of elementary operations a worker thread should get.
+///        Smaller jobs are executed in the calling thread.
+constexpr size_t min_work_per_thread = 1 << 15;
+
+/// \brief Splits [0, work_amount) into contiguous chunks and calls func(begin, end) for
+///        each of them using the runtime threading backend.
+///
+/// \param work_amount Number of independent work items.
+/// \param item_cost Rough number of elementary operations per work item, used to decide
+///                  how many threads are worth waking up.
+/// \param func Functor processing items in [begin, end). Must be safe to call concurrently
+///             for disjoint ranges.
+void for_ranges(size_t work_amount, size_t item_cost, const std::function<void(size_t, size_t)>& func);
+
+/// \brief Returns true if a job of the given size would be split across several threads.
+bool is_worth_splitting(size_t work_amount, size_t item_cost);
+
+/// \brief Walks the coordinates of a shape in the row-major order and tracks the offset
+///        of the current one computed with the given strides.
+class RowMajorWalker {
+public:
+    /// \param dims Shape to walk, an empty one has a single coordinate.
+    /// \param strides Strides the offset is computed with, one per dimension.
+    /// \param start Row-major index of the first coordinate.
+    RowMajorWalker(const Shape& dims, const std::vector<size_t>& strides, size_t start = 0);
+
+    /// \brief Moves to the row-major index `start`.
+    void reset(size_t start);
+
+    /// \brief Moves to the next coordinate, wraps around after the last one.
+    void next() {
+        for (size_t d = m_dims.size(); d-- > 0;) {
+            m_offset += m_strides[d];
+            if (++m_coord[d] < m_dims[d])
+                return;
+            m_offset -= m_strides[d] * m_dims[d];
+            m_coord[d] = 0;
+        }
+    }
+
+    size_t offset() const {
+        return m_offset;
+    }
+
+private:
+    const Shape& m_dims;
+    const std::vector<size_t>& m_strides;
+    std::vector<size_t> m_coord;
+    size_t m_offset = 0;
+};
+
+/// \brief Split of the input shape of a reduction into the kept and the reduced axes.
+struct ReductionLayout {
+    Shape kept_dims;
+    std::vector<size_t> kept_strides;
+    Shape reduced_dims;
+    std::vector<size_t> reduced_strides;
+};
+
+ReductionLayout get_reduction_layout(const Shape& in_shape, const AxisSet& reduction_axes);
+
+/// \brief Offsets of the input elements contributing to an output element of a reduction,
+///        relative to the offset of its first one.
+///
+/// The offsets are generated on the fly in the row-major order of the reduced axes. That is
+/// exactly the order in which a sequential row-major walk over the input visits them, so
+/// reductions built on top of it stay bit-exact with the sequential implementation. An object
+/// is used by one thread at a time, as it keeps the walk over the outer reduced axes.
+class ReducedOffsets {
+public:
+    explicit ReducedOffsets(const ReductionLayout& layout);
+    ReducedOffsets(const ReducedOffsets&) = delete;
+    ReducedOffsets& operator=(const ReducedOffsets&) = delete;
+
+    size_t size() const {
+        return m_size;
+    }
+
+    /// \brief Calls func(offset) for every contributing element.
+    template <typename F>
+    void for_each(F&& func) const {
+        if (m_size == 0)
+            return;
+        if (m_inner_dim == 0) {
+            func(size_t{0});
+            return;
+        }
+        m_outer.reset(0);
+        for (size_t outer = m_size / m_inner_dim; outer > 0; --outer) {
+            const size_t base = m_outer.offset();
+            for (size_t i = 0; i < m_inner_dim; ++i) {
+                func(base + i * m_inner_stride);
+            }
+            m_outer.next();
+        }
+    }
+
+private:
+    Shape m_outer_dims;
+    std::vector<size_t> m_outer_strides;
+    size_t m_inner_dim = 0;
+    size_t m_inner_stride = 0;
+    size_t m_size = 0;
+    mutable RowMajorWalker m_outer;
+};
+
+/// \brief Runs func(out_idx, base, reduced_offsets) for every output element of a
+///        reduction, splitting output elements across threads. The offsets are computed on
+///        the fly, nothing proportional to the input or to the reduced axes is allocated.
+template <typename F>
+void for_each_reduction(const Shape& in_shape, const AxisSet& reduction_axes, F&& func) {
+    const auto layout = get_reduction_layout(in_shape, reduction_axes);
+    const size_t reduced_size = shape_size(layout.reduced_dims);
+    for_ranges(shape_size(layout.kept_dims), reduced_size, [&](size_t begin, size_t end) {
+        RowMajorWalker bases(layout.kept_dims, layout.kept_strides, begin);
+        const ReducedOffsets reduced(layout);
+        for (size_t out_idx = begin; out_idx < end; ++out_idx) {
+            func(out_idx, bases.offset(), reduced);
+            bases.next();
+        }
+    });
+}
+}  // namespace parallel
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -4,17 +4,85 @@
 
 #include "ngraph/runtime/reference/transpose.hpp"
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <numeric>
 #include <vector>
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+namespace {
+// Fills out[begin, end) in output row-major order. src_strides[d] is the input stride
+// (in elements) of the axis that became output axis d. Copying along the innermost output
+// axis is a plain strided loop, which the compiler vectorizes for unit input stride.
+template <typename T>
+void transpose_range(const T* in,
+                     T* out,
+                     const Shape& out_shape,
+                     const std::vector<size_t>& src_strides,
+                     size_t begin,
+                     size_t end) {
+    const size_t rank = out_shape.size();
+    std::vector<size_t> coord(rank);
+    size_t src = 0;
+    for (size_t d = rank, rest = begin; d-- > 0;) {
+        coord[d] = rest % out_shape[d];
+        rest /= out_shape[d];
+        src += coord[d] * src_strides[d];
+    }
+
+    const size_t inner_dim = out_shape[rank - 1];
+    const size_t inner_stride = src_strides[rank - 1];
+    for (size_t dst = begin; dst < end;) {
+        const size_t count = std::min(inner_dim - coord[rank - 1], end - dst);
+        const T* src_ptr = in + src;
+        T* dst_ptr = out + dst;
+        for (size_t i = 0; i < count; ++i) {
+            dst_ptr[i] = src_ptr[i * inner_stride];
+        }
+        dst += count;
+        src += count * inner_stride;
+        coord[rank - 1] += count;
+        if (coord[rank - 1] < inner_dim)
+            continue;
+        // carry to outer axes
+        src -= inner_dim * inner_stride;
+        coord[rank - 1] = 0;
+        for (size_t d = rank - 1; d-- > 0;) {
+            src += src_strides[d];
+            if (++coord[d] < out_shape[d])
+                break;
+            src -= out_shape[d] * src_strides[d];
+            coord[d] = 0;
+        }
+    }
+}
+
+template <typename T>
+void transpose_parallel(const char* data,
+                        char* out,
+                        const Shape& data_shape,
+                        const std::vector<size_t>& axis_vector,
+                        const Shape& out_shape) {
+    const auto in_strides = row_major_strides(data_shape);
+    std::vector<size_t> src_strides(axis_vector.size());
+    for (size_t d = 0; d < axis_vector.size(); ++d) {
+        src_strides[d] = in_strides[axis_vector[d]];
+    }
+    const auto in_ptr = reinterpret_cast<const T*>(data);
+    const auto out_ptr = reinterpret_cast<T*>(out);
+    parallel::for_ranges(shape_size(out_shape), 1, [&](size_t begin, size_t end) {
+        transpose_range(in_ptr, out_ptr, out_shape, src_strides, begin, end);
+    });
+}
+}  // namespace
+
 void transpose(const char* data,
                char* out,
                const Shape& data_shape,
@@ -24,7 +92,27 @@ void transpose(const char* data,
     // To reuse opt_kernel::reshape axes order vector has to be converted to AxisVector
     // Negative axes are not supported, it is validated by transpose evaluate method
     std::vector<size_t> axis_vector(axes_order, axes_order + data_shape.size());
-    runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+    if (data_shape.empty() || !parallel::is_worth_splitting(shape_size(out_shape), 1)) {
+        runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+        return;
+    }
+    switch (element_size) {
+    case 1:
+        transpose_parallel<int8_t>(data, out, data_shape, axis_vector, out_shape);
+        break;
+    case 2:
+        transpose_parallel<int16_t>(data, out, data_shape, axis_vector, out_shape);
+        break;
+    case 4:
+        transpose_parallel<int32_t>(data, out, data_shape, axis_vector, out_shape);
+        break;
+    case 8:
+        transpose_parallel<int64_t>(data, out, data_shape, axis_vector, out_shape);
+        break;
+    default:
+        runtime::opt_kernel::reshape(data, out, data_shape, axis_vector, out_shape, element_size);
+        break;
+    }
 }
 }  // namespace reference
 }  // namespace runtime
@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace parallel {
+namespace {
+size_t threads_for(size_t work_amount, size_t item_cost) {
+    if (work_amount < 2)
+        return 1;
+    const size_t total_cost = work_amount * std::max<size_t>(item_cost, 1);
+    const size_t max_threads = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+    return std::min({max_threads, work_amount, std::max<size_t>(total_cost / min_work_per_thread, 1)});
+}
+
+// the innermost reduced axis is walked by a plain loop, the walker moves over the outer ones
+template <typename T>
+T outer_axes(const T& axes) {
+    return axes.empty() ? axes : T(axes.begin(), axes.end() - 1);
+}
+}  // namespace
+
+bool is_worth_splitting(size_t work_amount, size_t item_cost) {
+    return threads_for(work_amount, item_cost) > 1;
+}
+
+void for_ranges(size_t work_amount, size_t item_cost, const std::function<void(size_t, size_t)>& func) {
+    if (work_amount == 0)
+        return;
+    const size_t nthr = threads_for(work_amount, item_cost);
+    if (nthr == 1) {
+        func(0, work_amount);
+        return;
+    }
+    InferenceEngine::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr_real) {
+        size_t begin = 0, end = 0;
+        InferenceEngine::splitter(work_amount, nthr_real, ithr, begin, end);
+        if (begin < end)
+            func(begin, end);
+    });
+}
+
+RowMajorWalker::RowMajorWalker(const Shape& dims, const std::vector<size_t>& strides, size_t start)
+    : m_dims(dims),
+      m_strides(strides),
+      m_coord(dims.size(), 0) {
+    reset(start);
+}
+
+void RowMajorWalker::reset(size_t start) {
+    m_offset = 0;
+    for (size_t d = m_dims.size(); d-- > 0;) {
+        m_coord[d] = m_dims[d] == 0 ? 0 : start % m_dims[d];
+        start = m_dims[d] == 0 ? 0 : start / m_dims[d];
+        m_offset += m_coord[d] * m_strides[d];
+    }
+}
+
+ReductionLayout get_reduction_layout(const Shape& in_shape, const AxisSet& reduction_axes) {
+    const auto in_strides = row_major_strides(in_shape);
+
+    ReductionLayout layout;
+    for (size_t axis = 0; axis < in_shape.size(); ++axis) {
+        if (reduction_axes.count(axis)) {
+            layout.reduced_dims.push_back(in_shape[axis]);
+            layout.reduced_strides.push_back(in_strides[axis]);
+        } else {
+            layout.kept_dims.push_back(in_shape[axis]);
+            layout.kept_strides.push_back(in_strides[axis]);
+        }
+    }
+    return layout;
+}
+
+ReducedOffsets::ReducedOffsets(const ReductionLayout& layout)
+    : m_outer_dims(outer_axes(layout.reduced_dims)),
+      m_outer_strides(outer_axes(layout.reduced_strides)),
+      m_inner_dim(layout.reduced_dims.empty() ? 0 : layout.reduced_dims.back()),
+      m_inner_stride(layout.reduced_strides.empty() ? 0 : layout.reduced_strides.back()),
+      m_size(shape_size(layout.reduced_dims)),
+      m_outer(m_outer_dims, m_outer_strides) {}
+}  // namespace parallel
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,308 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/mean.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/transpose.hpp"
+
+using namespace ngraph;
+
+// Heavy reference kernels split their work across threads. These tests use shapes large
+// enough to take the multi-threaded path and check that results are bit-exact with the
+// straightforward sequential computation.
+
+namespace {
+std::vector<float> make_random_data(size_t size) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> data(size);
+    for (auto& value : data) {
+        value = dist(gen);
+    }
+    return data;
+}
+
+template <typename F>
+double measure_ms(F&& func, size_t iterations = 10) {
+    func();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        func();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+}  // namespace
+
+TEST(reference_parallel, matmul_batched_bit_exact) {
+    const size_t B = 3, I = 37, K = 53, J = 61;
+    const auto a = make_random_data(B * I * K);
+    const auto b = make_random_data(B * K * J);
+    std::vector<float> result(B * I * J);
+    std::vector<float> expected(B * I * J, 0.f);
+
+    runtime::reference::matmul(a.data(),
+                               b.data(),
+                               result.data(),
+                               Shape{B, I, K},
+                               Shape{B, K, J},
+                               Shape{B, I, J},
+                               false,
+                               false);
+    for (size_t batch = 0; batch < B; ++batch)
+        for (size_t i = 0; i < I; ++i)
+            for (size_t k = 0; k < K; ++k)
+                for (size_t j = 0; j < J; ++j)
+                    expected[(batch * I + i) * J + j] += a[(batch * I + i) * K + k] * b[(batch * K + k) * J + j];
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(reference_parallel, convolution_bit_exact) {
+    const Shape in_shape{4, 3, 20, 20}, f_shape{8, 3, 3, 3}, out_shape{4, 8, 18, 18};
+    const auto data = make_random_data(shape_size(in_shape));
+    const auto filters = make_random_data(shape_size(f_shape));
+    std::vector<float> result(shape_size(out_shape));
+    std::vector<float> expected(shape_size(out_shape));
+
+    const Strides strides{1, 1}, dilations{1, 1};
+    const CoordinateDiff pads{0, 0};
+    runtime::reference::convolution(data.data(),
+                                    filters.data(),
+                                    result.data(),
+                                    in_shape,
+                                    f_shape,
+                                    out_shape,
+                                    strides,
+                                    dilations,
+                                    pads,
+                                    pads);
+    // every single (batch, filter) convolution is too small to be split across threads
+    for (size_t n = 0; n < 4; ++n) {
+        for (size_t c = 0; c < 8; ++c) {
+            runtime::reference::convolution(data.data() + n * 3 * 20 * 20,
+                                            filters.data() + c * 3 * 3 * 3,
+                                            expected.data() + (n * 8 + c) * 18 * 18,
+                                            Shape{1, 3, 20, 20},
+                                            Shape{1, 3, 3, 3},
+                                            Shape{1, 1, 18, 18},
+                                            strides,
+                                            dilations,
+                                            pads,
+                                            pads);
+        }
+    }
+
+    EXPECT_EQ(result, expected);
+}
+
+TEST(reference_parallel, reduce_bit_exact) {
+    const Shape in_shape{7, 64, 9, 33};
+    const auto data = make_random_data(shape_size(in_shape));
+    std::vector<float> sum(64 * 33), mean(64 * 33);
+    std::vector<float> expected(64 * 33, 0.f), compensation(64 * 33, 0.f);
+
+    runtime::reference::sum(data.data(), sum.data(), in_shape, AxisSet{0, 2});
+    runtime::reference::mean(data.data(), mean.data(), in_shape, AxisSet{0, 2});
+    for (size_t a = 0; a < 7; ++a)
+        for (size_t b = 0; b < 64; ++b)
+            for (size_t c = 0; c < 9; ++c)
+                for (size_t d = 0; d < 33; ++d)
+                    runtime::reference::details::kahan_summation(data[((a * 64 + b) * 9 + c) * 33 + d],
+                                                                 compensation[b * 33 + d],
+                                                                 expected[b * 33 + d]);
+
+    EXPECT_EQ(sum, expected);
+    for (size_t i = 0; i < mean.size(); ++i) {
+        EXPECT_EQ(mean[i], expected[i] / 63);
+    }
+
+    std::vector<float> max(7 * 9);
+    runtime::reference::max(data.data(), max.data(), in_shape, AxisSet{1, 3});
+    for (size_t a = 0; a < 7; ++a) {
+        for (size_t c = 0; c < 9; ++c) {
+            float expected_max = std::numeric_limits<float>::lowest();
+            for (size_t b = 0; b < 64; ++b)
+                for (size_t d = 0; d < 33; ++d)
+                    expected_max = std::max(expected_max, data[((a * 64 + b) * 9 + c) * 33 + d]);
+            EXPECT_EQ(max[a * 9 + c], expected_max);
+        }
+    }
+}
+
+TEST(reference_parallel, gather_bit_exact) {
+    const Shape data_shape{5, 100, 300};
+    const auto data = make_random_data(shape_size(data_shape));
+    const std::vector<int64_t> indices{3, -1, 0, 99, 50};
+    std::vector<float> result(5 * 5 * 300);
+
+    runtime::reference::gather(data.data(), indices.data(), result.data(), data_shape, Shape{5}, Shape{5, 5, 300}, 1);
+    for (size_t a = 0; a < 5; ++a) {
+        for (size_t i = 0; i < indices.size(); ++i) {
+            const auto idx = indices[i] < 0 ? indices[i] + 100 : indices[i];
+            for (size_t c = 0; c < 300; ++c) {
+                ASSERT_EQ(result[(a * 5 + i) * 300 + c], data[(a * 100 + idx) * 300 + c]);
+            }
+        }
+    }
+}
+
+TEST(reference_parallel, transpose_bit_exact) {
+    const Shape data_shape{3, 17, 29, 41};
+    const auto data = make_random_data(shape_size(data_shape));
+    for (const auto& order : std::vector<std::vector<int64_t>>{{0, 2, 3, 1}, {3, 2, 1, 0}, {1, 0, 2, 3}}) {
+        Shape out_shape(order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            out_shape[i] = data_shape[order[i]];
+        }
+        std::vector<float> result(data.size()), expected(data.size());
+        runtime::reference::transpose(reinterpret_cast<const char*>(data.data()),
+                                      reinterpret_cast<char*>(result.data()),
+                                      data_shape,
+                                      sizeof(float),
+                                      order.data(),
+                                      out_shape);
+        runtime::opt_kernel::reshape(reinterpret_cast<const char*>(data.data()),
+                                     reinterpret_cast<char*>(expected.data()),
+                                     data_shape,
+                                     AxisVector(order.begin(), order.end()),
+                                     out_shape,
+                                     sizeof(float));
+        EXPECT_EQ(result, expected);
+    }
+}
+
+TEST(reference_parallel, numpy_broadcast_bit_exact) {
+    struct BroadcastCase {
+        Shape arg0;
+        Shape arg1;
+        Shape out;
+    };
+    const std::vector<BroadcastCase> cases{{{8, 64, 32}, {64, 1}, {8, 64, 32}},
+                                           {{8, 64, 32}, {8, 1, 32}, {8, 64, 32}},
+                                           {{1, 64, 128}, {64, 1}, {1, 64, 128}},
+                                           {{64, 128}, {1}, {64, 128}},
+                                           {{8, 1, 128}, {1, 64, 1}, {8, 64, 128}}};
+    for (const auto& c : cases) {
+        const auto arg0 = make_random_data(shape_size(c.arg0));
+        const auto arg1 = make_random_data(shape_size(c.arg1));
+        std::vector<float> result(shape_size(c.out)), expected(shape_size(c.out));
+        runtime::reference::add(arg0.data(), arg1.data(), result.data(), c.arg0, c.arg1, op::AutoBroadcastType::NUMPY);
+        runtime::reference::internal::numpy_autobroadcast(arg0.data(),
+                                                          arg1.data(),
+                                                          expected.data(),
+                                                          c.arg0,
+                                                          c.arg1,
+                                                          [](float x, float y) {
+                                                              return x + y;
+                                                          });
+        EXPECT_EQ(result, expected);
+    }
+}
+
+// Microbenchmarks of the heavy reference kernels, run them with --gtest_also_run_disabled_tests
+TEST(reference_parallel, DISABLED_benchmark) {
+    {
+        const size_t M = 512;
+        const auto a = make_random_data(M * M);
+        const auto b = make_random_data(M * M);
+        std::vector<float> out(M * M);
+        std::cout << "matmul 512x512x512: " << measure_ms([&] {
+            runtime::reference::matmul(a.data(),
+                                       b.data(),
+                                       out.data(),
+                                       Shape{M, M},
+                                       Shape{M, M},
+                                       Shape{M, M},
+                                       false,
+                                       false);
+        }) << " ms" << std::endl;
+    }
+    {
+        const Shape in_shape{1, 64, 56, 56}, f_shape{64, 64, 3, 3}, out_shape{1, 64, 56, 56};
+        const auto data = make_random_data(shape_size(in_shape));
+        const auto filters = make_random_data(shape_size(f_shape));
+        std::vector<float> out(shape_size(out_shape));
+        std::cout << "convolution 1x64x56x56 k3x3: " << measure_ms([&] {
+            runtime::reference::convolution(data.data(),
+                                            filters.data(),
+                                            out.data(),
+                                            in_shape,
+                                            f_shape,
+                                            out_shape,
+                                            Strides{1, 1},
+                                            Strides{1, 1},
+                                            CoordinateDiff{1, 1},
+                                            CoordinateDiff{1, 1});
+        }, 1) << " ms" << std::endl;
+    }
+    {
+        const Shape in_shape{64, 256, 256};
+        const auto data = make_random_data(shape_size(in_shape));
+        std::vector<float> out(64 * 256);
+        std::cout << "reduce_sum 64x256x256 axis 1: " << measure_ms([&] {
+            runtime::reference::sum(data.data(), out.data(), in_shape, AxisSet{1});
+        }) << " ms" << std::endl;
+    }
+    {
+        const Shape data_shape{32, 128, 32, 32};
+        const auto data = make_random_data(shape_size(data_shape));
+        const std::vector<int64_t> order{0, 2, 3, 1};
+        std::vector<float> out(data.size());
+        std::cout << "transpose 32x128x32x32 {0,2,3,1}: " << measure_ms([&] {
+            runtime::reference::transpose(reinterpret_cast<const char*>(data.data()),
+                                          reinterpret_cast<char*>(out.data()),
+                                          data_shape,
+                                          sizeof(float),
+                                          order.data(),
+                                          Shape{32, 32, 32, 128});
+        }) << " ms" << std::endl;
+    }
+    {
+        const Shape data_shape{30000, 512};
+        const auto data = make_random_data(shape_size(data_shape));
+        std::vector<int64_t> indices(4096);
+        for (size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = static_cast<int64_t>((i * 7919) % data_shape[0]);
+        }
+        std::vector<float> out(indices.size() * data_shape[1]);
+        std::cout << "gather 30000x512 by 4096 indices: " << measure_ms([&] {
+            runtime::reference::gather(data.data(),
+                                       indices.data(),
+                                       out.data(),
+                                       data_shape,
+                                       Shape{indices.size()},
+                                       Shape{indices.size(), data_shape[1]},
+                                       0);
+        }) << " ms" << std::endl;
+    }
+    {
+        const Shape arg0_shape{64, 256, 256}, arg1_shape{256, 1};
+        const auto arg0 = make_random_data(shape_size(arg0_shape));
+        const auto arg1 = make_random_data(shape_size(arg1_shape));
+        std::vector<float> out(arg0.size());
+        std::cout << "add 64x256x256 + 256x1: " << measure_ms([&] {
+            runtime::reference::add(arg0.data(),
+                                    arg1.data(),
+                                    out.data(),
+                                    arg0_shape,
+                                    arg1_shape,
+                                    op::AutoBroadcastType::NUMPY);
+        }) << " ms" << std::endl;
+    }
+}
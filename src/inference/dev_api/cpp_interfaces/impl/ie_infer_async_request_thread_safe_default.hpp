@@ -292,6 +292,21 @@ public:
         }
     }
 
+    void SetDeadline(const std::chrono::steady_clock::time_point& deadline) override {
+        CheckState();
+        _syncRequest->SetDeadline(deadline);
+    }
+
+    void ReleaseBlobs() override {
+        CheckState();
+        _syncRequest->ReleaseBlobs();
+    }
+
+    void SetInputReady(const std::string& name) override {
+        CheckState();
+        _syncRequest->SetInputReady(name);
+    }
+
     void setModelInputsOutputs(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                const std::vector<std::shared_ptr<const ov::Node>>& outputs) override {
         _parameters = inputs;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -71,6 +72,29 @@ public:
      */
     virtual void Cancel();
 
+    /**
+     * @brief Sets the deadline of the inferences of the request. An inference not completed by the deadline is
+     * aborted, before it starts or between the operations, and reported as cancelled. Throws NotImplemented by default,
+     * since ignoring the deadline would break the promise to the caller
+     * @param deadline The point in time, std::chrono::steady_clock::time_point::max() means no deadline
+     */
+    virtual void SetDeadline(const std::chrono::steady_clock::time_point& deadline);
+
+    /**
+     * @brief Gives the memory of the input and output blobs back to the plugin if the plugin pools it between
+     * the requests. The blobs still held by the user keep their data and are taken back by the request later.
+     * It is a hint, the default implementation does nothing
+     */
+    virtual void ReleaseBlobs();
+
+    /**
+     * @brief Marks the input as ready for the next inference, so the plugin may start the operations depending
+     * only on the ready inputs while the rest of them are being prepared. It is a hint, the default implementation
+     * does nothing
+     * @param name Name of the input blob, its data must not be changed until the inference
+     */
+    virtual void SetInputReady(const std::string& name);
+
     /**
      * @brief Queries performance measures per layer to get feedback of what is the most time consuming layer.
      *  Note: not all plugins may provide meaningful data
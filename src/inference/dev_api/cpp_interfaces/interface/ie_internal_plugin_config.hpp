@@ -53,6 +53,148 @@ DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables collection of hardware event counters (cycles, instructions, LLC misses) per CPU node.
+ * Implies PERF_COUNT. Values: YES / NO
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HW_PERF_COUNTERS);
+
+/**
+ * @brief Path to a file the CPU plugin appends node execution events to, in the Chrome tracing JSON format.
+ * Empty value disables the trace
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_TRACE_FILE);
+
+/**
+ * @brief Enables the graph-wide memory layouts selection in the CPU plugin, which minimizes the number of reorders
+ * instead of choosing the layouts node by node. Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_GLOBAL_LAYOUT_ASSIGNMENT);
+
+/**
+ * @brief Enables the CPU plugin to time the best candidate implementations of Convolution and FullyConnected
+ * nodes during the compilation and select the fastest ones. Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PRIMITIVE_TUNING);
+
+/**
+ * @brief Path to a file the CPU plugin keeps the primitive tuning results in, so the next compilations on the same
+ * machine reuse them without timing. Empty value keeps the results in memory only
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TUNING_CACHE_FILE);
+
+/**
+ * @brief Number of the candidate implementations timed per node by the CPU primitive tuning, 3 by default
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TUNING_CANDIDATES);
+
+/**
+ * @brief Places the memory of each CPU stream (the graph intermediate tensors, the constants and the input and
+ * output blobs allocated by the infer requests) on the NUMA node of the stream. Has an effect on the multi-socket
+ * systems only. The blobs and tensors the user sets to a request are used as they are, they are placed wherever the
+ * user allocated them. Values: YES (default) / NO
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_MEMORY_BINDING);
+
+/**
+ * @brief Backs the large buffers the CPU plugin allocates while compiling a network (the intermediate tensors
+ * workspace, the weights and the constants) by the huge pages. Values: NO (default), TRANSPARENT (transparent huge
+ * pages requested by madvise), EXPLICIT (hugetlbfs pages, falls back to the transparent ones if the pool is empty)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+DECLARE_CONFIG_VALUE(TRANSPARENT);
+DECLARE_CONFIG_VALUE(EXPLICIT);
+
+/**
+ * @brief Makes the CPU infer requests lease their input and output blobs from a memory pool shared by the requests
+ * of the network instead of allocating them on the creation. The blobs are leased on demand, the input ones are
+ * given back after each inference and the output ones when the request releases them, so the memory scales with
+ * the number of the requests in flight. Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_POOLED_REQUEST_BLOBS);
+
+/**
+ * @brief Defines the longest time in milliseconds the CPU inference tasks of a network may be deferred for
+ * the networks of higher MODEL_PRIORITY sharing the CPU. A task waiting longer is run regardless of the priorities.
+ * Values: non-negative integers, 0 (default) means that the tasks are deferred while there are tasks of the
+ * higher priorities
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SCHEDULING_SLO);
+
+/**
+ * @brief Splits the batch of an inference of the CPU network with a dynamic batch dimension into micro-batches of
+ * the given size run concurrently by the graph replicas of the network, so the nodes parallelizing poorly over
+ * the large batches are not bound by a single graph. The samples of the batch must be computed independently:
+ * the batch is not split if an operation works along the batch axis, as a Concat, a Softmax or a reduction of
+ * the axis 0, if an operation is not known to compute the samples independently, or if an output does not keep
+ * the batch as its first dimension. Values: non-negative integers, 0 (default) disables the splitting
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MICRO_BATCH);
+
+/**
+ * @brief Lists the input shapes the CPU network with dynamic inputs is expected to be inferred with. A graph of
+ * static shapes is compiled for each bucket, and the inferences with the input shapes of a bucket are run by it,
+ * the other ones by the dynamic graph. The buckets are separated by semicolons, the shapes of the inputs of a bucket
+ * by commas, e.g. "ids[1,32],mask[1,32];ids[1,64],mask[1,64]". The inputs not listed keep their shapes.
+ * Loading a network of the legacy API with the buckets throws. The buckets are not used if the network is
+ * compiled for the upper bound of its dynamic batch, as all its inferences are run by a static graph then
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPE_BUCKETS);
+
+/**
+ * @brief Makes the static CPU graphs record the kernels their nodes run on the first inference and replay them as
+ * a flat list on the next ones, skipping the per node dispatch and checks. The nodes whose kernels can't be recorded
+ * are executed as usual. A replayed inference is checked for the cancellation once, before it starts. The graphs of
+ * the legacy dynamic batch are not replayed, as their primitives are recreated for the batch of each inference.
+ * Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_GRAPH_REPLAY);
+
+/**
+ * @brief Makes the CPU graphs read the weights of the node executed next into the caches by a helper thread while
+ * the current node computes, so the models with the weights larger than the last level cache do not stream them
+ * from the DRAM node by node. Each stream has one helper thread bound to the cores of the stream, shared by its graphs,
+ * the graph replicas running the micro-batches of an inference do not prefetch. Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_PREFETCH);
+
+/**
+ * @brief Metric of the CPU executable network reporting how its inference tasks were queued by the scheduler of
+ * the networks sharing the CPU: a map of the submitted, deferred, overdue, queued and running task counts and
+ * the total and max queueing times in microseconds
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_SCHEDULING_STATISTICS = "CPU_SCHEDULING_STATISTICS";
+
+/**
+ * @brief Metric of the CPU executable network reporting the utilization of the Big and the Little cores of a hybrid
+ * CPU by its streams: a map of the streams, the tasks run, the tasks running and the busy time in microseconds per
+ * core type (e.g. BIG_TASKS, LITTLE_BUSY_US). The map is empty if the streams do not distinguish the core types
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_CORE_TYPES_UTILIZATION = "CPU_CORE_TYPES_UTILIZATION";
+
+/**
+ * @brief Metric of the CPU executable network reporting the numbers of the inferences aborted because their
+ * deadlines passed (EXPIRED) and because they were cancelled (CANCELLED)
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr auto METRIC_CPU_ABORTED_INFERENCES = "CPU_ABORTED_INFERENCES";
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -17,6 +17,7 @@
 
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
+#include "threading/ie_priority_scheduler.hpp"
 
 namespace InferenceEngine {
 
@@ -46,6 +47,12 @@ public:
     /// @private
     virtual IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) = 0;
 
+    /**
+     * @brief Returns the scheduler coordinating the inference tasks of all the models sharing the CPU
+     * @return A shared pointer to the process-wide PriorityScheduler
+     */
+    virtual PriorityScheduler::Ptr getPriorityScheduler() = 0;
+
     /**
      * @cond
      */
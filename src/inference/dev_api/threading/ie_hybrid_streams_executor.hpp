@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_hybrid_streams_executor.hpp
+ * @brief A header file for Inference Engine streams executor of the hybrid CPUs
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class HybridStreamsExecutor
+ * @ingroup ie_dev_api_threading
+ * @brief Streams executor of the hybrid CPUs. The streams of the Big (performance) and the Little (efficient) cores
+ *        are run by separate pools. A task is run by a free stream of the Big cores and spills over to the Little
+ *        cores only when all the streams of the Big cores are busy. The streams of the Little cores follow the ones
+ *        of the Big cores in the stream ids.
+ */
+class INFERENCE_ENGINE_API_CLASS(HybridStreamsExecutor) : public IStreamsExecutor {
+public:
+    /**
+     * @brief A shared pointer to a HybridStreamsExecutor object
+     */
+    using Ptr = std::shared_ptr<HybridStreamsExecutor>;
+
+    /**
+     * @brief The numbers of the cores of a hybrid CPU
+     */
+    struct Topology {
+        int bigCores = 0;         //!< Number of the physical Big cores
+        int bigLogicalCores = 0;  //!< Number of the logical Big cores, the hyper-threads included
+        int littleCores = 0;      //!< Number of the Little cores, zero for the non-hybrid CPUs
+    };
+
+    /**
+     * @brief The configurations of the pools of the streams
+     */
+    struct Pools {
+        Config big;     //!< The streams of the Big cores
+        Config little;  //!< The streams of the Little cores, no streams if the Little cores are not used
+    };
+
+    /**
+     * @brief Utilization of the streams of a core type
+     */
+    struct Utilization {
+        int streams = 0;                     //!< Number of the streams
+        uint64_t tasks = 0;                  //!< Number of the tasks run
+        uint64_t running = 0;                //!< Number of the tasks submitted and not completed yet
+        std::chrono::microseconds busy{0};  //!< Total time the tasks were running
+    };
+
+    /**
+     * @brief Returns the topology of the CPU of the machine
+     * @return The numbers of the cores, no Little cores for the non-hybrid CPUs and the non-TBB threading
+     */
+    static Topology GetTopology();
+
+    /**
+     * @brief Splits the streams between the core types of a hybrid CPU
+     * @param initial The configuration of the streams, as resolved by Config::MakeDefaultMultiThreaded
+     * @param latency The streams serve the latency case, so are placed on the Big cores only
+     * @param topology The topology of the CPU
+     * @return The configurations of the pools. The streams are placed on the Big cores while the threads of a stream
+     *         fit them, the rest of the streams go to the Little cores
+     */
+    static Pools MakePools(const Config& initial, bool latency, const Topology& topology);
+
+    /**
+     * @brief Constructor
+     * @param big The executor of the streams of the Big cores
+     * @param bigStreams The number of the streams of the Big cores
+     * @param little The executor of the streams of the Little cores, may be empty if there are no such streams
+     * @param littleStreams The number of the streams of the Little cores
+     */
+    HybridStreamsExecutor(const IStreamsExecutor::Ptr& big,
+                          int bigStreams,
+                          const IStreamsExecutor::Ptr& little,
+                          int littleStreams);
+
+    /**
+     * @brief A class destructor
+     */
+    ~HybridStreamsExecutor() override;
+
+    void run(Task task) override;
+
+    void Execute(Task task) override;
+
+    int GetStreamId() override;
+
+    int GetNumaNodeId() override;
+
+    /**
+     * @brief Returns the utilization of the streams of a core type
+     * @param coreType Config::BIG or Config::LITTLE
+     */
+    Utilization GetUtilization(Config::PreferredCoreType coreType) const;
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_priority_scheduler.hpp
+ * @brief A header file for the process-wide scheduler of the inference tasks of the models sharing the CPU
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "threading/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Admission control of the inference tasks of all the models sharing the CPU in the process.
+ * Each model gets a scheduled executor wrapping its own one. A task of a model is admitted to the wrapped executor
+ * only while no model of a higher priority has tasks running or waiting, and while the model has less tasks
+ * in flight than its concurrency (usually the number of its streams), so the backlog of a model stays in the
+ * scheduler where it yields to the models of higher priorities. A task waiting longer than the SLO of its model
+ * is admitted regardless of the priorities, so the SLO bounds the starvation of the low priority models.
+ * The waiting tasks are reconsidered whenever a task is submitted or completed, and by a timer thread when the SLO
+ * of a deferred task expires, so an overdue task does not wait for the next event of the scheduler.
+ * @ingroup ie_dev_api_threading
+ */
+class INFERENCE_ENGINE_API_CLASS(PriorityScheduler) : public std::enable_shared_from_this<PriorityScheduler> {
+public:
+    /**
+     * A shared pointer to PriorityScheduler
+     */
+    using Ptr = std::shared_ptr<PriorityScheduler>;
+
+    /**
+     * @brief Stops the timer thread
+     */
+    ~PriorityScheduler();
+
+    /**
+     * @brief Queueing statistics of a model
+     */
+    struct Statistics {
+        uint64_t submitted = 0;        //!< Number of the tasks submitted
+        uint64_t deferred = 0;         //!< Number of the tasks that waited in the scheduler
+        uint64_t overdue = 0;          //!< Number of the tasks admitted because they waited longer than the SLO
+        uint64_t queued = 0;           //!< Number of the tasks waiting now
+        uint64_t running = 0;          //!< Number of the tasks admitted and not completed yet
+        std::chrono::microseconds totalQueueing{0};  //!< Total time the tasks waited in the scheduler
+        std::chrono::microseconds maxQueueing{0};    //!< Longest time a task waited in the scheduler
+    };
+
+    /**
+     * @brief Creates the executor scheduling the tasks of a model. The model stays registered while the
+     * returned executor is alive.
+     * @param name The name of the model the statistics are reported for
+     * @param priority The priority of the model, the greater value the higher priority
+     * @param slo The longest time the tasks of the model may wait for the models of higher priorities, zero for unbounded
+     * @param executor The executor the admitted tasks are run by
+     * @param concurrency The maximal number of the tasks of the model in flight
+     * @return A shared pointer to the scheduled executor
+     */
+    ITaskExecutor::Ptr makeExecutor(const std::string& name,
+                                    int priority,
+                                    std::chrono::milliseconds slo,
+                                    const ITaskExecutor::Ptr& executor,
+                                    size_t concurrency);
+
+    /**
+     * @brief Stops admitting the tasks of a model and waits for its admitted tasks to complete. The tasks submitted
+     * meanwhile wait in the scheduler and do not defer the models of lower priorities.
+     * @param executor The executor created by makeExecutor()
+     */
+    void suspend(const ITaskExecutor::Ptr& executor);
+
+    /**
+     * @brief Resumes admitting the tasks of a suspended model
+     * @param executor The executor created by makeExecutor()
+     * @param target The executor the admitted tasks are run by from now on
+     * @param concurrency The maximal number of the tasks of the model in flight from now on
+     */
+    void resume(const ITaskExecutor::Ptr& executor, const ITaskExecutor::Ptr& target, size_t concurrency);
+
+    /**
+     * @brief Returns the queueing statistics of the registered models by their names
+     */
+    std::map<std::string, Statistics> getStatistics() const;
+
+    /**
+     * @brief Returns the queueing statistics of the model the scheduled executor is created for
+     * @param executor The executor created by makeExecutor()
+     */
+    Statistics getStatistics(const ITaskExecutor::Ptr& executor) const;
+
+private:
+    struct Tenant;
+    class ScheduledExecutor;
+    struct Timer;
+
+    struct Waiting {
+        Task task;
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    void submit(const std::shared_ptr<Tenant>& tenant, Task task);
+    void complete(const std::shared_ptr<Tenant>& tenant);
+    // collects the waiting tasks to be admitted, called under the lock
+    void admit(std::vector<std::pair<std::shared_ptr<Tenant>, Task>>& admitted);
+    void dispatch(std::vector<std::pair<std::shared_ptr<Tenant>, Task>>& admitted);
+    // wakes the timer thread up at the time the first deferred task gets overdue, called under the lock
+    void setTimer(std::chrono::steady_clock::time_point overdue);
+    // admits the overdue tasks, called by the timer thread
+    void recheck();
+
+    mutable std::mutex _mutex;
+    std::condition_variable _drained;
+    std::vector<std::weak_ptr<Tenant>> _tenants;
+    // the state of the timer is shared with its thread, the thread may outlive the scheduler released by it
+    std::shared_ptr<Timer> _timer;
+    std::thread _timerThread;
+};
+
+}  // namespace InferenceEngine
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -135,6 +136,34 @@ public:
      */
     void Cancel();
 
+    /**
+     * @brief Sets the deadline of the inferences of the request. An inference not completed by the deadline is
+     * aborted and reported by the InferCancelled exception
+     *
+     * @note Throws NotImplemented if the plugin cannot abort the inferences
+     * @param deadline The point in time, std::chrono::steady_clock::time_point::max() means no deadline
+     */
+    void SetDeadline(const std::chrono::steady_clock::time_point& deadline);
+
+    /**
+     * @brief Gives the memory of the input and output blobs back to the plugin, if the plugin pools it between
+     * the requests of the network
+     *
+     * @note The blobs still held by the caller keep their data and are used by the next inference of the request.
+     * It is a hint, the plugins not pooling the memory ignore it
+     */
+    void ReleaseBlobs();
+
+    /**
+     * @brief Marks the input as ready for the next inference, so the plugin may start the layers depending only on
+     * the ready inputs while the rest of them are being prepared
+     *
+     * @note The data of the input blob must not be changed until the inference. Setting a new blob of the input
+     * discards the work done for it. It is a hint, the plugins not starting the inference early ignore it
+     * @param name Name of the input blob
+     */
+    void SetInputReady(const std::string& name);
+
     /**
      * @brief Queries performance measures per layer to get feedback of what is the most time consuming layer
      *
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -266,6 +267,43 @@ public:
      */
     void cancel();
 
+    /**
+     * @brief Sets the deadline of the inferences of the request. An inference not completed by the deadline is
+     * aborted and reported by the ov::Cancelled exception. Throws ov::Exception if the device cannot abort the
+     * inferences.
+     * @param deadline The point in time, std::chrono::steady_clock::time_point::max() means no deadline.
+     */
+    void set_deadline(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief Gives the memory of the input and output tensors back to the device, if the device pools it between
+     * the infer requests of the compiled model.
+     * @note The tensors still held by the caller keep their data and are used by the next inference of the request.
+     * It is a hint, the devices not pooling the memory ignore it.
+     */
+    void release_tensors();
+
+    /**
+     * @brief Marks the input as ready for the next inference, so the device may start the operations depending only
+     * on the ready inputs while the rest of them are being prepared.
+     * @note The data of the input tensor must not be changed until the inference. Setting a new tensor of the input
+     * discards the work done for it. It is a hint, the devices not starting the inference early ignore it.
+     * @param port Port of the input tensor.
+     */
+    void set_input_ready(const ov::Output<const ov::Node>& port);
+
+    /**
+     * @brief Marks the input as ready for the next inference.
+     * @param port Port of the input tensor.
+     */
+    void set_input_ready(const ov::Output<ov::Node>& port);
+
+    /**
+     * @brief Marks the input as ready for the next inference.
+     * @param tensor_name Name of the input tensor.
+     */
+    void set_input_ready(const std::string& tensor_name);
+
     /**
      * @brief Queries performance measures per layer to identify the most time consuming operation.
      * @note Not all plugins provide meaningful data.
@@ -53,6 +53,8 @@ namespace InferenceEngine {
         __VA_ARGS__;                                                        \
     } catch (const ::InferenceEngine::RequestBusy& ex) {                    \
         throw ov::Busy(ex.what());                                          \
+    } catch (const ::InferenceEngine::InferCancelled& ex) {                 \
+        throw ov::Cancelled(ex.what());                                     \
     } catch (const std::exception& ex) {                                    \
         throw ov::Exception(ex.what());                                     \
     } catch (...) {                                                         \
@@ -103,6 +105,18 @@ void InferRequest::Cancel() {
     INFER_REQ_CALL_STATEMENT(_impl->Cancel();)
 }
 
+void InferRequest::SetDeadline(const std::chrono::steady_clock::time_point& deadline) {
+    INFER_REQ_CALL_STATEMENT(_impl->SetDeadline(deadline);)
+}
+
+void InferRequest::ReleaseBlobs() {
+    INFER_REQ_CALL_STATEMENT(_impl->ReleaseBlobs();)
+}
+
+void InferRequest::SetInputReady(const std::string& name) {
+    INFER_REQ_CALL_STATEMENT(_impl->SetInputReady(name);)
+}
+
 std::map<std::string, InferenceEngineProfileInfo> InferRequest::GetPerformanceCounts() const {
     INFER_REQ_CALL_STATEMENT(return _impl->GetPerformanceCounts();)
 }
@@ -418,6 +432,33 @@ void InferRequest::cancel() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->Cancel();)
 }
 
+void InferRequest::set_deadline(std::chrono::steady_clock::time_point deadline) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetDeadline(deadline);)
+}
+
+void InferRequest::release_tensors() {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->ReleaseBlobs();)
+}
+
+void InferRequest::set_input_ready(const ov::Output<const ov::Node>& port) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetInputReady(get_legacy_name_from_port(port));)
+}
+
+void InferRequest::set_input_ready(const ov::Output<ov::Node>& port) {
+    set_input_ready(ov::Output<const ov::Node>(port.get_node(), port.get_index()));
+}
+
+void InferRequest::set_input_ready(const std::string& tensor_name) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        ov::Output<const ov::Node> port;
+        OPENVINO_ASSERT(::getPort(port, tensor_name, {_impl->GetInputs()}),
+                        "set_input_ready error. Input port for tensor name ",
+                        tensor_name,
+                        " was not found.");
+        set_input_ready(port);
+    });
+}
+
 std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
     OV_INFER_REQ_CALL_STATEMENT({
         auto ieInfos = _impl->GetPerformanceCounts();
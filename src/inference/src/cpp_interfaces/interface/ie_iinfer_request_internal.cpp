@@ -81,6 +81,18 @@ void IInferRequestInternal::Cancel() {
     IE_THROW(NotImplemented);
 }
 
+void IInferRequestInternal::SetDeadline(const std::chrono::steady_clock::time_point&) {
+    IE_THROW(NotImplemented);
+}
+
+void IInferRequestInternal::ReleaseBlobs() {
+    // the plugins not pooling the memory keep the blobs
+}
+
+void IInferRequestInternal::SetInputReady(const std::string&) {
+    // the plugins not starting the inference early wait for the Infer() call
+}
+
 std::map<std::string, InferenceEngineProfileInfo> IInferRequestInternal::GetPerformanceCounts() const {
     IE_THROW(NotImplemented);
 }
@@ -489,22 +501,34 @@ bool IInferRequestInternal::findInputAndOutputBlobByName(const std::string& name
     return retVal;
 }
 
+// same as PartialShape::compatible with the shape of the dims, without constructing it
+static bool isCompatible(const ov::PartialShape& shape, const SizeVector& dims) {
+    if (shape.rank().is_dynamic())
+        return true;
+    if (shape.size() != dims.size())
+        return false;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (!shape[i].compatible(static_cast<ov::Dimension::value_type>(dims[i])))
+            return false;
+    }
+    return true;
+}
+
 void IInferRequestInternal::checkBlob(const Blob::Ptr& blob,
                                       const std::string& name,
                                       bool isInput,
                                       const SizeVector& refDims) const {
-    std::string bType = isInput ? "Input" : "Output";
-    std::string sType = isInput ? "input" : "output";
-    std::string strNotAllocated(bType + " data was not allocated.");
-    std::string strNotMatched("The " + sType + " blob size is not equal to the network " + sType + " size");
+    // the blobs are checked by each inference, so nothing is allocated unless the check fails
+    const char* bType = isInput ? "Input" : "Output";
+    const char* sType = isInput ? "input" : "output";
 
     if (!blob) {
-        IE_THROW(NotAllocated) << strNotAllocated;
+        IE_THROW(NotAllocated) << bType << " data was not allocated.";
     }
     size_t refSize;
     bool isDynamic = false;
     if (refDims.empty()) {
-        SizeVector dims;
+        const SizeVector* dims;
         if (isInput) {
             auto foundInputPair = std::find_if(std::begin(_networkInputs),
                                                std::end(_networkInputs),
@@ -521,8 +545,8 @@ void IInferRequestInternal::checkBlob(const Blob::Ptr& blob,
             if (!input)
                 isDynamic = foundInputPair->second->getInputData()->isDynamic();
             IE_SUPPRESS_DEPRECATED_END
-            dims = foundInputPair->second->getTensorDesc().getDims();
-            refSize = foundInputPair->second->getTensorDesc().getLayout() != SCALAR ? details::product(dims) : 1;
+            dims = &foundInputPair->second->getTensorDesc().getDims();
+            refSize = foundInputPair->second->getTensorDesc().getLayout() != SCALAR ? details::product(*dims) : 1;
         } else {
             auto foundOutputPair = std::find_if(std::begin(_networkOutputs),
                                                 std::end(_networkOutputs),
@@ -539,26 +563,26 @@ void IInferRequestInternal::checkBlob(const Blob::Ptr& blob,
             if (!output)
                 isDynamic = foundOutputPair->second->isDynamic();
             IE_SUPPRESS_DEPRECATED_END
-            ngraph::PartialShape blobPartialShape(blob->getTensorDesc().getDims());
-            if (output && output->get_output_partial_shape(0).compatible(blobPartialShape)) {
-                dims = blob->getTensorDesc().getDims();
+            if (output && isCompatible(output->get_output_partial_shape(0), blob->getTensorDesc().getDims())) {
+                dims = &blob->getTensorDesc().getDims();
             } else {
                 // TODO: it is strange to request tensor desc from data when the shapes are not compatible, probably we
                 // need to immediately throw here
-                dims = foundOutputPair->second->getTensorDesc().getDims();
+                dims = &foundOutputPair->second->getTensorDesc().getDims();
             }
-            refSize = foundOutputPair->second->getTensorDesc().getLayout() != SCALAR ? details::product(dims) : 1;
+            refSize = foundOutputPair->second->getTensorDesc().getLayout() != SCALAR ? details::product(*dims) : 1;
         }
     } else {
         refSize = details::product(refDims);
     }
 
     if (!isDynamic && refSize != blob->size()) {
-        IE_THROW() << strNotMatched + ": got " << blob->size() << " expecting " << refSize;
+        IE_THROW() << "The " << sType << " blob size is not equal to the network " << sType << " size: got "
+                   << blob->size() << " expecting " << refSize;
     }
     const bool remoteBlobPassed = blob->is<RemoteBlob>();
     if (!remoteBlobPassed && blob->buffer() == nullptr)
-        IE_THROW() << strNotAllocated;
+        IE_THROW() << bType << " data was not allocated.";
 }
 
 void IInferRequestInternal::checkBlobs() {
@@ -16,6 +16,7 @@ class ExecutorManagerImpl : public ExecutorManager {
 public:
     ITaskExecutor::Ptr getExecutor(const std::string& id) override;
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) override;
+    PriorityScheduler::Ptr getPriorityScheduler() override;
     size_t getExecutorsNumber() const override;
     size_t getIdleCPUStreamsExecutorsNumber() const override;
     void clear(const std::string& id = {}) override;
@@ -23,6 +24,7 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
+    PriorityScheduler::Ptr priorityScheduler = std::make_shared<PriorityScheduler>();
     mutable std::mutex streamExecutorMutex;
     mutable std::mutex taskExecutorMutex;
 };
@@ -62,6 +64,10 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+PriorityScheduler::Ptr ExecutorManagerImpl::getPriorityScheduler() {
+    return priorityScheduler;
+}
+
 size_t ExecutorManagerImpl::getExecutorsNumber() const {
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
     return executors.size();
@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_hybrid_streams_executor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "ie_common.h"
+#include "ie_parallel.hpp"
+#include "ie_parallel_custom_arena.hpp"
+#include "ie_system_conf.h"
+
+namespace InferenceEngine {
+
+struct HybridStreamsExecutor::Impl {
+    struct Pool {
+        IStreamsExecutor::Ptr executor;
+        Utilization utilization;
+    };
+
+    // marks the thread running a task of a pool for the stream ids, restores the previous marks of the nested tasks
+    struct Running {
+        Running(const std::shared_ptr<Impl>& impl, Pool* pool)
+            : _impl(impl),
+              _pool(pool),
+              _previous(current),
+              _start(std::chrono::steady_clock::now()) {
+            current = {impl.get(), pool};
+        }
+
+        ~Running() {
+            current = _previous;
+            const auto busy =
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start);
+            std::lock_guard<std::mutex> lock(_impl->_mutex);
+            _pool->utilization.running--;
+            _pool->utilization.tasks++;
+            _pool->utilization.busy += busy;
+        }
+
+        std::shared_ptr<Impl> _impl;
+        Pool* _pool;
+        std::pair<const Impl*, Pool*> _previous;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    Pool* currentPool() const {
+        return current.first == this ? current.second : nullptr;
+    }
+
+    static thread_local std::pair<const Impl*, Pool*> current;
+
+    std::mutex _mutex;
+    Pool _big;
+    Pool _little;
+};
+
+thread_local std::pair<const HybridStreamsExecutor::Impl*, HybridStreamsExecutor::Impl::Pool*>
+    HybridStreamsExecutor::Impl::current{nullptr, nullptr};
+
+HybridStreamsExecutor::Topology HybridStreamsExecutor::GetTopology() {
+    Topology topology;
+    topology.bigCores = getNumberOfCPUCores(true);
+    topology.bigLogicalCores = parallel_get_max_threads();
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    const auto core_types = custom::info::core_types();
+    if (core_types.size() > 1) {
+        // the core types are ordered by the performance, the Little cores go first
+        topology.bigLogicalCores =
+            custom::info::default_concurrency(custom::task_arena::constraints{}.set_core_type(core_types.back()));
+        topology.littleCores =
+            custom::info::default_concurrency(custom::task_arena::constraints{}.set_core_type(core_types.front()));
+    }
+#endif
+    return topology;
+}
+
+HybridStreamsExecutor::Pools HybridStreamsExecutor::MakePools(const Config& initial,
+                                                              bool latency,
+                                                              const Topology& topology) {
+    Pools pools{initial, initial};
+    pools.big._name = initial._name + "Big";
+    pools.big._threadBindingType = ThreadBindingType::HYBRID_AWARE;
+    pools.big._threadPreferredCoreType = Config::PreferredCoreType::BIG;
+    pools.little._name = initial._name + "Little";
+    pools.little._threadBindingType = ThreadBindingType::HYBRID_AWARE;
+    pools.little._threadPreferredCoreType = Config::PreferredCoreType::LITTLE;
+    pools.little._streams = 0;
+
+    const int streams = std::max(1, initial._streams);
+    if (latency) {
+        // min #cores, for which the hyper-threading becomes useful for the latency case
+        const int hyper_threading_threshold = 2;
+        const int cores =
+            topology.bigCores <= hyper_threading_threshold ? topology.bigLogicalCores : topology.bigCores;
+        const int threads = initial._threads ? initial._threads : cores;
+        if (threads > 0)
+            pools.big._threadsPerStream = std::max(1, threads / streams);
+        return pools;
+    }
+    if (topology.littleCores == 0)
+        return pools;
+
+    // the streams keep their size, so the Big cores take as many of them as fit and the rest overflow
+    const int threadsPerStream = std::max(1, initial._threadsPerStream);
+    const int bigStreams = std::min(streams, std::max(1, topology.bigCores / threadsPerStream));
+    const int littleStreams = streams - bigStreams;
+    pools.big._streams = bigStreams;
+    pools.little._streams = littleStreams;
+    if (littleStreams != 0)
+        pools.little._threadsPerStream =
+            std::max(1, std::min(threadsPerStream, topology.littleCores / littleStreams));
+    return pools;
+}
+
+HybridStreamsExecutor::HybridStreamsExecutor(const IStreamsExecutor::Ptr& big,
+                                             int bigStreams,
+                                             const IStreamsExecutor::Ptr& little,
+                                             int littleStreams)
+    : _impl{std::make_shared<Impl>()} {
+    if (!big)
+        IE_THROW() << "The executor of the Big cores streams is not set";
+    if (!little && littleStreams != 0)
+        IE_THROW() << "The executor of the Little cores streams is not set";
+    _impl->_big.executor = big;
+    _impl->_big.utilization.streams = std::max(1, bigStreams);
+    _impl->_little.executor = little;
+    _impl->_little.utilization.streams = littleStreams;
+}
+
+HybridStreamsExecutor::~HybridStreamsExecutor() = default;
+
+void HybridStreamsExecutor::run(Task task) {
+    Impl::Pool* pool = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_impl->_mutex);
+        auto& big = _impl->_big.utilization;
+        auto& little = _impl->_little.utilization;
+        // the Little cores take the overflow only, if all their streams are busy too the task waits for the Big ones
+        const bool overflow = big.running >= static_cast<uint64_t>(big.streams) &&
+                              little.running < static_cast<uint64_t>(little.streams);
+        pool = overflow ? &_impl->_little : &_impl->_big;
+        pool->utilization.running++;
+    }
+    auto impl = _impl;
+    pool->executor->run([impl, pool, task] {
+        Impl::Running running{impl, pool};
+        task();
+    });
+}
+
+void HybridStreamsExecutor::Execute(Task task) {
+    auto pool = _impl->currentPool();
+    (pool != nullptr ? pool : &_impl->_big)->executor->Execute(std::move(task));
+}
+
+int HybridStreamsExecutor::GetStreamId() {
+    if (_impl->currentPool() == &_impl->_little)
+        return _impl->_big.utilization.streams + _impl->_little.executor->GetStreamId();
+    return _impl->_big.executor->GetStreamId();
+}
+
+int HybridStreamsExecutor::GetNumaNodeId() {
+    auto pool = _impl->currentPool();
+    return (pool != nullptr ? pool : &_impl->_big)->executor->GetNumaNodeId();
+}
+
+HybridStreamsExecutor::Utilization HybridStreamsExecutor::GetUtilization(Config::PreferredCoreType coreType) const {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    switch (coreType) {
+    case Config::PreferredCoreType::BIG:
+        return _impl->_big.utilization;
+    case Config::PreferredCoreType::LITTLE:
+        return _impl->_little.utilization;
+    default:
+        IE_THROW() << "The utilization is reported for the Big and the Little cores only";
+    }
+}
+
+}  // namespace InferenceEngine
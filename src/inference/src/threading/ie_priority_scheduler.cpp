@@ -0,0 +1,296 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_priority_scheduler.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+struct PriorityScheduler::Tenant {
+    std::string name;
+    int priority;
+    std::chrono::milliseconds slo;
+    ITaskExecutor::Ptr executor;
+    size_t concurrency;
+    bool suspended = false;
+
+    std::deque<Waiting> waiting;
+    Statistics statistics;
+};
+
+struct PriorityScheduler::Timer {
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::chrono::steady_clock::time_point overdue = std::chrono::steady_clock::time_point::max();
+    bool stopping = false;
+};
+
+class PriorityScheduler::ScheduledExecutor : public ITaskExecutor {
+public:
+    ScheduledExecutor(const PriorityScheduler::Ptr& scheduler, const std::shared_ptr<Tenant>& tenant)
+        : _scheduler(scheduler),
+          _tenant(tenant) {}
+
+    void run(Task task) override {
+        _scheduler->submit(_tenant, std::move(task));
+    }
+
+    const std::shared_ptr<Tenant>& tenant() const {
+        return _tenant;
+    }
+
+private:
+    PriorityScheduler::Ptr _scheduler;
+    std::shared_ptr<Tenant> _tenant;
+};
+
+PriorityScheduler::~PriorityScheduler() {
+    if (!_timerThread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(_timer->mutex);
+        _timer->stopping = true;
+    }
+    _timer->wakeUp.notify_all();
+    // the timer thread releases the last reference to the scheduler after dispatching the overdue tasks
+    if (_timerThread.get_id() == std::this_thread::get_id())
+        _timerThread.detach();
+    else
+        _timerThread.join();
+}
+
+ITaskExecutor::Ptr PriorityScheduler::makeExecutor(const std::string& name,
+                                                   int priority,
+                                                   std::chrono::milliseconds slo,
+                                                   const ITaskExecutor::Ptr& executor,
+                                                   size_t concurrency) {
+    if (!executor)
+        IE_THROW() << "The executor to schedule the tasks of " << name << " for is not set";
+
+    auto tenant = std::make_shared<Tenant>();
+    tenant->name = name;
+    tenant->priority = priority;
+    tenant->slo = slo;
+    tenant->executor = executor;
+    tenant->concurrency = std::max<size_t>(concurrency, 1);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tenants.erase(std::remove_if(_tenants.begin(),
+                                  _tenants.end(),
+                                  [](const std::weak_ptr<Tenant>& registered) {
+                                      return registered.expired();
+                                  }),
+                   _tenants.end());
+    _tenants.push_back(tenant);
+    return std::make_shared<ScheduledExecutor>(shared_from_this(), tenant);
+}
+
+void PriorityScheduler::submit(const std::shared_ptr<Tenant>& tenant, Task task) {
+    std::vector<std::pair<std::shared_ptr<Tenant>, Task>> admitted;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        tenant->statistics.submitted++;
+        tenant->waiting.push_back({std::move(task), std::chrono::steady_clock::now()});
+        admit(admitted);
+        // the queue is FIFO, so the task is still waiting if the queue is not empty
+        if (!tenant->waiting.empty())
+            tenant->statistics.deferred++;
+    }
+    dispatch(admitted);
+}
+
+void PriorityScheduler::complete(const std::shared_ptr<Tenant>& tenant) {
+    std::vector<std::pair<std::shared_ptr<Tenant>, Task>> admitted;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        tenant->statistics.running--;
+        if (tenant->statistics.running == 0)
+            _drained.notify_all();
+        admit(admitted);
+    }
+    dispatch(admitted);
+}
+
+void PriorityScheduler::suspend(const ITaskExecutor::Ptr& executor) {
+    auto scheduled = std::dynamic_pointer_cast<ScheduledExecutor>(executor);
+    if (!scheduled)
+        IE_THROW() << "The executor is not created by the scheduler";
+
+    auto tenant = scheduled->tenant();
+    std::vector<std::pair<std::shared_ptr<Tenant>, Task>> admitted;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        tenant->suspended = true;
+        // the waiting tasks of the model may have deferred the lower priority ones
+        admit(admitted);
+        _drained.wait(lock, [&] {
+            return tenant->statistics.running == 0;
+        });
+    }
+    dispatch(admitted);
+}
+
+void PriorityScheduler::resume(const ITaskExecutor::Ptr& executor, const ITaskExecutor::Ptr& target, size_t concurrency) {
+    auto scheduled = std::dynamic_pointer_cast<ScheduledExecutor>(executor);
+    if (!scheduled)
+        IE_THROW() << "The executor is not created by the scheduler";
+    if (!target)
+        IE_THROW() << "The executor to schedule the tasks of " << scheduled->tenant()->name << " for is not set";
+
+    auto tenant = scheduled->tenant();
+    std::vector<std::pair<std::shared_ptr<Tenant>, Task>> admitted;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        tenant->suspended = false;
+        tenant->executor = target;
+        tenant->concurrency = std::max<size_t>(concurrency, 1);
+        admit(admitted);
+    }
+    dispatch(admitted);
+}
+
+void PriorityScheduler::admit(std::vector<std::pair<std::shared_ptr<Tenant>, Task>>& admitted) {
+    std::vector<std::shared_ptr<Tenant>> tenants;
+    for (const auto& registered : _tenants) {
+        if (auto tenant = registered.lock())
+            tenants.push_back(tenant);
+    }
+    std::stable_sort(tenants.begin(),
+                     tenants.end(),
+                     [](const std::shared_ptr<Tenant>& lhs, const std::shared_ptr<Tenant>& rhs) {
+                         return lhs->priority > rhs->priority;
+                     });
+
+    // the models of a higher priority than the current one have tasks running or waiting
+    bool higherBusy = false;
+    auto nextOverdue = std::chrono::steady_clock::time_point::max();
+    bool levelBusy = false;
+    const auto now = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < tenants.size(); i++) {
+        auto& tenant = *tenants[i];
+        if (i != 0 && tenant.priority != tenants[i - 1]->priority) {
+            higherBusy |= levelBusy;
+            levelBusy = false;
+        }
+
+        while (!tenant.suspended && !tenant.waiting.empty() && tenant.statistics.running < tenant.concurrency) {
+            auto& front = tenant.waiting.front();
+            const auto queueing = std::chrono::duration_cast<std::chrono::microseconds>(now - front.submitted);
+            const bool overdue = tenant.slo.count() != 0 && queueing >= tenant.slo;
+            if (higherBusy && !overdue) {
+                if (tenant.slo.count() != 0)
+                    nextOverdue = std::min(nextOverdue, front.submitted + tenant.slo);
+                break;
+            }
+
+            if (higherBusy)
+                tenant.statistics.overdue++;
+            tenant.statistics.totalQueueing += queueing;
+            tenant.statistics.maxQueueing = std::max(tenant.statistics.maxQueueing, queueing);
+            tenant.statistics.running++;
+            admitted.emplace_back(tenants[i], std::move(front.task));
+            tenant.waiting.pop_front();
+        }
+        levelBusy |= tenant.statistics.running != 0 || (!tenant.suspended && !tenant.waiting.empty());
+    }
+    setTimer(nextOverdue);
+}
+
+void PriorityScheduler::setTimer(std::chrono::steady_clock::time_point overdue) {
+    if (!_timer) {
+        if (overdue == std::chrono::steady_clock::time_point::max())
+            return;
+        _timer = std::make_shared<Timer>();
+        auto timer = _timer;
+        std::weak_ptr<PriorityScheduler> weakScheduler = shared_from_this();
+        _timerThread = std::thread([timer, weakScheduler] {
+            std::unique_lock<std::mutex> lock(timer->mutex);
+            while (!timer->stopping) {
+                if (timer->overdue == std::chrono::steady_clock::time_point::max()) {
+                    timer->wakeUp.wait(lock);
+                    continue;
+                }
+                if (std::chrono::steady_clock::now() < timer->overdue) {
+                    timer->wakeUp.wait_until(lock, timer->overdue);
+                    continue;
+                }
+                timer->overdue = std::chrono::steady_clock::time_point::max();
+                lock.unlock();
+                if (auto scheduler = weakScheduler.lock())
+                    scheduler->recheck();
+                lock.lock();
+            }
+        });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_timer->mutex);
+        if (_timer->overdue == overdue)
+            return;
+        _timer->overdue = overdue;
+    }
+    _timer->wakeUp.notify_all();
+}
+
+void PriorityScheduler::recheck() {
+    std::vector<std::pair<std::shared_ptr<Tenant>, Task>> admitted;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        admit(admitted);
+    }
+    dispatch(admitted);
+}
+
+void PriorityScheduler::dispatch(std::vector<std::pair<std::shared_ptr<Tenant>, Task>>& admitted) {
+    auto self = shared_from_this();
+    // the executor of a model is replaced only when no task of the model is admitted
+    for (auto& item : admitted) {
+        auto tenant = item.first;
+        auto task = std::move(item.second);
+        tenant->executor->run([self, tenant, task] {
+            try {
+                task();
+            } catch (...) {
+                self->complete(tenant);
+                throw;
+            }
+            self->complete(tenant);
+        });
+    }
+}
+
+std::map<std::string, PriorityScheduler::Statistics> PriorityScheduler::getStatistics() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::map<std::string, Statistics> statistics;
+    for (const auto& registered : _tenants) {
+        if (auto tenant = registered.lock()) {
+            auto& item = statistics[tenant->name];
+            item = tenant->statistics;
+            item.queued = tenant->waiting.size();
+        }
+    }
+    return statistics;
+}
+
+PriorityScheduler::Statistics PriorityScheduler::getStatistics(const ITaskExecutor::Ptr& executor) const {
+    auto scheduled = std::dynamic_pointer_cast<ScheduledExecutor>(executor);
+    if (!scheduled)
+        IE_THROW() << "The executor is not created by the scheduler";
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto statistics = scheduled->tenant()->statistics;
+    statistics.queued = scheduled->tenant()->waiting.size();
+    return statistics;
+}
+
+}  // namespace InferenceEngine
@@ -38,6 +38,8 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
     _pipeline = {
         // if the request is coming with device-specific remote blobs make sure it is scheduled to the specific device only:
         { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+                // the expired inference is not scheduled
+                _inferRequest->ThrowIfDeadlinePassed();
                 // by default, no preferred device:
                 _multiDeviceExecutableNetwork->_thisPreferredDeviceName = "";
                 // if any input is remote (e.g. was set with SetBlob), let' use the corresponding device
@@ -71,6 +73,17 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
          /*TaskExecutor*/ _multiDeviceExecutableNetwork, /*task*/ [this] {
                _workerInferRequest = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
                _inferRequest->SetBlobsToAnotherRequest(_workerInferRequest->_inferRequest);
+               // the worker is shared by the requests, so the deadline of the previous one is replaced
+               const auto& deadline = _inferRequest->GetDeadline();
+               const bool hasDeadline = deadline != std::chrono::steady_clock::time_point::max();
+               if (hasDeadline || _workerInferRequest->_hasDeadline) {
+                   try {
+                       _workerInferRequest->_inferRequest->SetDeadline(deadline);
+                       _workerInferRequest->_hasDeadline = hasDeadline;
+                   } catch (const NotImplemented&) {
+                       // the device runs the inference to the end
+                   }
+               }
         }},
         // final task in the pipeline:
         { /*TaskExecutor*/std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
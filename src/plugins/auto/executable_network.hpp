@@ -87,6 +87,8 @@ public:
         std::exception_ptr                        _exceptionPtr = nullptr;
         unsigned int                              _inferCount = 0;
         int                                       _index = 0;
+        // the deadline of an inference run by the worker is still set
+        bool                                      _hasDeadline = false;
     };
     using NotBusyWorkerRequests = InferenceEngine::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
 
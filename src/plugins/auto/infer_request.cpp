@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "infer_request.hpp"
+#include <algorithm>
 #include <ie_input_info.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <blob_factory.hpp>
@@ -33,6 +34,7 @@ MultiDeviceInferRequest::MultiDeviceInferRequest(const InputsDataMap&   networkI
 void MultiDeviceInferRequest::CreateInferRequest(const InferenceEngine::SoIInferRequestInternal& request_to_share_blobs_with,
             InferenceEngine::RemoteContext::Ptr ctx) {
     if (request_to_share_blobs_with) {
+        _sharedRequest = request_to_share_blobs_with;
         // borrow device-friendly blobs from the request
         for (const auto &it : _networkInputs)
             _inputs[it.first] = request_to_share_blobs_with->GetBlob(it.first);
@@ -84,6 +86,37 @@ void MultiDeviceInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInte
         if (req->GetBlob(name) != blob)
             req->SetBlob(name, blob);
     }
+    for (const auto &name : _readyInputs)
+        req->SetInputReady(name);
+    _readyInputs.clear();
+}
+
+void MultiDeviceInferRequest::SetDeadline(const std::chrono::steady_clock::time_point& deadline) {
+    _deadline = deadline;
+}
+
+void MultiDeviceInferRequest::ThrowIfDeadlinePassed() const {
+    if (_deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= _deadline)
+        IE_THROW(InferCancelled) << "The deadline of the inference has passed";
+}
+
+void MultiDeviceInferRequest::ReleaseBlobs() {
+    // the borrowed blobs are pooled by the device request they are borrowed from
+    if (!_sharedRequest)
+        return;
+    try {
+        _sharedRequest->ReleaseBlobs();
+    } catch (const RequestBusy&) {
+        // the device request runs the inference of another request, its blobs are in use
+    }
+}
+
+void MultiDeviceInferRequest::SetInputReady(const std::string& name) {
+    if (_networkInputs.find(name) == _networkInputs.end())
+        IE_THROW(NotFound) << "Failed to find input with name: \'" << name << "\'";
+    // the device request is known when the inference is scheduled
+    if (std::find(_readyInputs.begin(), _readyInputs.end(), name) == _readyInputs.end())
+        _readyInputs.push_back(name);
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MultiDeviceInferRequest::GetPerformanceCounts() const {
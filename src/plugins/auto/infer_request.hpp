@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -39,12 +40,24 @@ public:
                                      InferenceEngine::RemoteContext::Ptr ctx = nullptr);
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
     void InferImpl() override;
-    // Multi-Device impl specific: sets the data (blobs from the device-less requests to the specific device request)
+    void SetDeadline(const std::chrono::steady_clock::time_point& deadline) override;
+    void ReleaseBlobs() override;
+    void SetInputReady(const std::string& name) override;
+    // Multi-Device impl specific: sets the data (blobs from the device-less requests to the specific device request),
+    // the inputs marked ready are marked in the device request too
     void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+    // Multi-Device impl specific: the deadline is passed to the device request the inference is scheduled to,
+    // it is checked before the scheduling too, so the devices not supporting it do not run the expired inferences
+    const std::chrono::steady_clock::time_point& GetDeadline() const { return _deadline; }
+    void ThrowIfDeadlinePassed() const;
 
 private:
     void CreateInferRequest(const InferenceEngine::SoIInferRequestInternal& request_to_share_blobs_with,
                             InferenceEngine::RemoteContext::Ptr ctx);
+
+    InferenceEngine::SoIInferRequestInternal _sharedRequest;
+    std::chrono::steady_clock::time_point _deadline = std::chrono::steady_clock::time_point::max();
+    std::vector<std::string> _readyInputs;
 };
 
 }  // namespace MultiDevicePlugin
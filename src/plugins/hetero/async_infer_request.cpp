@@ -36,10 +36,14 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
 
         auto requestExecutor =
             std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
-        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
+        const bool lastRequest = requestId + 1 == _heteroInferRequest->_inferRequests.size();
+        _pipeline.emplace_back(requestExecutor, [this, requestExecutor, lastRequest] {
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
             }
+            // the next subgraph is not started after the deadline
+            if (!lastRequest)
+                _heteroInferRequest->ThrowIfDeadlinePassed();
         });
     }
 }
@@ -122,10 +122,41 @@ void HeteroInferRequest::InferImpl() {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
         assert(r);
+        ThrowIfDeadlinePassed();
         r->Infer();
     }
 }
 
+void HeteroInferRequest::SetDeadline(const std::chrono::steady_clock::time_point& deadline) {
+    for (auto&& desc : _inferRequests) {
+        try {
+            desc._request->SetDeadline(deadline);
+        } catch (const InferenceEngine::NotImplemented&) {
+            // the subgraph of the device is not aborted, the deadline is still checked before it starts
+        }
+    }
+    _deadline = deadline;
+}
+
+void HeteroInferRequest::ThrowIfDeadlinePassed() const {
+    if (_deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= _deadline)
+        IE_THROW(InferCancelled) << "The deadline of the inference has passed";
+}
+
+void HeteroInferRequest::ReleaseBlobs() {
+    for (auto&& desc : _inferRequests) {
+        desc._request->ReleaseBlobs();
+    }
+}
+
+void HeteroInferRequest::SetInputReady(const std::string& name) {
+    auto itRequest = _subRequestFromBlobName.find(name);
+    if (itRequest == _subRequestFromBlobName.end() || !InferenceEngine::details::contains(_networkInputs, name)) {
+        IE_THROW(NotFound) << "There is no infer requests binded to input blob with name: " << name;
+    }
+    itRequest->second->SetInputReady(name);
+}
+
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
@@ -7,6 +7,7 @@
 #include <ie_common.h>
 
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+#include <chrono>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <map>
 #include <memory>
@@ -52,12 +53,23 @@ public:
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
+    void SetDeadline(const std::chrono::steady_clock::time_point& deadline) override;
+
+    void ReleaseBlobs() override;
+
+    void SetInputReady(const std::string& name) override;
+
+    // the deadline is checked between the subgraphs, the devices not supporting it run their subgraphs to the end
+    void ThrowIfDeadlinePassed() const;
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
     std::map<std::string, InferenceEngine::IInferRequestInternal*> _subRequestFromBlobName;
 
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+
+    std::chrono::steady_clock::time_point _deadline = std::chrono::steady_clock::time_point::max();
 };
 
 }  // namespace HeteroPlugin
@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_pool.h"
+
+#include <common/utils.hpp>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+const int bufferAlignment = 64;
+
+class PoolAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit PoolAllocator(std::shared_ptr<BlobPool::Storage> storage) : storage(std::move(storage)) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return storage->lease(size);
+    }
+
+    bool free(void* handle) noexcept override {
+        storage->giveBack(handle);
+        return true;
+    }
+
+private:
+    std::shared_ptr<BlobPool::Storage> storage;
+};
+
+}  // namespace
+
+BlobPool::BlobPool() : storage(std::make_shared<Storage>()), allocator(std::make_shared<PoolAllocator>(storage)) {}
+
+size_t BlobPool::leasedBytes() const {
+    return storage->leasedBytes();
+}
+
+size_t BlobPool::pooledBytes() const {
+    return storage->pooledBytes();
+}
+
+BlobPool::Storage::~Storage() {
+    for (const auto& buffer : freeBuffers)
+        dnnl::impl::free(buffer.second);
+}
+
+void* BlobPool::Storage::lease(size_t size) {
+    std::lock_guard<std::mutex> lock(guard);
+
+    void* handle = nullptr;
+    size_t capacity = size;
+    // the smallest free buffer fitting the blob, a much larger one is left for the larger blobs
+    auto found = freeBuffers.lower_bound(size);
+    if (found != freeBuffers.end() && found->first <= 2 * size) {
+        capacity = found->first;
+        handle = found->second;
+        freeBuffers.erase(found);
+        pooledTotal -= capacity;
+    } else {
+        handle = dnnl::impl::malloc(size, bufferAlignment);
+        if (!handle)
+            return nullptr;
+    }
+
+    leased[handle] = capacity;
+    leasedTotal += capacity;
+    return handle;
+}
+
+void BlobPool::Storage::giveBack(void* handle) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = leased.find(handle);
+    if (found == leased.end())
+        return;
+
+    freeBuffers.emplace(found->second, handle);
+    pooledTotal += found->second;
+    leasedTotal -= found->second;
+    leased.erase(found);
+}
+
+size_t BlobPool::Storage::leasedBytes() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return leasedTotal;
+}
+
+size_t BlobPool::Storage::pooledBytes() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return pooledTotal;
+}
+
+}  // namespace MKLDNNPlugin
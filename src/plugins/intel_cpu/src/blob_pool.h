@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <ie_allocator.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Memory of the input and output blobs shared by the infer requests of a network.
+ * The blobs allocated by the allocator of the pool lease a buffer from the pool and return it when the blob
+ * is destroyed, so the memory of the blobs scales with the number of the requests holding them, not with the
+ * number of the created requests. A buffer is reused for a blob of the same size or up to twice smaller.
+ */
+class BlobPool {
+public:
+    BlobPool();
+
+    std::shared_ptr<InferenceEngine::IAllocator> getAllocator() const {
+        return allocator;
+    }
+
+    // bytes of the buffers leased by the blobs and kept in the pool
+    size_t leasedBytes() const;
+    size_t pooledBytes() const;
+
+    class Storage;
+
+private:
+    std::shared_ptr<Storage> storage;
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
+};
+
+// the buffers of the pool, kept alive by the allocator until the last blob of the pool is destroyed
+class BlobPool::Storage {
+public:
+    ~Storage();
+
+    void* lease(size_t size);
+    void giveBack(void* handle);
+
+    size_t leasedBytes() const;
+    size_t pooledBytes() const;
+
+private:
+    mutable std::mutex guard;
+    // the free buffers by the size
+    std::multimap<size_t, void*> freeBuffers;
+    // the sizes of the leased buffers
+    std::unordered_map<void*, size_t> leased;
+    size_t leasedTotal = 0;
+    size_t pooledTotal = 0;
+};
+
+}  // namespace MKLDNNPlugin
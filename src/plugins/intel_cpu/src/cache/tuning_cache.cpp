@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tuning_cache.h"
+
+#include <fstream>
+#include <map>
+
+#include "ie_common.h"
+
+namespace MKLDNNPlugin {
+
+std::shared_ptr<TuningCache> TuningCache::get(const std::string& path) {
+    static std::mutex cachesMutex;
+    static std::map<std::string, std::weak_ptr<TuningCache>> caches;
+
+    std::lock_guard<std::mutex> lock(cachesMutex);
+    auto cache = caches[path].lock();
+    if (!cache) {
+        cache = std::make_shared<TuningCache>(path);
+        caches[path] = cache;
+    }
+    return cache;
+}
+
+TuningCache::TuningCache(const std::string& path) : _path(path) {
+    if (_path.empty())
+        return;
+
+    // the file doesn't exist before the first tuning
+    std::ifstream file(_path);
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto pos = line.find('\t');
+        if (pos == std::string::npos)
+            continue;
+        // the later record wins, so the file may be appended without rewriting
+        _records[line.substr(0, pos)] = line.substr(pos + 1);
+    }
+}
+
+bool TuningCache::find(const std::string& key, std::string& value) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _records.find(key);
+    if (it == _records.end())
+        return false;
+    value = it->second;
+    return true;
+}
+
+void TuningCache::put(const std::string& key, const std::string& value) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _records[key] = value;
+    if (_path.empty())
+        return;
+
+    std::ofstream file(_path, std::ios::out | std::ios::app);
+    if (!file.is_open())
+        IE_THROW() << "Cannot open tuning cache file " << _path;
+    file << key << '\t' << value << '\n';
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Persistent storage of the primitive tuning results.
+ *
+ * The results are kept in a text file, one "key<TAB>value" record per line, so they can be reused by the
+ * next compilations. New records are appended to the file right away. The file is read once per process,
+ * all the graphs tuned with the same file share one instance obtained by get().
+ * An empty path means the results are kept in memory only.
+ *
+ * @attention This implementation IS THREAD SAFE
+ */
+class TuningCache {
+public:
+    static std::shared_ptr<TuningCache> get(const std::string& path);
+
+    explicit TuningCache(const std::string& path);
+
+    bool find(const std::string& key, std::string& value) const;
+    void put(const std::string& key, const std::string& value);
+
+    /**
+     * @brief Measurements of different graphs are serialized to not disturb each other.
+     * A graph waiting for the lock should check the cache again, since the measurement may have been done meanwhile.
+     */
+    std::mutex& measurementMutex() {
+        return _measurementMutex;
+    }
+
+private:
+    std::string _path;
+    mutable std::mutex _mutex;
+    std::mutex _measurementMutex;
+    std::unordered_map<std::string, std::string> _records;
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,6 +7,9 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
@@ -16,11 +19,55 @@
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/util/common_util.hpp"
 
 namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+// parses the buckets of the input shapes like "ids[1,32],mask[1,32];ids[1,64],mask[1,64]"
+static std::vector<std::map<std::string, SizeVector>> parseShapeBuckets(const std::string& val) {
+    auto error = [&] {
+        IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPE_BUCKETS
+                   << ". Expected only the buckets of the input shapes like input[1,32],other[1,32];input[1,64],other[1,64]";
+    };
+    std::vector<std::map<std::string, SizeVector>> buckets;
+    std::stringstream bucketsStream(val);
+    std::string bucket;
+    while (std::getline(bucketsStream, bucket, ';')) {
+        std::map<std::string, SizeVector> shapes;
+        size_t pos = 0;
+        while (pos < bucket.size()) {
+            const auto open = bucket.find('[', pos);
+            const auto close = bucket.find(']', pos);
+            if (open == std::string::npos || close == std::string::npos || close < open || open == pos)
+                error();
+            const auto name = bucket.substr(pos, open - pos);
+            SizeVector dims;
+            std::stringstream dimsStream(bucket.substr(open + 1, close - open - 1));
+            std::string dim;
+            while (std::getline(dimsStream, dim, ',')) {
+                if (dim.empty() || dim.find_first_not_of("0123456789") != std::string::npos)
+                    error();
+                try {
+                    dims.push_back(std::stoul(dim));
+                } catch (const std::out_of_range&) {
+                    error();
+                }
+            }
+            if (!shapes.emplace(name, dims).second)
+                error();
+            pos = close + 1;
+            if (pos < bucket.size() && bucket[pos++] != ',')
+                error();
+        }
+        if (shapes.empty())
+            error();
+        buckets.push_back(shapes);
+    }
+    return buckets;
+}
+
 Config::Config() {
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
@@ -146,6 +193,109 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS == key) {
+            if (val == PluginConfigParams::YES) collectHwCounters = true;
+            else if (val == PluginConfigParams::NO) collectHwCounters = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HW_PERF_COUNTERS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PERF_TRACE_FILE == key) {
+            // empty string means that the trace is switched off
+            perfTraceFile = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT == key) {
+            if (val == PluginConfigParams::YES) globalLayoutAssignment = true;
+            else if (val == PluginConfigParams::NO) globalLayoutAssignment = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_ASSIGNMENT
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PRIMITIVE_TUNING == key) {
+            if (val == PluginConfigParams::YES) primitiveTuning = true;
+            else if (val == PluginConfigParams::NO) primitiveTuning = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PRIMITIVE_TUNING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_TUNING_CACHE_FILE == key) {
+            // empty string means that the tuning results are not persisted
+            tuningCacheFile = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_TUNING_CANDIDATES == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_TUNING_CANDIDATES
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 1)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_TUNING_CANDIDATES
+                           << ". Expected only positive numbers";
+            tuningCandidates = static_cast<size_t>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::NO) hugePages = HugePagesMode::Disabled;
+            else if (val == PluginConfigInternalParams::TRANSPARENT) hugePages = HugePagesMode::Transparent;
+            else if (val == PluginConfigInternalParams::EXPLICIT) hugePages = HugePagesMode::Explicit;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                           << ". Expected only NO/TRANSPARENT/EXPLICIT";
+        } else if (PluginConfigInternalParams::KEY_CPU_POOLED_REQUEST_BLOBS == key) {
+            if (val == PluginConfigParams::YES) pooledRequestBlobs = true;
+            else if (val == PluginConfigParams::NO) pooledRequestBlobs = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_POOLED_REQUEST_BLOBS
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_MODEL_PRIORITY || key == ov::hint::model_priority) {
+            if (val == PluginConfigParams::MODEL_PRIORITY_HIGH || val == ov::util::to_string(ov::hint::Priority::HIGH))
+                modelPriority = 2;
+            else if (val == PluginConfigParams::MODEL_PRIORITY_MED || val == ov::util::to_string(ov::hint::Priority::MEDIUM))
+                modelPriority = 1;
+            else if (val == PluginConfigParams::MODEL_PRIORITY_LOW || val == ov::util::to_string(ov::hint::Priority::LOW))
+                modelPriority = 0;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_MODEL_PRIORITY
+                           << ". Expected only LOW/MEDIUM/HIGH";
+        } else if (PluginConfigInternalParams::KEY_CPU_SCHEDULING_SLO == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SCHEDULING_SLO
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SCHEDULING_SLO
+                           << ". Expected only non-negative numbers";
+            schedulingSlo = val_i;
+        } else if (PluginConfigInternalParams::KEY_CPU_MICRO_BATCH == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MICRO_BATCH
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MICRO_BATCH
+                           << ". Expected only non-negative numbers";
+            microBatch = val_i;
+        } else if (PluginConfigInternalParams::KEY_CPU_SHAPE_BUCKETS == key) {
+            shapeBuckets = parseShapeBuckets(val);
+        } else if (PluginConfigInternalParams::KEY_CPU_GRAPH_REPLAY == key) {
+            if (val == PluginConfigParams::YES) graphReplay = true;
+            else if (val == PluginConfigParams::NO) graphReplay = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_GRAPH_REPLAY
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_PREFETCH == key) {
+            if (val == PluginConfigParams::YES) weightsPrefetch = true;
+            else if (val == PluginConfigParams::NO) weightsPrefetch = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_PREFETCH
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_NUMA_MEMORY_BINDING == key) {
+            if (val == PluginConfigParams::YES) numaMemoryBinding = true;
+            else if (val == PluginConfigParams::NO) numaMemoryBinding = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_NUMA_MEMORY_BINDING
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -157,6 +307,10 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
     if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
         streamExecutorConfig._streams = 1;
 
+    // hardware counters and the trace are collected per node along with the regular perf counters
+    if (collectHwCounters || !perfTraceFile.empty())
+        collectPerfCounters = true;
+
     CPU_DEBUG_CAP_ENABLE(readDebugCapsProperties());
     updateProperties();
 }
@@ -210,6 +364,18 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+
+    switch (modelPriority) {
+    case 0:
+        _config.insert({ PluginConfigParams::KEY_MODEL_PRIORITY, PluginConfigParams::MODEL_PRIORITY_LOW });
+        break;
+    case 2:
+        _config.insert({ PluginConfigParams::KEY_MODEL_PRIORITY, PluginConfigParams::MODEL_PRIORITY_HIGH });
+        break;
+    default:
+        _config.insert({ PluginConfigParams::KEY_MODEL_PRIORITY, PluginConfigParams::MODEL_PRIORITY_MED });
+        break;
+    }
 }
 
 #ifdef CPU_DEBUG_CAPS
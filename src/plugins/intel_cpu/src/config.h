@@ -7,9 +7,11 @@
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
 #include "utils/debug_capabilities.h"
+#include "utils/huge_pages.h"
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -22,6 +24,23 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectHwCounters = false;
+    std::string perfTraceFile;
+    bool globalLayoutAssignment = false;
+    bool primitiveTuning = false;
+    std::string tuningCacheFile;
+    size_t tuningCandidates = 3ul;
+    bool numaMemoryBinding = true;
+    HugePagesMode hugePages = HugePagesMode::Disabled;
+    bool pooledRequestBlobs = false;
+    // the greater value the higher priority, MEDIUM by default
+    int modelPriority = 1;
+    int schedulingSlo = 0;  // ms, zero means that the starvation is not bounded
+    int microBatch = 0;  // zero means that the batch is not split
+    // the input shapes by the input names, a static graph is compiled for each bucket
+    std::vector<std::map<std::string, InferenceEngine::SizeVector>> shapeBuckets;
+    bool graphReplay = false;
+    bool weightsPrefetch = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
@@ -104,6 +104,7 @@ enum Type {
     Subgraph,
     PriorBox,
     PriorBoxClustered,
+    ScaledDotProductAttention,
 };
 
 enum Algorithm {
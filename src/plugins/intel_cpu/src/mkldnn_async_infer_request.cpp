@@ -15,3 +15,7 @@ MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEn
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::SetInferExecutor(const InferenceEngine::ITaskExecutor::Ptr& inferExecutor) {
+    _pipeline.front().first = inferExecutor;
+}
@@ -17,6 +17,9 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+    // replaces the executor the inference stage of the asynchronous pipeline is run by
+    void SetInferExecutor(const InferenceEngine::ITaskExecutor::Ptr& inferExecutor);
 };
 
 }  // namespace MKLDNNPlugin
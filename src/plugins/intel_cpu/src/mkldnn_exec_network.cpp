@@ -13,21 +13,25 @@
 #include "mkldnn_serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "utils/numa_memory.h"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 #include <threading/ie_tbb_streams_executor.hpp>
 #endif
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_hybrid_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -77,10 +81,13 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
     }
-    bool isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
+    _isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
     _cfg.isNewApi = !isLegacyAPI();
 
+    if (_cfg.pooledRequestBlobs)
+        _blobPool.reset(new BlobPool());
+
     // WA for inference dynamic batch cases in new API
     if (_cfg.isNewApi) {
         int64_t maxBatchSize = -1;
@@ -95,17 +102,36 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    // the networks of the legacy API are static or reshaped for the dynamic batch, so there is no dynamic graph
+    if (!_cfg.isNewApi && !_cfg.shapeBuckets.empty())
+        IE_THROW() << "The shape buckets are supported by the networks of the OpenVINO 2.0 API only";
+    // the legacy dynamic batch compiles the static graphs of the upper bound already
+    if (_cfg.batchLimit == 0) {
+        for (const auto& bucket : _cfg.shapeBuckets) {
+            for (const auto& shape : bucket) {
+                const auto& parameters = function->get_parameters();
+                const auto parameter = std::find_if(parameters.begin(), parameters.end(),
+                                                    [&](const std::shared_ptr<ngraph::op::v0::Parameter>& in) {
+                                                        return in->get_friendly_name() == shape.first;
+                                                    });
+                if (parameter == parameters.end())
+                    IE_THROW() << "The shape bucket refers to the input " << shape.first << " not found in the network";
+                if (!(*parameter)->get_partial_shape().compatible(ov::PartialShape(ov::Shape(shape.second))))
+                    IE_THROW() << "The shape bucket of the input " << shape.first << " does not fit its shape "
+                               << (*parameter)->get_partial_shape();
+            }
+            _shapeBuckets.emplace_back();
+            _shapeBuckets.back().shapes = bucket;
+        }
+    }
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
     } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
-        streamsExecutorConfig._name = "CPUStreamsExecutor";
-#if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-        _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
-#else
-        _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
-#endif
+        // the requests keep the switch, so they run on the new streams after the reconfiguration
+        _streamsSwitch = std::make_shared<StreamsExecutorSwitch>(makeStreamsExecutor());
+        _taskExecutor = _streamsSwitch;
     }
     if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -118,24 +144,31 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    _scheduledExecutor = _plugin->executorManager()->getPriorityScheduler()->makeExecutor(
+        _name, _cfg.modelPriority, std::chrono::milliseconds(_cfg.schedulingSlo), _taskExecutor,
+        std::max(1, _cfg.streamExecutorConfig._streams));
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    _activeGraphs = _graphs.size();
+    // the graphs of the shape buckets are compiled upfront too, so the first inferences of the buckets do not wait
+    auto makeGraphs = [this] {
+        MKLDNNExecNetwork::GetGraph();
+        for (size_t i = 0; i < _shapeBuckets.size(); i++)
+            MKLDNNExecNetwork::GetGraph(static_cast<int>(i));
+    };
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
-            };
+            task = makeGraphs;
         }
         _taskExecutor->runAndWait(tasks);
     } else {
-        MKLDNNExecNetwork::GetGraph();
+        makeGraphs();
     }
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
+    // Save all MemoryLayer data tensors. The states are detached from the graph,
+    // each infer request has its own ones.
     if (_graphs.size() == 1) {
         for (auto &node : GetGraph()._graph.GetNodes()) {
             if (node->getType() == MemoryInput) {
@@ -143,54 +176,156 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (!memoryNode) {
                     IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
                 }
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(memoryNode->getVariableName(), memoryNode->createState(),
+                                                                  memoryNode->getStatePrecision(), memoryNode->getOutputShapeAtPort(0)));
             }
         }
     }
 }
 
-MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
+InferenceEngine::IStreamsExecutor::Ptr MKLDNNExecNetwork::makeStreamsExecutor() const {
+    auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, _isFloatModel);
+    streamsExecutorConfig._name = "CPUStreamsExecutor";
+#if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    return std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
+#else
+    // on the hybrid CPUs the latency hint streams are placed on the Big cores only,
+    // and the throughput streams overflow from the Big cores to the Little ones
+    const bool latencyHint = _cfg.perfHintsConfig.ovPerfHint == CONFIG_VALUE(LATENCY);
+    const bool throughput = streamsExecutorConfig._threadPreferredCoreType == IStreamsExecutor::Config::ROUND_ROBIN;
+    if (streamsExecutorConfig._threadBindingType == IStreamsExecutor::ThreadBindingType::HYBRID_AWARE &&
+        streamsExecutorConfig._streams != 0 && (latencyHint || throughput)) {
+        const auto topology = HybridStreamsExecutor::GetTopology();
+        if (topology.littleCores != 0) {
+            const auto pools = HybridStreamsExecutor::MakePools(streamsExecutorConfig, latencyHint, topology);
+            auto big = _plugin->executorManager()->getIdleCPUStreamsExecutor(pools.big);
+            auto little = pools.little._streams != 0 ? _plugin->executorManager()->getIdleCPUStreamsExecutor(pools.little)
+                                                     : nullptr;
+            return std::make_shared<HybridStreamsExecutor>(big, pools.big._streams, little, pools.little._streams);
+        }
+    }
+    return _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+#endif
+}
+
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(int shapeBucket) const {
     int streamId = 0;
     int numaNodeId = 0;
+    // the switch reports the stream of the executor running the task, the previous one if the task was submitted
+    // before the reconfiguration
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
-    if (!graphLock._graph.IsReady()) {
-        std::exception_ptr exception;
-        auto makeGraph = [&] {
-            try {
-                {
-                    std::lock_guard<std::mutex> lock{_cfgMutex};
-                    graphLock._graph.setConfig(_cfg);
-                }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
-            } catch(...) {
-                exception = std::current_exception();
-            }
-        };
-        if (nullptr != streamsExecutor) {
-            streamsExecutor->Execute(makeGraph);
+    Graph* graph = nullptr;
+    size_t stream = 0;
+    {
+        std::lock_guard<std::mutex> lock{_streamsMutex};
+        stream = streamId % _activeGraphs;
+        if (shapeBucket < 0) {
+            graph = &_graphs[stream];
         } else {
-            makeGraph();
-        }
-        if (exception) {
-            std::rethrow_exception(exception);
+            // the graphs of the buckets follow the streams, as the ones of the dynamic shapes
+            auto& graphs = _shapeBuckets[shapeBucket].graphs;
+            if (graphs.size() < _activeGraphs)
+                graphs.resize(_activeGraphs);
+            graph = &graphs[stream];
         }
     }
+    auto graphLock = Graph::Lock(*graph);
+    initGraph(graphLock, streamsExecutor, numaNodeId, shapeBucket, static_cast<int>(stream));
     return graphLock;
 }
 
+int MKLDNNExecNetwork::findShapeBucket(const InferenceEngine::BlobMap& inputs) const {
+    for (size_t i = 0; i < _shapeBuckets.size(); i++) {
+        const auto& shapes = _shapeBuckets[i].shapes;
+        const bool matches = std::all_of(shapes.begin(), shapes.end(),
+                                         [&](const std::pair<const std::string, InferenceEngine::SizeVector>& shape) {
+                                             const auto input = inputs.find(shape.first);
+                                             return input != inputs.end() && input->second &&
+                                                    input->second->getTensorDesc().getDims() == shape.second;
+                                         });
+        if (matches)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+std::vector<MKLDNNExecNetwork::Graph::Lock> MKLDNNExecNetwork::GetMicroBatchGraphs(size_t count) const {
+    int numaNodeId = 0;
+    std::vector<Graph*> graphs;
+    {
+        std::lock_guard<std::mutex> lock{_streamsMutex};
+        // the replicas follow the ones of the streams, so they are locked after the graph of the stream
+        // in the order of the indices, as by the other requests, and the locks do not deadlock
+        if (_graphs.size() < _activeGraphs + count)
+            _graphs.resize(_activeGraphs + count);
+        for (size_t i = 0; i < count; i++)
+            graphs.push_back(&_graphs[_activeGraphs + i]);
+    }
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamsExecutor)
+        numaNodeId = streamsExecutor->GetNumaNodeId();
+
+    std::vector<Graph::Lock> graphLocks;
+    graphLocks.reserve(count);
+    for (auto graph : graphs) {
+        graphLocks.emplace_back(*graph);
+        initGraph(graphLocks.back(), streamsExecutor, numaNodeId);
+    }
+    return graphLocks;
+}
+
+std::shared_ptr<WeightsPrefetcher> MKLDNNExecNetwork::getWeightsPrefetcher(size_t stream) const {
+    std::lock_guard<std::mutex> lock{_streamsMutex};
+    if (_weightsPrefetchers.size() <= stream)
+        _weightsPrefetchers.resize(stream + 1);
+    auto& prefetcher = _weightsPrefetchers[stream];
+    if (!prefetcher)
+        prefetcher = std::make_shared<WeightsPrefetcher>(WeightsPrefetcher::defaultBudget());
+    return prefetcher;
+}
+
+void MKLDNNExecNetwork::initGraph(Graph::Lock& graphLock,
+                                  InferenceEngine::IStreamsExecutor* streamsExecutor,
+                                  int numaNodeId,
+                                  int shapeBucket,
+                                  int stream) const {
+    if (graphLock._graph.IsReady())
+        return;
+    std::exception_ptr exception;
+    auto makeGraph = [&] {
+        try {
+            bool numaMemoryBinding;
+            bool weightsPrefetch;
+            {
+                std::lock_guard<std::mutex> lock{_cfgMutex};
+                graphLock._graph.setConfig(_cfg);
+                numaMemoryBinding = _cfg.numaMemoryBinding;
+                weightsPrefetch = _cfg.weightsPrefetch;
+            }
+            graphLock._graph.setNumaNodeId(numaNodeForBinding(numaNodeId, numaMemoryBinding));
+            if (weightsPrefetch && stream >= 0)
+                graphLock._graph.setWeightsPrefetcher(getWeightsPrefetcher(static_cast<size_t>(stream)));
+            if (shapeBucket >= 0)
+                graphLock._graph.setInputShapes(_shapeBuckets[shapeBucket].shapes);
+            graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights.get(numaNodeId, numaMemoryBinding));
+        } catch(...) {
+            exception = std::current_exception();
+        }
+    };
+    if (nullptr != streamsExecutor) {
+        streamsExecutor->Execute(makeGraph);
+    } else {
+        makeGraph();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -202,10 +337,97 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
             graphLock._graph.setProperty(properties);
         }
     }
+    for (auto& bucket : _shapeBuckets) {
+        for (auto& g : bucket.graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.setProperty(properties);
+            }
+        }
+    }
+}
+
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    std::map<std::string, std::string> properties;
+    for (const auto& item : config) {
+        const auto& key = item.first;
+        if (key != CONFIG_KEY(CPU_THROUGHPUT_STREAMS) && key != ov::num_streams.name() &&
+            key != CONFIG_KEY(CPU_THREADS_NUM) && key != ov::inference_num_threads.name())
+            IE_THROW(NotImplemented) << "Unsupported ExecutableNetwork config key: " << key;
+        properties.emplace(key, item.second.as<std::string>());
+    }
+    if (properties.empty())
+        return;
+    if (_cfg.exclusiveAsyncRequests)
+        IE_THROW() << "The streams can not be reconfigured as the network shares the executor of exclusive async requests";
+
+    {
+        // the values are validated before the streams are drained
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        Config cfg = _cfg;
+        cfg.readProperties(properties);
+    }
+
+    std::lock_guard<std::mutex> reconfigureLock{_reconfigureMutex};
+    auto scheduler = _plugin->executorManager()->getPriorityScheduler();
+    // the tasks admitted to the current streams are drained, the ones submitted meanwhile wait in the scheduler
+    scheduler->suspend(_scheduledExecutor);
+    {
+        std::unique_lock<std::mutex> lock{_inferencesMutex};
+        _reconfiguring = true;
+        _inferencesCondition.wait(lock, [this] {
+            return _runningInferences == 0;
+        });
+    }
+    setProperty(properties);
+    InferenceEngine::IStreamsExecutor::Ptr taskExecutor;
+    size_t streams = 0;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        taskExecutor = makeStreamsExecutor();
+        streams = static_cast<size_t>(std::max(1, _cfg.streamExecutorConfig._streams));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{_streamsMutex};
+        _streamsSwitch->setTarget(taskExecutor);
+        // the replicas of the new streams are created lazily from the network and the weights cache on the first use.
+        // The retired ones are kept as the requests refer to them, and are reused when the streams grow again
+        if (_graphs.size() < streams)
+            _graphs.resize(streams);
+        _activeGraphs = streams;
+    }
+    {
+        std::lock_guard<std::mutex> lock{_inferencesMutex};
+        _reconfiguring = false;
+    }
+    _inferencesCondition.notify_all();
+    scheduler->resume(_scheduledExecutor, _taskExecutor, streams);
+}
+
+MKLDNNExecNetwork::RunningInference::RunningInference(MKLDNNExecNetwork& network) : _network(network) {
+    std::unique_lock<std::mutex> lock{_network._inferencesMutex};
+    _network._inferencesCondition.wait(lock, [this] {
+        return !_network._reconfiguring;
+    });
+    _network._runningInferences++;
+}
+
+MKLDNNExecNetwork::RunningInference::~RunningInference() {
+    {
+        std::lock_guard<std::mutex> lock{_network._inferencesMutex};
+        _network._runningInferences--;
+    }
+    _network._inferencesCondition.notify_all();
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    // the request is created with the current streams executor, so not in the middle of the reconfiguration
+    std::lock_guard<std::mutex> reconfigureLock{_reconfigureMutex};
+    auto asyncRequest = CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    // only the asynchronous inference is scheduled, the synchronous one is run by the caller
+    std::static_pointer_cast<MKLDNNAsyncInferRequest>(asyncRequest)->SetInferExecutor(_scheduledExecutor);
+    return asyncRequest;
 }
 
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -258,6 +480,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(PluginConfigInternalParams::METRIC_CPU_SCHEDULING_STATISTICS);
+        metrics.push_back(PluginConfigInternalParams::METRIC_CPU_CORE_TYPES_UTILIZATION);
+        metrics.push_back(PluginConfigInternalParams::METRIC_CPU_ABORTED_INFERENCES);
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -272,6 +497,37 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetricLegacy(const std::string
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_ABORTED_INFERENCES) {
+        return std::map<std::string, uint64_t>{
+            {"EXPIRED", _expiredInferences.load()},
+            {"CANCELLED", _cancelledInferences.load()},
+        };
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_CORE_TYPES_UTILIZATION) {
+        std::map<std::string, uint64_t> utilization;
+        const auto taskExecutor = _streamsSwitch ? _streamsSwitch->getTarget() : _taskExecutor;
+        if (auto hybridExecutor = std::dynamic_pointer_cast<HybridStreamsExecutor>(taskExecutor)) {
+            const std::pair<std::string, IStreamsExecutor::Config::PreferredCoreType> coreTypes[] = {
+                {"BIG", IStreamsExecutor::Config::BIG}, {"LITTLE", IStreamsExecutor::Config::LITTLE}};
+            for (const auto& coreType : coreTypes) {
+                const auto coreTypeUtilization = hybridExecutor->GetUtilization(coreType.second);
+                utilization[coreType.first + "_STREAMS"] = static_cast<uint64_t>(coreTypeUtilization.streams);
+                utilization[coreType.first + "_TASKS"] = coreTypeUtilization.tasks;
+                utilization[coreType.first + "_RUNNING"] = coreTypeUtilization.running;
+                utilization[coreType.first + "_BUSY_US"] = static_cast<uint64_t>(coreTypeUtilization.busy.count());
+            }
+        }
+        return utilization;
+    } else if (name == PluginConfigInternalParams::METRIC_CPU_SCHEDULING_STATISTICS) {
+        const auto statistics = _plugin->executorManager()->getPriorityScheduler()->getStatistics(_scheduledExecutor);
+        return std::map<std::string, uint64_t>{
+            {"SUBMITTED", statistics.submitted},
+            {"DEFERRED", statistics.deferred},
+            {"OVERDUE", statistics.overdue},
+            {"QUEUED", statistics.queued},
+            {"RUNNING", statistics.running},
+            {"TOTAL_QUEUEING_US", static_cast<uint64_t>(statistics.totalQueueing.count())},
+            {"MAX_QUEUEING_US", static_cast<uint64_t>(statistics.maxQueueing.count())},
+        };
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -292,15 +548,18 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
+    auto RW_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RW);
+    };
 
     if (name == ov::supported_properties) {
         return std::vector<ov::PropertyName> {
             RO_property(ov::supported_properties.name()),
             RO_property(ov::model_name.name()),
             RO_property(ov::optimal_number_of_infer_requests.name()),
-            RO_property(ov::num_streams.name()),
+            RW_property(ov::num_streams.name()),
             RO_property(ov::affinity.name()),
-            RO_property(ov::inference_num_threads.name()),
+            RW_property(ov::inference_num_threads.name()),
             RO_property(ov::enable_profiling.name()),
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
@@ -9,6 +9,8 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "blob_pool.h"
+#include "streams_executor_switch.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -16,6 +18,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <condition_variable>
 
 namespace MKLDNNPlugin {
 
@@ -39,6 +42,10 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    // changes the number of the streams and the threads of the compiled network, the only keys supported.
+    // Waits for the running inferences, the synchronous ones started meanwhile wait for the reconfiguration
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -55,6 +62,9 @@ protected:
     mutable std::mutex                          _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    // the inferences aborted as their deadlines passed, and as they were cancelled
+    std::atomic<uint64_t>                       _expiredInferences = {0};
+    std::atomic<uint64_t>                       _cancelledInferences = {0};
     std::string                                 _name;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
@@ -66,13 +76,65 @@ protected:
 
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
+    // the graphs used by the current streams, the rest are retired ones kept for the requests referring to them
+    size_t                                      _activeGraphs = 0;
+    // guards _graphs and _activeGraphs changed on the reconfiguration of the streams
+    mutable std::mutex                          _streamsMutex;
+    std::mutex                                  _reconfigureMutex;
+    // the synchronous inferences are run by the callers, not drained by the scheduler, so the reconfiguration
+    // of the streams waits for the running ones and holds the new ones
+    std::mutex                                  _inferencesMutex;
+    std::condition_variable                     _inferencesCondition;
+    size_t                                      _runningInferences = 0;
+    bool                                        _reconfiguring = false;
+    // the graphs compiled for the static input shapes of CPU_SHAPE_BUCKETS per stream, the inferences
+    // of the other shapes are run by _graphs
+    struct ShapeBucket {
+        std::map<std::string, InferenceEngine::SizeVector>  shapes;
+        std::deque<Graph>                                   graphs;
+    };
+    mutable std::deque<ShapeBucket>             _shapeBuckets;
+    // the helper threads prefetching the weights by the stream index, shared by the graph of the stream and the ones
+    // of its shape buckets. The micro-batch replicas run alongside the graph of the stream and prefetch nothing
+    mutable std::deque<std::shared_ptr<WeightsPrefetcher>> _weightsPrefetchers;
+    bool                                        _isFloatModel = true;
     NumaNodesWeights&                           _numaNodesWeights;
+    // memory of the input and output blobs of the requests, if they are pooled
+    std::unique_ptr<BlobPool>                   _blobPool;
+    // _taskExecutor unless the network shares the executor of the exclusive async requests, forwards the tasks
+    // to the streams executor replaced on the reconfiguration of the streams
+    StreamsExecutorSwitch::Ptr                  _streamsSwitch;
+    // admits the inference tasks to _taskExecutor by the priorities of the networks sharing the CPU
+    InferenceEngine::ITaskExecutor::Ptr         _scheduledExecutor;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
-    Graph::Lock GetGraph() const;
+    Graph::Lock GetGraph(int shapeBucket = -1) const;
+
+    // returns the index of the shape bucket the input blobs match, -1 if there is no such bucket
+    int findShapeBucket(const InferenceEngine::BlobMap& inputs) const;
+
+    // locks the graph replicas besides the one of the current stream the micro-batches of an inference are run by,
+    // the replicas are created on demand
+    std::vector<Graph::Lock> GetMicroBatchGraphs(size_t count) const;
+
+    // the graphs of the streams pass the stream index, so they share the prefetcher of the stream
+    void initGraph(Graph::Lock& graphLock, InferenceEngine::IStreamsExecutor* streamsExecutor, int numaNodeId,
+                   int shapeBucket = -1, int stream = -1) const;
+
+    // created by the thread of the stream, so its helper thread is bound to the cores of the stream
+    std::shared_ptr<WeightsPrefetcher> getWeightsPrefetcher(size_t stream) const;
+
+    InferenceEngine::IStreamsExecutor::Ptr makeStreamsExecutor() const;
+
+    // the inference running on the graphs, it starts after the reconfiguration of the streams in progress
+    struct RunningInference {
+        explicit RunningInference(MKLDNNExecNetwork& network);
+        ~RunningInference();
+        MKLDNNExecNetwork&  _network;
+    };
 
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
@@ -7,6 +7,7 @@
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
+#include "ngraph_transformations/op/scaled_attention.hpp"
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
@@ -38,6 +39,7 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
         NGRAPH_OP(SwishNode, MKLDNNPlugin)
+        NGRAPH_OP(ScaledAttentionNode, MKLDNNPlugin)
 #undef NGRAPH_OP
 
         return opset;
@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <chrono>
+#include <cstring>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -25,6 +27,7 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_conv_node.h>
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -40,7 +43,13 @@
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
+#include "utils/numa_memory.h"
+#include "utils/huge_pages.h"
+#include "utils/sample_independence.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
+#include "cache/tuning_cache.h"
+#include <ie_system_conf.h>
+#include "ie_parallel.hpp"
 
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
@@ -72,8 +81,17 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
 
+    if (config.collectHwCounters || !config.perfTraceFile.empty())
+        hwProfiler.reset(new HwProfiler(config.collectHwCounters, config.perfTraceFile));
+    else
+        hwProfiler.reset();
+
+    // the large buffers allocated while the graph is compiled are the workspace, the weights and the constants
+    HugePagesScope hugePagesScope(config.hugePages);
     Replicate(net, extMgr);
     InitGraph();
+    executionStream = mkldnn::stream(eng);
+    InitWeightsPrefetch();
 
     status = Ready;
 
@@ -191,6 +209,18 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
         upperBoundModel->reshape(newInShape);
 
         func = upperBoundModel;
+    } else if (!inputShapes.empty()) {
+        // the graph of a shape bucket gets the static shapes, so the static memory planning and in-place optimizations
+        auto staticModel = ngraph::clone_function(*network.getFunction());
+        std::map<ov::Output<ov::Node>, ov::PartialShape> newInShape;
+        for (const auto& in : staticModel->get_parameters()) {
+            const auto shape = inputShapes.find(in->get_friendly_name());
+            if (shape != inputShapes.end())
+                newInShape[in] = ov::PartialShape(ov::Shape(shape->second));
+        }
+        staticModel->reshape(newInShape);
+
+        func = staticModel;
     } else {
         func = network.getFunction();
     }
@@ -201,6 +231,7 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 
     isQuantizedFlag = (config.lpTransformsMode == Config::On) &&
                       ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(func);
+    independentSamplesFlag = config.microBatch > 0 && areSamplesIndependent(func);
 
     auto orderedOps = func->get_ordered_ops();
 
@@ -338,6 +369,14 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    // the tuning keeps the layouts, so the layout assignment accounts for the reorders of the tuned selection
+    if (config.primitiveTuning)
+        TunePrimitiveDescriptors();
+
+    layoutAssignmentStats = LayoutAssignmentStats{};
+    if (config.globalLayoutAssignment)
+        layoutAssignmentStats = optimizer.OptimizeLayoutAssignment(*this);
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -355,8 +394,26 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
     ExtractConstantAndExecutableNodes();
+    FindInputsFirstUse();
 
     ExecuteConstantNodesOnly();
+
+    if (numaNodeId >= 0)
+        BindConstantsToNumaNode();
+}
+
+void MKLDNNGraph::BindConstantsToNumaNode() const {
+    // the constants shared by the streams of the node through the weights cache are placed by the cache itself,
+    // the rest of them are read from the original model or computed by the thread compiling the graph
+    std::unordered_set<void*> placed;
+    for (const auto& edge : graphEdges) {
+        if (!edge->getParent()->isConstant())
+            continue;
+        const auto& memory = edge->getMemory();
+        if (!memory.isAllocated() || !memory.getDesc().isDefined() || !placed.insert(memory.GetData()).second)
+            continue;
+        bindToNumaNode(memory.GetData(), memory.GetSize(), numaNodeId);
+    }
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -399,6 +456,203 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
+namespace {
+
+std::string getIsaName() {
+    if (with_cpu_x86_bfloat16())
+        return "avx512_core_bf16";
+    if (with_cpu_x86_avx512_core())
+        return "avx512_core";
+    if (with_cpu_x86_avx512f())
+        return "avx512f";
+    if (with_cpu_x86_avx2())
+        return "avx2";
+    if (with_cpu_x86_avx())
+        return "avx";
+    if (with_cpu_x86_sse42())
+        return "sse42";
+    return "generic";
+}
+
+// The shapes alone do not identify the convolution, the same shapes are produced by different windows
+std::string getGeometrySignature(const MKLDNNNodePtr& node) {
+    auto conv = std::dynamic_pointer_cast<MKLDNNConvolutionNode>(node);
+    if (!conv)
+        return {};
+    return ";stride=" + vec2str(conv->getStride()) + ";dilation=" + vec2str(conv->getDilation()) +
+           ";pads=" + vec2str(conv->getPaddingL()) + vec2str(conv->getPaddingR()) +
+           ";groups=" + std::to_string(conv->getGroupNum());
+}
+
+std::string getCandidateSignature(const NodeDesc& candidate) {
+    std::string signature = impl_type_to_string(candidate.getImplementationType());
+    signature += ":";
+    auto addPort = [&](const PortConfig& conf) {
+        signature += std::string(conf.getMemDesc()->getPrecision().name()) + "_" + conf.getMemDesc()->serializeFormat() + ",";
+    };
+    for (const auto& conf : candidate.getConfig().inConfs)
+        addPort(conf);
+    signature += "->";
+    for (const auto& conf : candidate.getConfig().outConfs)
+        addPort(conf);
+    return signature;
+}
+
+// Returns the best time of several executions of the primitive in milliseconds.
+// The primitive is created without post ops, since their arguments are not available before the graph allocation,
+// the post ops cost is similar for all the implementations anyway.
+double measurePrimitive(mkldnn::primitive_desc_iterator& pd, const mkldnn::engine& engine) {
+    constexpr int repetitions = 5;
+
+    mkldnn::primitive prim(pd.get());
+    std::unordered_map<int, mkldnn::memory> args;
+    auto addArg = [&](int arg, const mkldnn::memory::desc& desc) {
+        if (desc.get_size() == 0)
+            return;
+        mkldnn::memory mem(desc, engine);
+        // zeros avoid denormals in the uninitialized memory, which would distort the measurement
+        std::memset(mem.get_data_handle(), 0, desc.get_size());
+        args[arg] = mem;
+    };
+    addArg(DNNL_ARG_SRC, pd.src_desc(0));
+    addArg(DNNL_ARG_WEIGHTS, pd.weights_desc(0));
+    addArg(DNNL_ARG_BIAS, pd.weights_desc(1));
+    addArg(DNNL_ARG_DST, pd.dst_desc(0));
+    addArg(DNNL_ARG_SCRATCHPAD, pd.scratchpad_desc());
+
+    mkldnn::stream stream(engine);
+    // warm up caches and JIT kernels
+    prim.execute(stream, args);
+    stream.wait();
+
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repetitions; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        prim.execute(stream, args);
+        stream.wait();
+        const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        best = std::min(best, duration.count());
+    }
+    return best;
+}
+
+}  // namespace
+
+double MKLDNNGraph::MeasurePrimitiveDescriptor(const MKLDNNNodePtr& node, const NodeDesc& candidate) const {
+    const auto& config = candidate.getConfig();
+    if (config.inConfs.empty() || config.outConfs.empty())
+        return -1;
+
+    // find the implementation the candidate was created from
+    for (const auto& desc : node->descs) {
+        auto itpd = desc.createPrimitiveDescriptorIterator(node->getEngine());
+        while (static_cast<bool>(itpd)) {
+            if (parse_impl_name(itpd.impl_info_str()) == candidate.getImplementationType() &&
+                MKLDNNExtensionUtils::makeDescriptor(itpd.src_desc(0))->isCompatible(*config.inConfs[0].getMemDesc()) &&
+                MKLDNNExtensionUtils::makeDescriptor(itpd.dst_desc(0))->isCompatible(*config.outConfs[0].getMemDesc())) {
+                return measurePrimitive(itpd, node->getEngine());
+            }
+            if (!itpd.next_impl())
+                break;
+        }
+    }
+    return -1;
+}
+
+void MKLDNNGraph::TunePrimitiveDescriptors() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::TunePrimitiveDescriptors");
+
+    auto cache = TuningCache::get(config.tuningCacheFile);
+    const std::string platform = getIsaName() + ";threads=" + std::to_string(parallel_get_max_threads());
+
+    for (auto &node : graphNodes) {
+        if (!one_of(node->getType(), Convolution, FullyConnected) || node->isConstant() || node->isDynamicNode() ||
+            node->descs.empty() || !node->getSelectedPrimitiveDescriptor())
+            continue;
+
+        // the top candidates in the order of the implementation priority, the greedy selection goes first
+        const auto& spds = node->getSupportedPrimitiveDescriptors();
+        const auto& priority = node->getPrimitivesPriority();
+        const auto* selected = node->getSelectedPrimitiveDescriptor();
+        std::vector<size_t> candidates{static_cast<size_t>(std::distance(spds.data(), selected))};
+        // the primitive alone is measured, so only the candidates of the selected layouts are compared,
+        // the other ones would add the reorders the measurement does not account for
+        auto keepsLayouts = [&](const NodeDesc& candidate) {
+            const auto& candidateConfig = candidate.getConfig();
+            const auto& selectedConfig = selected->getConfig();
+            if (candidateConfig.inConfs.size() != selectedConfig.inConfs.size() ||
+                candidateConfig.outConfs.size() != selectedConfig.outConfs.size())
+                return false;
+            for (size_t i = 0; i < candidateConfig.inConfs.size(); i++) {
+                // the reorders of the constant inputs run once on the graph creation
+                if (i < node->getParentEdges().size() && node->getParentEdgeAt(i)->getParent()->isConstant())
+                    continue;
+                if (!candidateConfig.inConfs[i].getMemDesc()->isCompatible(*selectedConfig.inConfs[i].getMemDesc()))
+                    return false;
+            }
+            for (size_t i = 0; i < candidateConfig.outConfs.size(); i++) {
+                if (!candidateConfig.outConfs[i].getMemDesc()->isCompatible(*selectedConfig.outConfs[i].getMemDesc()))
+                    return false;
+            }
+            return true;
+        };
+        for (const auto& type : priority) {
+            for (size_t i = 0; i < spds.size() && candidates.size() < config.tuningCandidates; i++) {
+                if (spds[i].getImplementationType() == type && i != candidates.front() &&
+                    spds[i].getConfig().inConfs.size() <= node->getParentEdges().size() && keepsLayouts(spds[i]))
+                    candidates.push_back(i);
+            }
+        }
+        if (candidates.size() < 2)
+            continue;
+
+        std::string key = platform + ";" + node->getTypeStr() + ";" + std::to_string(node->getAlgorithm()) + ";";
+        for (const auto& shape : node->inputShapes)
+            key += shape.toString();
+        key += "->";
+        for (const auto& shape : node->outputShapes)
+            key += shape.toString();
+        key += getGeometrySignature(node);
+        // the fused depthwise convolution has the window of its own
+        for (const auto& fused : node->getFusedWith())
+            key += ";" + fused->getTypeStr() + getGeometrySignature(fused);
+        for (auto idx : candidates)
+            key += ";" + getCandidateSignature(spds[idx]);
+
+        auto selectCached = [&]() {
+            std::string value;
+            if (!cache->find(key, value))
+                return false;
+            for (auto idx : candidates) {
+                if (getCandidateSignature(spds[idx]) == value) {
+                    node->selectPrimitiveDescriptorByIndex(static_cast<int>(idx));
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        if (selectCached())
+            continue;
+
+        std::lock_guard<std::mutex> lock(cache->measurementMutex());
+        if (selectCached())
+            continue;
+
+        size_t best = candidates.front();
+        double bestTime = std::numeric_limits<double>::max();
+        for (auto idx : candidates) {
+            const auto time = MeasurePrimitiveDescriptor(node, spds[idx]);
+            if (time >= 0 && time < bestTime) {
+                bestTime = time;
+                best = idx;
+            }
+        }
+        node->selectPrimitiveDescriptorByIndex(static_cast<int>(best));
+        cache->put(key, getCandidateSignature(spds[best]));
+    }
+}
+
 void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExtractConstantAndExecutableNodes");
     for (const auto& graphNode : graphNodes) {
@@ -415,6 +669,40 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     }
 }
 
+void MKLDNNGraph::FindInputsFirstUse() {
+    std::unordered_map<const MKLDNNNode*, size_t> positions;
+    for (size_t i = 0; i < executableGraphNodes.size(); i++)
+        positions[executableGraphNodes[i].get()] = i;
+
+    auto firstUse = [&](const MKLDNNNodePtr& source) {
+        size_t first = executableGraphNodes.size();
+        std::unordered_set<const MKLDNNNode*> visited;
+        std::vector<MKLDNNNode*> stack{source.get()};
+        while (!stack.empty()) {
+            auto node = stack.back();
+            stack.pop_back();
+            if (!visited.insert(node).second)
+                continue;
+            auto position = positions.find(node);
+            if (position != positions.end())
+                first = std::min(first, position->second);
+            for (size_t i = 0; i < node->getChildEdges().size(); i++)
+                stack.push_back(node->getChildEdgeAt(i)->getChild().get());
+        }
+        return first;
+    };
+
+    inputsFirstUse.clear();
+    for (const auto& input : inputNodesMap)
+        inputsFirstUse[input.first] = firstUse(input.second);
+
+    statesFirstUse = executableGraphNodes.size();
+    for (const auto& node : graphNodes) {
+        if (node->getType() == MemoryInput)
+            statesFirstUse = std::min(statesFirstUse, firstUse(node));
+    }
+}
+
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
     mkldnn::stream stream(eng);
@@ -688,6 +976,9 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    // the workspace is placed before it is touched, otherwise the thread compiling the graph would place it
+    if (numaNodeId >= 0)
+        bindToNumaNode(memWorkspace->GetData(), total_size, numaNodeId);
 
     if (edge_clusters.empty())
         return;
@@ -745,6 +1036,26 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+// the blob and the memory of the graph are dense planar ones of the same precision and dims, so the data is copied
+// as is, without the memory descriptors the copies of the other layouts allocate
+static bool isPlainCopy(const TensorDesc& desc, const MKLDNNMemory& memory) {
+    const auto& memoryDesc = memory.getDesc();
+    if (!memoryDesc.isDefined() || !memoryDesc.hasLayoutType(LayoutType::ncsp) ||
+        desc.getPrecision() != memoryDesc.getPrecision() || desc.getDims() != memory.getStaticDims())
+        return false;
+    const auto& blocking = desc.getBlockingDesc();
+    const auto& order = blocking.getOrder();
+    if (blocking.getOffsetPadding() != 0 || order.size() != desc.getDims().size())
+        return false;
+    size_t stride = 1;
+    for (size_t i = order.size(); i-- > 0;) {
+        if (order[i] != i || blocking.getBlockDims()[i] != desc.getDims()[i] || blocking.getStrides()[i] != stride)
+            return false;
+        stride *= desc.getDims()[i];
+    }
+    return memory.GetSize() == stride * desc.getPrecision().size();
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
@@ -758,7 +1069,9 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = childEdge->getMemory().GetData();
 
-        if (ext_data_ptr != inter_data_ptr) {
+        if (ext_data_ptr != inter_data_ptr && !getProperty().batchLimit && isPlainCopy(inTensorDesc, childEdge->getMemory())) {
+            cpu_memcpy(inter_data_ptr, ext_data_ptr, in->byteSize());
+        } else if (ext_data_ptr != inter_data_ptr) {
             auto ext_tdesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(in->getTensorDesc());
 
             MKLDNNMemory ext_mem(eng);
@@ -798,16 +1111,24 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         IE_THROW() << "Wrong state. Topology not ready.";
 
     for (auto &outputMap : outputNodesMap) {
-        auto name = outputMap.first;
-        auto node = outputMap.second;
-        auto parentEdge = node->getParentEdgeAt(0);
+        const auto& name = outputMap.first;
+        const auto& node = outputMap.second;
+        const auto& parentEdge = node->getParentEdgeAt(0);
         const MKLDNNMemory& intr_blob = parentEdge->getMemory();
 
         const auto ext_blob_map = out.find(name);
-        const auto ext_blob = ext_blob_map->second;
         if (ext_blob_map == out.end()) {
             IE_THROW(Unexpected) << "The network outputs do not contain mkldnn graph output node name: \"" << name << "\"";
         }
+        const auto& ext_blob = ext_blob_map->second;
+
+        // the output is written to the blob in place, the steady state of the static graphs does not allocate
+        if (ext_blob->buffer() == intr_blob.GetData() && ext_blob->getTensorDesc().getDims() == intr_blob.getStaticDims())
+            continue;
+        if (!getProperty().batchLimit && isPlainCopy(ext_blob->getTensorDesc(), intr_blob)) {
+            cpu_memcpy(ext_blob->buffer().as<void*>(), intr_blob.GetData(), ext_blob->byteSize());
+            continue;
+        }
 
         const auto actualDesc = MemoryDescUtils::convertToTensorDesc(intr_blob.getDesc());
         auto &expectedDesc = ext_blob->getTensorDesc();
@@ -906,25 +1227,150 @@ inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::st
     }
 }
 
-void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request) {
+void MKLDNNGraph::InitWeightsPrefetch() {
+    // the smaller weights are not worth waking the helper thread up
+    const size_t minPrefetchedWeights = 64 * 1024;
+
+    prefetchingWeights = false;
+    prefetchRegions.assign(executableGraphNodes.size(), {});
+    prefetchTargets.assign(executableGraphNodes.size(), executableGraphNodes.size());
+    if (!config.weightsPrefetch || !weightsPrefetcher)
+        return;
+
+    std::vector<size_t> weighted;
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        const auto& node = executableGraphNodes[i];
+        if (node->isDynamicNode())
+            continue;
+        size_t size = 0;
+        for (int arg : {DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS}) {
+            auto memory = node->primArgs.find(arg);
+            if (memory == node->primArgs.end() || memory->second.get_data_handle() == nullptr)
+                continue;
+            PrefetchRegion region;
+            region.data = static_cast<const uint8_t*>(memory->second.get_data_handle());
+            region.size = memory->second.get_desc().get_size();
+            prefetchRegions[i].push_back(region);
+            size += region.size;
+        }
+        if (size < minPrefetchedWeights)
+            prefetchRegions[i].clear();
+        else
+            weighted.push_back(i);
+    }
+    if (weighted.empty())
+        return;
+
+    // the last node with the weights prefetches the ones of the first node for the next inference
+    for (size_t i = 0; i < weighted.size(); i++) {
+        const size_t target = weighted[(i + 1) % weighted.size()];
+        if (target != weighted[i])
+            prefetchTargets[weighted[i]] = target;
+    }
+    prefetchingWeights = true;
+}
+
+inline void MKLDNNGraph::PrefetchWeights(size_t node) {
+    const size_t target = prefetchTargets[node];
+    if (target != prefetchTargets.size())
+        weightsPrefetcher->prefetch(prefetchRegions[target]);
+}
+
+bool MKLDNNGraph::CanReplay() const {
+#ifdef CPU_DEBUG_CAPS
+    // the nodes are verbosed and dumped one by one
+    return false;
+#else
+    // the perf counters are collected per node, and the config may request them after the kernels are recorded.
+    // The legacy dynamic batch recreates the primitives of the nodes for the batch of each inference
+    return config.graphReplay && !config.collectPerfCounters && !hwProfiler && config.batchLimit == 0;
+#endif
+}
+
+void MKLDNNGraph::CaptureKernels() {
+    replayKernels.assign(executableGraphNodes.size(), MKLDNNNode::Kernel{});
+    for (size_t i = 0; i < executableGraphNodes.size(); i++) {
+        const auto& node = executableGraphNodes[i];
+        // the dynamic nodes infer the shapes and update the params on each inference
+        if (node->isDynamicNode() || !node->captureKernel(replayKernels[i]))
+            replayKernels[i] = MKLDNNNode::Kernel{};
+    }
+    replayCaptured = true;
+}
+
+size_t MKLDNNGraph::GetReplayedNodesCount() const {
+    if (!replayCaptured || !CanReplay())
+        return 0;
+    return std::count_if(replayKernels.begin(), replayKernels.end(), [](const MKLDNNNode::Kernel& kernel) {
+        return kernel.function != nullptr;
+    });
+}
+
+void MKLDNNGraph::ExecuteNodes(MKLDNNInferRequestBase* request, size_t from, size_t to) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
+    executionsCount++;
+    const auto& stream = executionStream;
+
+    if (replayCaptured && CanReplay()) {
+        if (request)
+            request->ThrowIfCanceled();
+        for (size_t i = from; i < to; i++) {
+            if (prefetchingWeights)
+                PrefetchWeights(i);
+            const auto& kernel = replayKernels[i];
+            if (kernel.function)
+                kernel.function(kernel.kernel, kernel.args, stream);
+            else
+                ExecuteNode(executableGraphNodes[i], stream);
+        }
+        return;
+    }
+
+    if (hwProfiler && from == 0)
+        hwProfiler->startInfer();
 
-    for (const auto& node : executableGraphNodes) {
+    for (size_t i = from; i < to; i++) {
+        const auto& node = executableGraphNodes[i];
         VERBOSE(node, config.verbose);
         PERF(node, config.collectPerfCounters);
+        HW_PERF(node, hwProfiler);
 
         if (request)
             request->ThrowIfCanceled();
+        if (prefetchingWeights)
+            PrefetchWeights(i);
         ExecuteNode(node, stream);
     }
 
+    // the kernels are recorded after a complete inference, so the nodes initialized lazily are ready
+    if (!replayCaptured && from == 0 && to == executableGraphNodes.size() && CanReplay())
+        CaptureKernels();
+}
+
+void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request, size_t from) {
+    ExecuteNodes(request, from, executableGraphNodes.size());
+
+    if (hwProfiler)
+        hwProfiler->finishInfer();
+
     if (infer_count != -1) infer_count++;
 }
 
+size_t MKLDNNGraph::InferReady(MKLDNNInferRequestBase* request, const std::unordered_set<std::string>& readyInputs, size_t from) {
+    size_t to = statesFirstUse;
+    for (const auto& input : inputsFirstUse) {
+        if (!readyInputs.count(input.first))
+            to = std::min(to, input.second);
+    }
+    to = std::max(from, to);
+
+    ExecuteNodes(request, from, to);
+    return to;
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1053,7 +1499,7 @@ void MKLDNNGraph::setProperty(const std::map<std::string, std::string>& properti
     config.readProperties(properties);
 }
 
-Config MKLDNNGraph::getProperty() const {
+const Config& MKLDNNGraph::getProperty() const {
     return config;
 }
 
@@ -1282,6 +1728,7 @@ void MKLDNNGraph::EnforceBF16() {
         MatMul,         // bert nets
         ROIPooling,     // object detection nets
         Interpolate,    // super resolution nets
+        ScaledDotProductAttention, // transformer nets
     };
 
     std::function<void(const MKLDNNNodePtr&, std::unordered_set<MKLDNNNodePtr>& skipNodes)> searchForNodesToSkip;
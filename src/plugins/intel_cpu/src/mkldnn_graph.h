@@ -11,14 +11,30 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "cache/multi_cache.h"
+#include "utils/perf_events.h"
+#include "utils/weights_prefetch.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequestBase;
+/**
+ * Result of the graph-wide layout assignment compared with the greedy per-node primitive descriptors selection.
+ * Only reorders of non-constant tensors are counted, since the constant ones are executed on load network stage.
+ */
+struct LayoutAssignmentStats {
+    bool applied = false;  // the pass has run, the counts are zeros otherwise
+    size_t greedyReorders = 0;
+    size_t greedyReorderBytes = 0;
+    size_t reorders = 0;
+    size_t reorderBytes = 0;
+    size_t reselectedNodes = 0;
+};
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -30,6 +46,11 @@ public:
     };
 
     MKLDNNGraph() = default;
+    ~MKLDNNGraph() {
+        // the shared helper thread may still read the weights of the last inference
+        if (weightsPrefetcher)
+            weightsPrefetcher->cancel();
+    }
 
     Status GetStatus() {
         return status;
@@ -43,7 +64,7 @@ public:
     const Config& getConfig() const;
 
     void setProperty(const std::map<std::string, std::string> &properties);
-    Config getProperty() const;
+    const Config& getProperty() const;
 
     template<typename NET>
     void CreateGraph(NET &network,
@@ -57,7 +78,23 @@ public:
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
-    void Infer(MKLDNNInferRequestBase* request = nullptr);
+    // executes the nodes starting from the given position in the execution order
+    void Infer(MKLDNNInferRequestBase* request = nullptr, size_t from = 0);
+
+    /**
+     * Executes the nodes starting from the given position in the execution order until the first node depending
+     * on an input out of the ready ones or on a state, returns the position the execution stopped at.
+     * The nodes executed stay valid for the request until the next execution on the graph (see GetExecutionsCount).
+     */
+    size_t InferReady(MKLDNNInferRequestBase* request, const std::unordered_set<std::string>& readyInputs, size_t from = 0);
+
+    // number of the executions started on the graph
+    size_t GetExecutionsCount() const {
+        return executionsCount;
+    }
+
+    // number of the executable nodes replayed by their recorded kernels, zero until the kernels are recorded
+    size_t GetReplayedNodesCount() const;
 
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
@@ -174,16 +211,45 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    const LayoutAssignmentStats& getLayoutAssignmentStats() const {
+        return layoutAssignmentStats;
+    }
+
     void SortTopologically();
 
     bool isQuantized() const {
         return isQuantizedFlag;
     }
 
+    // the samples of the dynamic batch are computed independently, so the batch may be split into micro-batches
+    bool hasIndependentSamples() const {
+        return independentSamplesFlag;
+    }
+
     bool hasDynamicInput() const {
         return graphHasDynamicInput;
     }
 
+    // NUMA node the memory of the graph is placed on, -1 keeps the placement to the OS
+    void setNumaNodeId(int id) {
+        numaNodeId = id;
+    }
+
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
+    // helper thread of the stream the graph runs on, shared with the other graphs of the stream. The weights are
+    // prefetched only if it is set before the graph is created and CPU_WEIGHTS_PREFETCH is enabled
+    void setWeightsPrefetcher(const std::shared_ptr<WeightsPrefetcher>& prefetcher) {
+        weightsPrefetcher = prefetcher;
+    }
+
+    // static shapes of the inputs the graph is compiled for instead of the ones of the network, by the input names
+    void setInputShapes(const std::map<std::string, InferenceEngine::SizeVector>& shapes) {
+        inputShapes = shapes;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -196,6 +262,11 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        replayKernels.clear();
+        replayCaptured = false;
+        if (weightsPrefetcher)
+            weightsPrefetcher->cancel();
+        prefetchingWeights = false;
     }
     Status status { NotReady };
     Config config;
@@ -207,6 +278,8 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    int numaNodeId = -1;
+    std::map<std::string, InferenceEngine::SizeVector> inputShapes;
 
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
@@ -215,6 +288,7 @@ protected:
     std::string _name;
 
     bool isQuantizedFlag = false;
+    bool independentSamplesFlag = false;
     bool graphHasDynamicInput = false;
 
     static mkldnn::engine eng;
@@ -225,13 +299,22 @@ protected:
     void InitNodes();
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
+    void TunePrimitiveDescriptors();
+    double MeasurePrimitiveDescriptor(const MKLDNNNodePtr& node, const NodeDesc& candidate) const;
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    void FindInputsFirstUse();
+    void ExecuteNodes(MKLDNNInferRequestBase* request, size_t from, size_t to);
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
+    bool CanReplay() const;
+    void CaptureKernels();
+    void InitWeightsPrefetch();
+    void PrefetchWeights(size_t node);
     void ExecuteConstantNodesOnly() const;
+    void BindConstantsToNumaNode() const;
 
     friend class MKLDNNInferRequestBase;
     friend class MKLDNNLegacyInferRequest;
@@ -248,9 +331,29 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
+    // position of the first executable node depending on each input and on any of the states
+    std::map<std::string, size_t> inputsFirstUse;
+    size_t statesFirstUse = 0;
+    size_t executionsCount = 0;
+    // the stream the nodes are executed in, reused by the inferences as a graph is executed by one thread at a time
+    mkldnn::stream executionStream;
+    // the kernels of the executable nodes recorded for the graph replay, the nodes without a kernel are executed
+    std::vector<MKLDNNNode::Kernel> replayKernels;
+    bool replayCaptured = false;
 
     MultiCachePtr rtParamsCache;
 
+    LayoutAssignmentStats layoutAssignmentStats;
+
+    // hardware counters and trace collection, created only when requested by the config
+    std::unique_ptr<HwProfiler> hwProfiler;
+
+    // the weights of the executable nodes, and the node with the weights executed after each one with the weights
+    std::vector<std::vector<PrefetchRegion>> prefetchRegions;
+    std::vector<size_t> prefetchTargets;
+    std::shared_ptr<WeightsPrefetcher> weightsPrefetcher;
+    bool prefetchingWeights = false;
+
     void EnforceBF16();
 };
 
@@ -5,6 +5,7 @@
 #include "mkldnn_graph_dumper.h"
 
 #include "utils/debug_capabilities.h"
+#include "utils/huge_pages.h"
 #include <ie_ngraph_utils.hpp>
 #include "exec_graph_info.hpp"
 #include "ie_common.h"
@@ -104,6 +105,21 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    // Hardware counters, averaged per execution like PERF_COUNTER
+    if (node->PerfCounter().has_hw()) {
+        const auto hw = node->PerfCounter().hw_avg();
+        serialization_info["cycles"] = std::to_string(hw.cycles);
+        serialization_info["instructions"] = std::to_string(hw.instructions);
+        serialization_info["llcMisses"] = std::to_string(hw.llcMisses);
+        if (hw.cycles != 0)
+            serialization_info["ipc"] = std::to_string(static_cast<double>(hw.instructions) / hw.cycles);
+        // there are no per-thread DRAM counters, so the traffic is estimated as one cache line per LLC miss
+        if (node->PerfCounter().avg() != 0) {
+            const double bytesPerUs = static_cast<double>(hw.llcMisses) * 64 / node->PerfCounter().avg();
+            serialization_info["estimatedMemoryBandwidthMBps"] = std::to_string(bytesPerUs);
+        }
+    }
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
@@ -204,7 +220,25 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const MKLDNNGraph
         holder->add_control_dependency(node);
     }
 
-    return std::make_shared<ngraph::Function>(results, params, graph._name);
+    auto function = std::make_shared<ngraph::Function>(results, params, graph._name);
+
+    // Reorders eliminated by the graph-wide layout assignment compared with the greedy per-node selection
+    const auto& layoutStats = graph.getLayoutAssignmentStats();
+    if (layoutStats.applied) {
+        function->get_rt_info()["greedyReorders"] = std::to_string(layoutStats.greedyReorders);
+        function->get_rt_info()["greedyReorderBytes"] = std::to_string(layoutStats.greedyReorderBytes);
+        function->get_rt_info()["reorders"] = std::to_string(layoutStats.reorders);
+        function->get_rt_info()["reorderBytes"] = std::to_string(layoutStats.reorderBytes);
+        function->get_rt_info()["layoutReselectedNodes"] = std::to_string(layoutStats.reselectedNodes);
+    }
+
+    // Memory of the process on the huge pages requested by the CPU_HUGE_PAGES config key
+    const auto hugePagesStats = HugePagesAllocator::stats();
+    function->get_rt_info()["hugePagesExplicitBytes"] = std::to_string(hugePagesStats.explicitBytes);
+    function->get_rt_info()["hugePagesTransparentBytes"] = std::to_string(hugePagesStats.transparentBytes);
+    function->get_rt_info()["hugePagesFallbackBytes"] = std::to_string(hugePagesStats.fallbackBytes);
+
+    return function;
 }
 
 #ifdef CPU_DEBUG_CAPS
@@ -46,6 +46,7 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <algorithm>
 
 #include "mkldnn_itt.h"
@@ -2073,3 +2074,181 @@ void MKLDNNGraphOptimizer::reshapeRnnSeq(MKLDNNGraph &graph) {
         }
     }
 }
+
+namespace {
+
+// Dynamic shapes are estimated by their lower bound.
+size_t getTensorBytes(const MemoryDesc& desc) {
+    const auto& shape = desc.getShape();
+    const auto& dims = shape.isStatic() ? shape.getStaticDims() : shape.getMinDims();
+    size_t elements = 1;
+    for (auto dim : dims)
+        elements *= dim;
+    return elements * desc.getPrecision().size();
+}
+
+// Returns the bytes of the reorder the edge would need for the given configurations of its ends, zero means no reorder.
+// Mirrors the compatibility check of MKLDNNEdge::needReorder, reorders of constant tensors are free at runtime.
+size_t getReorderBytes(const MKLDNNEdgePtr& edge, const NodeConfig& parentConfig, const NodeConfig& childConfig) {
+    if (parentConfig.outConfs.empty() || edge->getParent()->isConstant())
+        return 0;
+    int inNum = edge->getInputNum();
+    if (inNum < 0 || inNum >= parentConfig.outConfs.size())
+        inNum = 0;
+    const int outNum = edge->getOutputNum();
+    if (outNum < 0 || outNum >= childConfig.inConfs.size())
+        return 0;
+
+    const auto parentDesc = parentConfig.outConfs[inNum].getPortDesc();
+    const auto childDesc = childConfig.inConfs[outNum].getPortDesc();
+    // undefined descriptors take the layout of the neighbor in initOptimalPrimitiveDescriptor
+    if (!parentDesc || !childDesc || !parentDesc->getMemDesc()->isDefined() || !childDesc->getMemDesc()->isDefined())
+        return 0;
+    if (childDesc->isCompatible(*parentDesc))
+        return 0;
+    return std::max<size_t>({getTensorBytes(*parentDesc->getMemDesc()), getTensorBytes(*childDesc->getMemDesc()), 1});
+}
+
+size_t getReorderBytes(const MKLDNNEdgePtr& edge) {
+    const auto parentSPD = edge->getParent()->getSelectedPrimitiveDescriptor();
+    const auto childSPD = edge->getChild()->getSelectedPrimitiveDescriptor();
+    if (!parentSPD || !childSPD)
+        return 0;
+    return getReorderBytes(edge, parentSPD->getConfig(), childSPD->getConfig());
+}
+
+bool hasInPlacePorts(const NodeConfig& config) {
+    for (const auto& conf : config.inConfs)
+        if (conf.inPlace() >= 0)
+            return true;
+    for (const auto& conf : config.outConfs)
+        if (conf.inPlace() >= 0)
+            return true;
+    return false;
+}
+
+}  // namespace
+
+LayoutAssignmentStats MKLDNNGraphOptimizer::OptimizeLayoutAssignment(MKLDNNGraph &graph) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraphOptimizer::OptimizeLayoutAssignment");
+
+    LayoutAssignmentStats stats;
+    stats.applied = true;
+    for (const auto& edge : graph.GetEdges()) {
+        const auto bytes = getReorderBytes(edge);
+        if (bytes) {
+            stats.greedyReorders++;
+            stats.greedyReorderBytes += bytes;
+        }
+    }
+
+    // Nodes, which choose the layout depending on the neighbors (Concat, Split) or share the memory with them,
+    // rely on their own selection logic and are kept as is.
+    auto isSuitableNode = [](const MKLDNNNodePtr& node) {
+        if (one_of(node->getType(), Input, Output, Reorder, Concatenation, Split) || node->isConstant())
+            return false;
+        const auto& spds = node->getSupportedPrimitiveDescriptors();
+        if (spds.size() < 2 || !node->getSelectedPrimitiveDescriptor())
+            return false;
+        for (const auto& spd : spds)
+            if (hasInPlacePorts(spd.getConfig()))
+                return false;
+        return true;
+    };
+
+    // The cost of a candidate is the estimated cost of its kernel plus the bytes moved by the reorders on the node edges.
+    // The kernel cost is the distance in the priority list from the implementation type selected before the pass,
+    // each step weighs as much as reordering all the node tensors once. The greedy selection picks the best type
+    // available and the primitive tuning the fastest measured one, so the candidates of that type differ only in
+    // the reorders, and the pass does not undo the tuning for a small gain.
+    auto getCandidateCost = [](const MKLDNNNodePtr& node, const NodeDesc& candidate, size_t kernelRank, size_t nodeBytes) {
+        const auto& config = candidate.getConfig();
+        size_t cost = kernelRank * nodeBytes;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            const auto parentSPD = edge->getParent()->getSelectedPrimitiveDescriptor();
+            if (parentSPD)
+                cost += getReorderBytes(edge, parentSPD->getConfig(), config);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            const auto childSPD = edge->getChild()->getSelectedPrimitiveDescriptor();
+            if (childSPD)
+                cost += getReorderBytes(edge, config, childSPD->getConfig());
+        }
+        return cost;
+    };
+
+    std::vector<MKLDNNNodePtr> candidates;
+    for (const auto& node : graph.GetNodes()) {
+        if (isSuitableNode(node))
+            candidates.push_back(node);
+    }
+
+    std::unordered_map<MKLDNNNode*, impl_desc_type> initialTypes;
+    for (const auto& node : candidates)
+        initialTypes[node.get()] = node->getSelectedPrimitiveDescriptor()->getImplementationType();
+
+    std::set<MKLDNNNode*> reselected;
+    // Every accepted change strictly decreases the total cost, so the iterations converge,
+    // the limit only bounds the compilation time on large graphs.
+    constexpr int maxIterations = 8;
+    for (int iteration = 0; iteration < maxIterations; iteration++) {
+        bool changed = false;
+        for (const auto& node : candidates) {
+            const auto& spds = node->getSupportedPrimitiveDescriptors();
+            const auto& priority = node->getPrimitivesPriority();
+            auto getRank = [&](impl_desc_type type) {
+                return static_cast<size_t>(std::distance(priority.begin(), std::find(priority.begin(), priority.end(), type)));
+            };
+            const size_t initialRank = getRank(initialTypes[node.get()]);
+            auto getKernelRank = [&](impl_desc_type type) {
+                const size_t rank = getRank(type);
+                return rank > initialRank ? rank - initialRank : initialRank - rank;
+            };
+
+            const auto& current = *node->getSelectedPrimitiveDescriptor();
+            size_t nodeBytes = 0;
+            for (const auto& conf : current.getConfig().inConfs)
+                nodeBytes += getTensorBytes(*conf.getMemDesc());
+            for (const auto& conf : current.getConfig().outConfs)
+                nodeBytes += getTensorBytes(*conf.getMemDesc());
+
+            const int currentIdx = static_cast<int>(std::distance(spds.data(), &current));
+            size_t bestCost = getCandidateCost(node, current, getKernelRank(current.getImplementationType()), nodeBytes);
+            int bestIdx = currentIdx;
+            for (size_t i = 0; i < spds.size(); i++) {
+                const auto& config = spds[i].getConfig();
+                if (static_cast<int>(i) == currentIdx || config.inConfs.size() > node->getParentEdges().size())
+                    continue;
+                // do not lose the dynamic batch support the greedy selection has provided
+                if (current.getConfig().dynBatchSupport && !config.dynBatchSupport)
+                    continue;
+                const auto cost = getCandidateCost(node, spds[i], getKernelRank(spds[i].getImplementationType()), nodeBytes);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIdx = static_cast<int>(i);
+                }
+            }
+
+            if (bestIdx != currentIdx) {
+                node->selectPrimitiveDescriptorByIndex(bestIdx);
+                reselected.insert(node.get());
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+    for (const auto& edge : graph.GetEdges()) {
+        const auto bytes = getReorderBytes(edge);
+        if (bytes) {
+            stats.reorders++;
+            stats.reorderBytes += bytes;
+        }
+    }
+    stats.reselectedNodes = reselected.size();
+
+    return stats;
+}
@@ -17,6 +17,11 @@ public:
 public:
     void ApplyCommonGraphOptimizations(MKLDNNGraph& graph);
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
+    /**
+     * Revises the primitive descriptors selected by the nodes one by one, so the whole graph needs less reorders.
+     * Must be called between the selection of the primitive descriptors and the edges initialization.
+     */
+    LayoutAssignmentStats OptimizeLayoutAssignment(MKLDNNGraph& graph);
 
 private:
     void FuseConvolutionMatMulAndBias(MKLDNNGraph &graph);
@@ -21,7 +21,9 @@
 #include "mkldnn_async_infer_request.h"
 #include <debug.h>
 #include "utils/general_utils.h"
+#include "ie_parallel.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa_memory.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -33,36 +35,198 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::CreateInferRequest() {
     if (execNetwork->_graphs.size() == 0)
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
-
-    initBlobs();
-
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
+    pooledBlobs = execNetwork->_blobPool != nullptr;
+    if (pooledBlobs)
+        blobAllocator = execNetwork->_blobPool->getAllocator();
+    else if (graph->getNumaNodeId() >= 0)
+        blobAllocator = createNumaAllocator(graph->getNumaNodeId());
+    else
+        blobAllocator = InferenceEngine::CreateDefaultAllocator();
+
+    // the pooled blobs are leased on demand
+    if (!pooledBlobs)
+        initBlobs();
+
+    // Each request keeps its own storage of the variables, the storage is shared with the MemoryInput
+    // nodes of the graph during the inference of the request (see PushStates).
     for (auto& node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
             if (!memoryNode) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
             }
-            auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
-
-            // Remove suffix with pair ID. Internal information.
-            auto suffix_idx = state_name.find("/id=");
-            if (suffix_idx != std::string::npos)
-                state_name = state_name.substr(0, suffix_idx);
+            memoryStates.emplace_back(new MKLDNNVariableState(memoryNode->getVariableName(), memoryNode->createState(),
+                                                              memoryNode->getStatePrecision(), memoryNode->getOutputShapeAtPort(0)));
+        }
+    }
+}
 
-            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequestBase::allocateBlob(const std::string& name,
+                                                                           const InferenceEngine::TensorDesc& desc) {
+    if (pooledBlobs) {
+        leasedBlobs.insert(name);
+        // the user still holds the blob released before, so its data is kept
+        auto released = releasedBlobs.find(name);
+        if (released != releasedBlobs.end()) {
+            auto blob = released->second.lock();
+            releasedBlobs.erase(released);
+            if (blob && blob->getTensorDesc() == desc)
+                return blob;
         }
     }
+
+    auto blob = make_blob_with_precision(desc, blobAllocator);
+    blob->allocate();
+    return blob;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::forgetLease(const std::string& name) {
+    leasedBlobs.erase(name);
+    releasedBlobs.erase(name);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::releaseBlob(const std::string& name) {
+    InferenceEngine::Blob::Ptr blob;
+    auto input = _inputs.find(name);
+    if (input != _inputs.end()) {
+        blob = input->second;
+        _inputs.erase(input);
+    }
+    auto output = _outputs.find(name);
+    if (output != _outputs.end()) {
+        blob = output->second;
+        _outputs.erase(output);
+    }
+    _preProcData.erase(name);
+    leasedBlobs.erase(name);
+    if (blob)
+        releasedBlobs[name] = blob;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::ReleaseBlobs() {
+    if (leasedBlobs.empty())
+        return;
+    // the nodes executed for the inputs marked ready may use the released blobs
+    resetReadyInputs();
+    const std::vector<std::string> leased(leasedBlobs.begin(), leasedBlobs.end());
+    for (const auto& name : leased)
+        releaseBlob(name);
 }
 
 MKLDNNPlugin::MKLDNNInferRequestBase::~MKLDNNInferRequestBase() {
+    waitReadyExecution();
     --(execNetwork->_numRequests);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequestBase::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
+void MKLDNNPlugin::MKLDNNInferRequestBase::SetInputReady(const std::string& name) {
+    if (_inputs.find(name) == _inputs.end())
+        IE_THROW(NotAllocated) << "Input blob with name: \'" << name << "\' is not set";
+
+    std::lock_guard<std::mutex> lock(readyMutex);
+    if (!readyInputs.insert(name).second)
+        return;
+
+    // the execution takes the blobs and the pointers of the user now, so it does not read the maps of the request
+    // the user may change meanwhile. The preprocessing is done for all the inputs at once at the inference.
+    ReadyInputs ready;
+    for (const auto& readyName : readyInputs) {
+        auto input = _inputs.find(readyName);
+        if (input != _inputs.end() && !_preProcData.count(readyName))
+            ready.blobs.insert(*input);
+    }
+    for (const auto& ptr : externalPtr) {
+        if (readyInputs.count(ptr.first) || _networkOutputs.count(ptr.first))
+            ready.externalPtr.insert(ptr);
+    }
+
+    // the executions are chained, each one continues from the position the previous one stopped at
+    auto previous = readyExecution;
+    auto task = std::make_shared<std::packaged_task<void()>>([this, previous, ready] {
+        if (previous.valid())
+            previous.wait();
+        executeReady(ready);
+    });
+    readyExecution = task->get_future().share();
+    // scheduled as the inference, so it is drained when the streams of the network are reconfigured
+    execNetwork->_scheduledExecutor->run([task] {
+        (*task)();
+    });
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::executeReady(const ReadyInputs& ready) {
+    // the graph of the stream running the execution, the graph member is owned by the inference of the request
+    auto graphLock = execNetwork->GetGraph();
+    auto& streamGraph = graphLock._graph;
+    // the memory of the dynamic inputs is redefined at the inference only
+    if (streamGraph.hasDynamicInput() || streamGraph.getProperty().batchLimit > 0)
+        return;
+
+    std::unordered_set<std::string> pushed;
+    size_t position = 0;
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        // another request used the graph since, so the nodes are executed again
+        if (readyGraph == &streamGraph && readyGraphExecutions == streamGraph.GetExecutionsCount()) {
+            pushed = pushedInputs;
+            position = readyPosition;
+        }
+    }
+
+    changeDefaultPtr(streamGraph, ready.externalPtr);
+    for (const auto& input : ready.blobs) {
+        if (pushed.insert(input.first).second)
+            PushInputData(streamGraph, input);
+    }
+    position = streamGraph.InferReady(this, pushed, position);
+
+    std::lock_guard<std::mutex> lock(readyMutex);
+    pushedInputs = std::move(pushed);
+    readyPosition = position;
+    readyGraph = &streamGraph;
+    readyGraphExecutions = streamGraph.GetExecutionsCount();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::waitReadyExecution() {
+    std::shared_future<void> execution;
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        execution = readyExecution;
+    }
+    if (execution.valid())
+        execution.wait();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::resetReadyInputs() {
+    waitReadyExecution();
+    std::lock_guard<std::mutex> lock(readyMutex);
+    readyExecution = {};
+    readyInputs.clear();
+    pushedInputs.clear();
+    readyGraph = nullptr;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::replaceReadyBlob(const std::string& name) {
+    bool ready = false;
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        ready = readyInputs.count(name) != 0;
+    }
+    // the nodes executed for the inputs marked ready may use the replaced blob
+    if (ready || _networkOutputs.count(name))
+        resetReadyInputs();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::PushInputData(const std::unordered_set<std::string>& pushed) {
+    for (const auto& input : _inputs) {
+        if (!pushed.count(input.first))
+            PushInputData(*graph, input);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::pushInput(MKLDNNGraph& currentGraph,
+                                                     const std::string& inputName,
+                                                     InferenceEngine::Blob::Ptr& inputBlob,
+                                                     InferenceEngine::Precision inPrec) {
     auto& tensorDesc = inputBlob->getTensorDesc();
     bool needConvert = inPrec != tensorDesc.getPrecision();
 
@@ -73,7 +237,7 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::pushInput(const std::string& inputNam
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, tensorDesc.getDims(), tensorDesc.getLayout()));
+        iconv = make_blob_with_precision(InferenceEngine::TensorDesc(inPrec, tensorDesc.getDims(), tensorDesc.getLayout()), blobAllocator);
         iconv->allocate();
         if (inputBlob->size() != iconv->size())
             IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
@@ -86,7 +250,7 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::pushInput(const std::string& inputNam
         cpu_convert(srcData, dstData, tensorDesc.getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    currentGraph.PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
 void MKLDNNPlugin::MKLDNNInferRequestBase::PushStates() {
@@ -96,37 +260,15 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::PushStates() {
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
             }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
-    }
-}
-
-void MKLDNNPlugin::MKLDNNInferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto cur_id = cur_node->getId();
+            auto cur_name = cur_node->getVariableName();
             for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                if (state->GetName() == cur_name) {
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast the state " << cur_name << " to MKLDNNVariableState";
+                    }
+                    // the node works with the storage of the request directly, so there is nothing to pull back
+                    cur_node->setState(cur_state->getStorage());
                 }
             }
         }
@@ -146,42 +288,226 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::redefineMemoryForInputNodes() {
     }
 }
 
+// the batch is the outermost dimension of the dense planar blobs, so the samples of a micro-batch are contiguous
+static bool isBatchSliceable(const InferenceEngine::TensorDesc& desc) {
+    const auto layout = desc.getLayout();
+    if (desc.getDims().empty() ||
+        MKLDNNPlugin::one_of(layout, InferenceEngine::Layout::ANY, InferenceEngine::Layout::BLOCKED, InferenceEngine::Layout::SCALAR))
+        return false;
+    const auto dense = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), layout).getBlockingDesc();
+    return desc.getBlockingDesc() == dense && dense.getOrder()[0] == 0;
+}
+
+static InferenceEngine::Blob::Ptr sliceBatch(const InferenceEngine::Blob::Ptr& blob, size_t from, size_t size) {
+    const auto& desc = blob->getTensorDesc();
+    auto dims = desc.getDims();
+    const auto sampleSize = blob->byteSize() / dims[0];
+    dims[0] = size;
+    return make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims, desc.getLayout()),
+                                    blob->buffer().as<uint8_t*>() + from * sampleSize);
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequestBase::canSplitBatch() const {
+    const auto microBatch = static_cast<size_t>(graph->getProperty().microBatch);
+    if (microBatch == 0 || !graph->hasDynamicInput() || !graph->hasIndependentSamples() || memoryStates.size() != 0 ||
+        _inputs.empty())
+        return false;
+
+    const auto batch = _inputs.begin()->second->getTensorDesc().getDims();
+    if (batch.empty() || batch[0] <= microBatch)
+        return false;
+    // the batch dimension of the graph is dynamic, so the replicas take the micro-batches without recompilation
+    const auto& inputNodes = graph->GetInputNodesMap();
+    for (const auto& input : _inputs) {
+        const auto& desc = input.second->getTensorDesc();
+        const auto node = inputNodes.find(input.first);
+        if (node == inputNodes.end() || !isBatchSliceable(desc) || desc.getDims()[0] != batch[0] ||
+            graph->hasMeanImageFor(input.first) || normToInputSupportedPrec(input) != desc.getPrecision() ||
+            node->second->getOutputShapeAtPort(0).getRank() == 0 ||
+            node->second->getOutputShapeAtPort(0).getDims()[0] != Shape::UNDEFINED_DIM)
+            return false;
+    }
+    const auto& outputNodes = graph->GetOutputNodesMap();
+    for (const auto& output : _outputs) {
+        const auto node = outputNodes.find(output.first);
+        if (node == outputNodes.end() || output.second->getTensorDesc().getLayout() == InferenceEngine::Layout::ANY ||
+            node->second->getInputShapeAtPort(0).getRank() == 0 ||
+            node->second->getInputShapeAtPort(0).getDims()[0] != Shape::UNDEFINED_DIM)
+            return false;
+    }
+    return true;
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequestBase::inferMicroBatches() {
+    const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
+    const auto microBatch = static_cast<size_t>(graph->getProperty().microBatch);
+    const auto microBatches = (batch + microBatch - 1) / microBatch;
+    const auto workers = std::min<size_t>(microBatches, std::max(1, InferenceEngine::parallel_get_max_threads()));
+    // the graph of the stream runs its share of the micro-batches too
+    auto replicas = execNetwork->GetMicroBatchGraphs(workers - 1);
+
+    // the output blobs are reshaped for the whole batch by the first micro-batch inferred
+    std::mutex outputsMutex;
+    std::map<std::string, InferenceEngine::SizeVector> outputDims;
+    std::atomic<bool> mismatch{false};
+    auto shapeOutputs = [&](MKLDNNGraph& replica, size_t size) {
+        std::lock_guard<std::mutex> lock(outputsMutex);
+        for (const auto& output : replica.GetOutputNodesMap()) {
+            auto dims = output.second->getParentEdgeAt(0)->getMemory().getStaticDims();
+            if (dims.empty() || dims[0] != size) {
+                mismatch = true;
+                return;
+            }
+            dims[0] = batch;
+            auto shaped = outputDims.find(output.first);
+            if (shaped == outputDims.end()) {
+                auto& blob = _outputs[output.first];
+                if (blob->getTensorDesc().getDims() != dims)
+                    blob->setShape(dims);
+                if (!isBatchSliceable(blob->getTensorDesc())) {
+                    mismatch = true;
+                    return;
+                }
+                outputDims[output.first] = dims;
+            } else if (shaped->second != dims) {
+                mismatch = true;
+                return;
+            }
+        }
+    };
+
+    // the samples are read from the input blobs and the results are written to the output ones in place,
+    // the same copies as for the whole batch
+    auto inferMicroBatch = [&](MKLDNNGraph& replica, size_t index) {
+        const auto from = index * microBatch;
+        const auto size = std::min(microBatch, batch - from);
+        const auto& inputNodes = replica.GetInputNodesMap();
+        for (const auto& input : _inputs) {
+            auto slice = sliceBatch(input.second, from, size);
+            inputNodes.at(input.first)->redefineOutputMemory({slice->getTensorDesc().getDims()});
+            replica.PushInputData(input.first, slice);
+        }
+        replica.Infer(this);
+        shapeOutputs(replica, size);
+        if (mismatch)
+            return;
+        InferenceEngine::BlobMap outputs;
+        for (const auto& output : _outputs)
+            outputs[output.first] = sliceBatch(output.second, from, size);
+        replica.PullOutputData(outputs);
+    };
+
+    std::vector<std::exception_ptr> exceptions(workers);
+    InferenceEngine::parallel_nt(static_cast<int>(workers), [&](const int ithr, const int nthr) {
+        MKLDNNGraph& replica = ithr == 0 ? *graph : replicas[ithr - 1]._graph;
+        try {
+            for (size_t index = ithr; index < microBatches && !mismatch; index += nthr)
+                inferMicroBatch(replica, index);
+        } catch (...) {
+            exceptions[ithr] = std::current_exception();
+        }
+    });
+    for (const auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+    if (mismatch)
+        return false;
+
+    resetReadyInputs();
+    ThrowIfCanceled();
+    return true;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequestBase::InferImpl() {
+    try {
+        infer();
+    } catch (const InferenceEngine::InferCancelled&) {
+        // the numbers of the aborted inferences are reported to drive the load shedding
+        const auto requestDeadline = deadline.load();
+        if (requestDeadline != noDeadline && std::chrono::steady_clock::now().time_since_epoch().count() >= requestDeadline)
+            execNetwork->_expiredInferences++;
+        else
+            execNetwork->_cancelledInferences++;
+        throw;
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::infer() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    // the inference waiting in the queues past its deadline is dropped before it takes the graph
+    ThrowIfCanceled();
+    // the nodes depending only on the inputs marked ready may be executed already
+    waitReadyExecution();
+    // the synchronous inference is not drained by the scheduler, so it holds the reconfiguration of the streams itself
+    MKLDNNExecNetwork::RunningInference runningInference{*execNetwork};
+    // the inputs of the shapes of a bucket are inferred by the static graph of the bucket
+    auto graphLock = execNetwork->GetGraph(execNetwork->findShapeBucket(_inputs));
     graph = &(graphLock._graph);
+    bool resumed = false;
+    std::unordered_set<std::string> pushed;
+    size_t position = 0;
+    {
+        std::lock_guard<std::mutex> lock(readyMutex);
+        resumed = readyGraph == graph && readyGraphExecutions == graph->GetExecutionsCount();
+        if (resumed) {
+            pushed = pushedInputs;
+            position = readyPosition;
+        }
+    }
 
     ThrowIfCanceled();
 
-    if (graph->hasDynamicInput()) {
-        redefineMemoryForInputNodes();
-    } else if (graph->getProperty().isNewApi && graph->getProperty().batchLimit > 0) {
-        const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
-        SetBatch(batch);
-    }
+    // the blobs the user has not asked for are leased for the inference
+    if (pooledBlobs)
+        initBlobs();
+
+    // the large batches are split into the micro-batches run concurrently by the graph replicas
+    const bool split = !resumed && canSplitBatch();
+    if (split)
+        execDataPreprocessing(_inputs);
+
+    // the micro-batches are not run if the outputs turn out not to follow the batch of the inputs
+    if (!split || !inferMicroBatches()) {
+        if (graph->hasDynamicInput()) {
+            redefineMemoryForInputNodes();
+        } else if (graph->getProperty().isNewApi && graph->getProperty().batchLimit > 0) {
+            const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
+            SetBatch(batch);
+        }
 
-    execDataPreprocessing(_inputs);
+        if (!split)
+            execDataPreprocessing(_inputs);
 
-    changeDefaultPtr();
+        changeDefaultPtr(*graph, externalPtr);
 
-    ThrowIfCanceled();
+        ThrowIfCanceled();
 
-    PushInputData();
+        PushInputData(pushed);
 
-    if (memoryStates.size() != 0) {
-        PushStates();
-    }
+        if (memoryStates.size() != 0) {
+            PushStates();
+        }
 
-    graph->Infer(this);
+        graph->Infer(this, position);
+        resetReadyInputs();
 
-    if (memoryStates.size() != 0) {
-        PullStates();
-    }
+        ThrowIfCanceled();
 
-    ThrowIfCanceled();
+        graph->PullOutputData(_outputs);
+    }
 
-    graph->PullOutputData(_outputs);
+    // the inputs are consumed, so they are given back while the outputs are kept until ReleaseBlobs()
+    if (pooledBlobs) {
+        std::vector<std::string> consumed;
+        for (const auto& name : leasedBlobs) {
+            if (_inputs.count(name) && !_outputs.count(name))
+                consumed.push_back(name);
+        }
+        for (const auto& name : consumed)
+            releaseBlob(name);
+    }
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequestBase::GetPerformanceCounts() const {
@@ -196,9 +522,10 @@ static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *
     edge->getMemoryPtr()->setDataHandle(newPtr);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequestBase::changeDefaultPtr() {
-    for (auto& it : externalPtr) {
-        const auto& inputNodesMap = graph->GetInputNodesMap();
+void MKLDNNPlugin::MKLDNNInferRequestBase::changeDefaultPtr(MKLDNNGraph& currentGraph,
+                                                            const std::unordered_map<std::string, void*>& ptrs) {
+    for (auto& it : ptrs) {
+        const auto& inputNodesMap = currentGraph.GetInputNodesMap();
         auto input = inputNodesMap.find(it.first);
         if (input != inputNodesMap.end()) {
             MKLDNNNodePtr inputNodePtr = input->second;
@@ -266,7 +593,7 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::changeDefaultPtr() {
             continue;
         }
 
-        const auto& outputNodesMap = graph->GetOutputNodesMap();
+        const auto& outputNodesMap = currentGraph.GetOutputNodesMap();
         auto output = outputNodesMap.find(it.first);
         if (output != outputNodesMap.end()) {
             auto parentEdge = output->second->getParentEdgeAt(0);
@@ -313,10 +640,19 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::SetAsyncRequest(MKLDNNAsyncInferReque
     _asyncRequest = asyncRequest;
 }
 
+void MKLDNNPlugin::MKLDNNInferRequestBase::SetDeadline(const std::chrono::steady_clock::time_point& deadline_) {
+    deadline = deadline_.time_since_epoch().count();
+}
+
 void MKLDNNPlugin::MKLDNNInferRequestBase::ThrowIfCanceled() const {
     if (_asyncRequest != nullptr) {
         _asyncRequest->ThrowIfCanceled();
     }
+    // the clock is not read for the requests without a deadline, this is called between the nodes
+    const auto requestDeadline = deadline.load(std::memory_order_relaxed);
+    if (requestDeadline != noDeadline && std::chrono::steady_clock::now().time_since_epoch().count() >= requestDeadline) {
+        IE_THROW(InferCancelled) << "The deadline of the inference has passed";
+    }
 }
 
 InferenceEngine::Precision
@@ -375,6 +711,9 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, co
     if (name.empty()) {
         IE_THROW(NotFound) << "Failed to set blob with empty name";
     }
+    // the blob of the user replaces the leased one
+    forgetLease(name);
+    replaceReadyBlob(name);
 
     if (!data)
         IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
@@ -532,10 +871,9 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
                 InferenceEngine::TensorDesc desc = _networkInputs[name]->getTensorDesc();
                 bool isDynamic = input->second->isDynamicNode();
 
-                _inputs[name] = make_blob_with_precision(desc);
-                _inputs[name]->allocate();
+                _inputs[name] = allocateBlob(name, desc);
 
-                if (!isDynamic &&
+                if (!isDynamic && !pooledBlobs &&
                     desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
                         graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                     externalPtr[name] = _inputs[name]->buffer();
@@ -577,8 +915,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
                         InferenceEngine::TensorDesc desc = _networkOutputs[name]->getTensorDesc();
                         desc.setPrecision(normalizeToSupportedPrecision(desc.getPrecision()));
 
-                        data = make_blob_with_precision(desc);
-                        data->allocate();
+                        data = allocateBlob(name, desc);
                     } else {
                         const auto &expectedTensorDesc = isDynamic ? InferenceEngine::TensorDesc(desc.getPrecision(),
                                                                                                  InferenceEngine::TensorDesc::getLayoutByRank(
@@ -613,7 +950,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
                     }
 
                     _outputs[name] = data;
-                    if (!isDynamic && !externalPtr.count(name) && data->getTensorDesc() == MemoryDescUtils::convertToTensorDesc(desc) &&
+                    if (!isDynamic && !pooledBlobs && !externalPtr.count(name) && data->getTensorDesc() == MemoryDescUtils::convertToTensorDesc(desc) &&
                         !graph->getProperty().batchLimit) {
                         externalPtr[name] = data->buffer();
                     }
@@ -635,22 +972,21 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNLegacyInferRequest::GetBlob(const
     return data;
 }
 
-void MKLDNNPlugin::MKLDNNLegacyInferRequest::PushInputData() {
-    for (auto input : _inputs) {
-        auto inputName = input.first;
-        if (!_networkInputs[inputName]) {
-            IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << inputName;
-        }
-
-        // User can initialize input via setBlob API using tensorDesc with default (ANY) layout.
-        // Currently IE doesn't specify behavior in such scenario, so we assume real layout is equal to the network input.
-        auto inputBlob = input.second;
-        if (inputBlob->getTensorDesc().getLayout() == InferenceEngine::ANY) {
-            inputBlob->getTensorDesc().setLayout(_networkInputs[inputName]->getLayout());
-        }
+void MKLDNNPlugin::MKLDNNLegacyInferRequest::PushInputData(MKLDNNGraph& currentGraph,
+                                                           const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) {
+    const auto& inputName = input.first;
+    if (!_networkInputs[inputName]) {
+        IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << inputName;
+    }
 
-        pushInput(inputName, inputBlob, normToInputSupportedPrec(input));
+    // User can initialize input via setBlob API using tensorDesc with default (ANY) layout.
+    // Currently IE doesn't specify behavior in such scenario, so we assume real layout is equal to the network input.
+    auto inputBlob = input.second;
+    if (inputBlob->getTensorDesc().getLayout() == InferenceEngine::ANY) {
+        inputBlob->getTensorDesc().setLayout(_networkInputs[inputName]->getLayout());
     }
+
+    pushInput(currentGraph, inputName, inputBlob, normToInputSupportedPrec(input));
 }
 
 /* ========================================== MKLDNNInferRequest ========================================== */
@@ -698,6 +1034,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     if (name.empty()) {
         IE_THROW(NotFound) << "Failed to set blob with empty name";
     }
+    // the blob of the user replaces the leased one
+    forgetLease(name);
+    replaceReadyBlob(name);
 
     if (!data)
         IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
@@ -821,10 +1160,9 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
-                _inputs[name]->allocate();
+                _inputs[name] = allocateBlob(name, desc);
 
-                if (!isDynamic &&
+                if (!isDynamic && !pooledBlobs &&
                     desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
                         graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                     externalPtr[name] = _inputs[name]->buffer();
@@ -856,8 +1194,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
-                    data->allocate();
+                    data = allocateBlob(name, desc);
                 } else {
                     if (!shape.compatible(ov::PartialShape(data->getTensorDesc().getDims()))) {
                         IE_THROW(ParameterMismatch) << "Network input and output use the same name: " << name << ", but expect blobs with different shapes.";
@@ -873,7 +1210,7 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
                 }
 
                 _outputs[name] = data;
-                if (!isDynamic && !externalPtr.count(name) &&
+                if (!isDynamic && !pooledBlobs && !externalPtr.count(name) &&
                     data->getTensorDesc() == MemoryDescUtils::convertToTensorDesc(output->second->getParentEdgesAtPort(0)[0]->getMemory().getDesc()) &&
                         !graph->getProperty().batchLimit) {
                     externalPtr[name] = data->buffer();
@@ -892,13 +1229,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     return data;
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
-    for (auto input : _inputs) {
-        auto inputName = input.first;
-        if (!modelInputsMap[inputName]) {
-            IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << inputName;
-        }
-
-        pushInput(inputName, input.second, normToInputSupportedPrec(input));
+void MKLDNNPlugin::MKLDNNInferRequest::PushInputData(MKLDNNGraph& currentGraph,
+                                                     const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) {
+    const auto& inputName = input.first;
+    if (!modelInputsMap[inputName]) {
+        IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << inputName;
     }
+
+    auto inputBlob = input.second;
+    pushInput(currentGraph, inputName, inputBlob, normToInputSupportedPrec(input));
 }
@@ -5,9 +5,15 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <map>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <unordered_set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -32,7 +38,24 @@ public:
     void SetAsyncRequest(MKLDNNAsyncInferRequest* asyncRequest);
 
     /**
-     * @brief If `_asyncRequest` is initialized throw exception with `InferenceEngine::INFER_CANCELLED` status if inference request is canceled
+     * @brief Gives the input and output blobs leased from the pool of the network (see CPU_POOLED_REQUEST_BLOBS) back.
+     * The memory is reused by the other requests once the user does not hold the blobs as well, the blobs still
+     * held are taken back by the next GetBlob or inference. Does nothing if the blobs are not pooled.
+     */
+    void ReleaseBlobs() override;
+
+    /**
+     * @brief Marks the input as ready for the next inference. The nodes depending only on the ready inputs
+     * are executed on the streams of the network while the rest of the inputs are being prepared, the next
+     * inference starts from the first node not executed. The blob of the input must not be changed until then.
+     */
+    void SetInputReady(const std::string& name) override;
+
+    void SetDeadline(const std::chrono::steady_clock::time_point& deadline) override;
+
+    /**
+     * @brief Throws exception with `InferenceEngine::INFER_CANCELLED` status if inference request is canceled
+     * (when `_asyncRequest` is initialized) or the deadline of the inference has passed
      */
     void ThrowIfCanceled() const;
 
@@ -49,24 +72,72 @@ protected:
 
     void CreateInferRequest();
     InferenceEngine::Precision normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const;
-    void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    void pushInput(MKLDNNGraph& currentGraph, const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob,
+                   InferenceEngine::Precision dataType);
 
     virtual void initBlobs() = 0;
-    virtual void PushInputData() = 0;
+    // the graph is passed explicitly, as the inputs marked ready are pushed to the graph of another stream
+    virtual void PushInputData(MKLDNNGraph& currentGraph, const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) = 0;
+    // discards the nodes executed for the inputs marked ready
+    void resetReadyInputs();
+    // discards them if they may use the blob replaced by the user
+    void replaceReadyBlob(const std::string& name);
 
     MKLDNNGraph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
+    // allocates the input and output blobs on the NUMA node of the graph the request is created for,
+    // or leases them from the pool of the network
+    std::shared_ptr<InferenceEngine::IAllocator> blobAllocator;
+    bool pooledBlobs = false;
+
+    InferenceEngine::Blob::Ptr allocateBlob(const std::string& name, const InferenceEngine::TensorDesc& desc);
+    void forgetLease(const std::string& name);
 
 private:
+    void releaseBlob(const std::string& name);
+
+    // blobs allocated by the request from the pool and the released ones the user may still hold
+    std::unordered_set<std::string> leasedBlobs;
+    std::unordered_map<std::string, std::weak_ptr<InferenceEngine::Blob>> releasedBlobs;
+
+    void PushInputData(const std::unordered_set<std::string>& pushed);
     void PushStates();
-    void PullStates();
     void redefineMemoryForInputNodes();
-
-    void changeDefaultPtr();
+    // the batch of the inputs is split into the micro-batches of CPU_MICRO_BATCH run by the graph replicas
+    // of the network concurrently, if the batch dimension of the graph is dynamic
+    bool canSplitBatch() const;
+    bool inferMicroBatches();
+
+    // the blobs of the inputs marked ready and the pointers of the user, as they were when the input was marked
+    struct ReadyInputs {
+        InferenceEngine::BlobMap blobs;
+        std::unordered_map<std::string, void*> externalPtr;
+    };
+    void executeReady(const ReadyInputs& ready);
+    void waitReadyExecution();
+
+    // the partial execution of the graph for the inputs marked ready (see SetInputReady),
+    // the state is shared with the executions running on the streams, so it is guarded by the mutex
+    std::mutex readyMutex;
+    std::unordered_set<std::string> readyInputs;
+    std::unordered_set<std::string> pushedInputs;
+    std::shared_future<void> readyExecution;
+    const MKLDNNGraph* readyGraph = nullptr;
+    size_t readyGraphExecutions = 0;
+    size_t readyPosition = 0;
+
+    void changeDefaultPtr(MKLDNNGraph& currentGraph, const std::unordered_map<std::string, void*>& ptrs);
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    // the steady clock ticks, atomic as the inputs marked ready are processed by the streams.
+    // The ticks of std::chrono::steady_clock::time_point::max() mean no deadline
+    static constexpr std::chrono::steady_clock::rep noDeadline = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+    std::atomic<std::chrono::steady_clock::rep> deadline{noDeadline};
+
+private:
+    void infer();
 };
 
 class MKLDNNLegacyInferRequest : public MKLDNNInferRequestBase {
@@ -78,7 +149,7 @@ public:
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
 private:
-    void PushInputData() override;
+    void PushInputData(MKLDNNGraph& currentGraph, const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) override;
     void initBlobs() override;
     void SetBatch(int batch = -1) override;
 };
@@ -92,7 +163,7 @@ public:
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
 private:
-    void PushInputData() override;
+    void PushInputData(MKLDNNGraph& currentGraph, const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) override;
     void initBlobs() override;
     void SetBatch(int batch = -1) override;
 
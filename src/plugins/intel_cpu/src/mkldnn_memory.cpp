@@ -17,6 +17,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/huge_pages.h"
 
 using namespace InferenceEngine;
 using namespace mkldnn;
@@ -177,13 +178,14 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        const bool hugePages = HugePagesAllocator::isEligible(size);
+        void *ptr = hugePages ? HugePagesAllocator::allocate(size) : dnnl::impl::malloc(size, cacheLineSize);
         if (!ptr) {
             throw std::bad_alloc();
         }
         _memUpperBound = size;
         _useExternalStorage = false;
-        _data = decltype(_data)(ptr, destroy);
+        _data = decltype(_data)(ptr, hugePages ? HugePagesAllocator::free : destroy);
         sizeChanged = true;
     }
     return sizeChanged;
@@ -3,15 +3,47 @@
 //
 
 #include "mkldnn_memory_state.h"
-#include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
-void  MKLDNNVariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+void MKLDNNVariableState::Reset() {
+    // a dynamic state without dims takes the init value of the ReadValue on the next inference
+    storage->reset(shape.isStatic() ? shape.getStaticDims() : VectorDims{});
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    const auto& desc = newState->getTensorDesc();
+    if (desc.getPrecision() != precision)
+        IE_THROW() << "Cannot set the state " << name << " of precision " << precision << " by the blob of precision " << desc.getPrecision();
+    if (!shape.isCompatible(desc.getDims()))
+        IE_THROW() << "Cannot set the state " << name << " of shape " << shape.toString() << " by the blob of incompatible dims";
+
+    storage->assign(newState->cbuffer().as<const void*>(), desc.getDims());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    auto dims = storage->getDims();
+    const bool isSet = shape.isStatic() || !dims.empty();
+    if (!isSet) {
+        dims = shape.getDims();
+        for (auto& dim : dims) {
+            if (dim == Shape::UNDEFINED_DIM)
+                dim = 0;
+        }
+    }
+
+    auto blob = make_blob_with_precision(TensorDesc(precision, dims, TensorDesc::getLayoutByDims(dims)));
+    blob->allocate();
+    if (isSet)
+        storage->read(blob->buffer().as<void*>());
+    return blob;
+}
+
+void MKLDNNVariableState::Trim(size_t length) {
+    storage->trim(length);
 }
 
 }  // namespace MKLDNNPlugin
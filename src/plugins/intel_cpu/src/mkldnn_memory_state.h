@@ -5,25 +5,41 @@
 #pragma once
 
 #include "cpp_interfaces/interface/ie_ivariable_state_internal.hpp"
-#include "blob_factory.hpp"
-#include "mkldnn_memory.h"
-#include "nodes/common/cpu_memcpy.h"
-#include "memory_desc/cpu_memory_desc_utils.h"
+#include "cpu_shape.h"
+#include "nodes/common/state_buffer.h"
 
+#include <memory>
 #include <string>
 
 namespace MKLDNNPlugin {
 
+/**
+ * The variable state of an infer request. The storage is shared with the MemoryInput node during the inference
+ * of the request, so the state is neither copied to the graph nor back.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    MKLDNNVariableState(std::string name, std::shared_ptr<StateBuffer> storage, InferenceEngine::Precision precision, const Shape& shape) :
+            InferenceEngine::IVariableStateInternal{name}, storage(std::move(storage)), precision(precision), shape(shape) {}
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    /**
+     * Keeps the first length elements along the axis the state grows along, e.g. the first tokens of the past keys
+     * or values of a decoder. The data is not copied.
+     */
+    void Trim(size_t length);
+
+    const std::shared_ptr<StateBuffer>& getStorage() const {
+        return storage;
+    }
+
+private:
+    std::shared_ptr<StateBuffer> storage;
+    InferenceEngine::Precision precision;
+    Shape shape;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -514,6 +514,18 @@ void MKLDNNNode::execute(mkldnn::stream strm) {
     }
 }
 
+bool MKLDNNNode::capturePrimitive(Kernel& kernel, const MKLDNNPrimitive& primitive) const {
+    if (!primitive)
+        return false;
+    kernel.function = [](const void* primitive, const void* args, const mkldnn::stream& strm) {
+        static_cast<const mkldnn::primitive*>(primitive)->execute(
+            strm, *static_cast<const std::unordered_map<int, mkldnn::memory>*>(args));
+    };
+    kernel.kernel = primitive.get();
+    kernel.args = &primArgs;
+    return true;
+}
+
 void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
     if (needShapeInfer()) {
         redefineOutputMemory(shapeInfer());
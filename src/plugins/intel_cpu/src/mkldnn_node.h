@@ -332,6 +332,24 @@ public:
 
     virtual void execute(mkldnn::stream strm);
     void executeDynamic(mkldnn::stream strm);
+
+    /**
+     * @brief The kernel a static node runs on each inference and the arguments it is run with, as recorded by
+     * the graph replay
+     */
+    struct Kernel {
+        void (*function)(const void* kernel, const void* args, const mkldnn::stream& strm) = nullptr;
+        const void* kernel = nullptr;
+        const void* args = nullptr;
+    };
+
+    /**
+     * @brief Records the kernel the node runs on the inferences, so the graph can replay it instead of execute()
+     * @return false if the node does more than running the kernel on the same arguments, then it is executed as usual
+     */
+    virtual bool captureKernel(Kernel& kernel) const {
+        return false;
+    }
     void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
 
     virtual void initSupportedPrimitiveDescriptors();
@@ -588,6 +606,12 @@ protected:
 
     virtual AttrPtr initPrimitiveAttr() { return nullptr; }
 
+    // records the primitive run with primArgs, the one of the default execute() if not specified
+    bool capturePrimitive(Kernel& kernel) const {
+        return capturePrimitive(kernel, prim);
+    }
+    bool capturePrimitive(Kernel& kernel, const MKLDNNPrimitive& primitive) const;
+
     typedef std::function<DnnlMemoryDescPtr (mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx)>
             GetPrimitiveMemoryFormatFunc;
     std::vector<GetPrimitiveMemoryFormatFunc> internalBlobDesc;
@@ -115,6 +115,7 @@
 #include "nodes/mkldnn_normalize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
+#include "ngraph_transformations/scaled_attention_fusion.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -526,6 +527,8 @@ static void TransformationUpToCPUSpecificOpSet(const std::shared_ptr<ngraph::Fun
     });
 
     postLPTPassManager.register_pass<ngraph::pass::ConstantFolding>();
+    // must run before the snippets tokenization, which would take the scale and the mask eltwises
+    postLPTPassManager.register_pass<ScaledAttentionFusion>();
     postLPTPassManager.run_passes(nGraphFunc);
 
     if (!useLpt && _enableSnippets && with_cpu_x86_avx2()) {
@@ -755,6 +758,10 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = engConfig.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::hint::model_priority) {
+        const auto priority = engConfig.modelPriority;
+        return priority == 2 ? ov::hint::Priority::HIGH :
+               priority == 0 ? ov::hint::Priority::LOW : ov::hint::Priority::MEDIUM;
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -849,6 +856,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::inference_precision.name()),
                                                     RW_property(ov::hint::performance_mode.name()),
                                                     RW_property(ov::hint::num_requests.name()),
+                                                    RW_property(ov::hint::model_priority.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
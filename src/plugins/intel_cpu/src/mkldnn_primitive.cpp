@@ -17,6 +17,10 @@ mkldnn::primitive MKLDNNPrimitive::operator*() {
     return *prim;
 }
 
+const mkldnn::primitive* MKLDNNPrimitive::get() const {
+    return prim.get();
+}
+
 void MKLDNNPrimitive::reset(mkldnn::primitive* primitive) {
     prim.reset(primitive);
 }
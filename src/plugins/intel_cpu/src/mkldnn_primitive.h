@@ -18,6 +18,7 @@ public:
     operator bool() const;
     MKLDNNPrimitive& operator=(const std::shared_ptr<mkldnn::primitive>& primitive);
     mkldnn::primitive operator*();
+    const mkldnn::primitive* get() const;
     void reset(mkldnn::primitive* primitive);
 
 private:
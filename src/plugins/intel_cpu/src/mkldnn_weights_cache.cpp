@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_weights_cache.hpp"
+#include "utils/numa_memory.h"
 
 #include <ie_system_conf.h>
 #include <memory>
@@ -45,6 +46,9 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            // the object is filled by the thread of any stream, so it is moved to the node of the cache
+            if (numaNodeId >= 0 && newPtr && newPtr->isAllocated() && newPtr->getDesc().isDefined())
+                bindToNumaNode(newPtr->GetData(), newPtr->GetSize(), numaNodeId);
             ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -71,8 +75,12 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
 }
 
 NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+    for (auto numa_id : InferenceEngine::getAvailableNUMANodes()) {
+        const int boundNodeId = numaNodeForBinding(numa_id, true);
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(boundNodeId);
+        // nothing is bound on a single NUMA node, so both kinds of networks share the cache
+        _unbound_cache_map[numa_id] = boundNodeId < 0 ? _cache_map[numa_id] : std::make_shared<MKLDNNWeightsSharing>();
+    }
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -89,4 +97,13 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+MKLDNNWeightsSharing::Ptr& NumaNodesWeights::get(int numa_id, bool memoryBinding) {
+    if (memoryBinding)
+        return (*this)[numa_id];
+    auto found = _unbound_cache_map.find(numa_id);
+    if (found == _unbound_cache_map.end())
+        IE_THROW() << "Unknown numa node id " << numa_id;
+    return found->second;
+}
+
 }  // namespace MKLDNNPlugin
@@ -69,6 +69,9 @@ class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    // the created objects are placed on the NUMA node, -1 keeps the placement to the OS
+    explicit MKLDNNWeightsSharing(int numaNodeId = -1) : numaNodeId(numaNodeId) {}
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
@@ -95,10 +98,13 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    int getNumaNodeId() const { return numaNodeId; }
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
+    int numaNodeId;
 };
 
 /**
@@ -113,8 +119,13 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    // the cache of the streams on the NUMA node, its objects are placed on the node if the memory binding is enabled
+    MKLDNNWeightsSharing::Ptr& get(int i, bool memoryBinding);
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    // the networks compiled without the memory binding do not share the objects with the bound ones
+    std::map<int, MKLDNNWeightsSharing::Ptr> _unbound_cache_map;
 };
 
 }  // namespace MKLDNNPlugin
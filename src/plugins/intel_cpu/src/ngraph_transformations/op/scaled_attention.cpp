@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_attention.hpp"
+
+MKLDNNPlugin::ScaledAttentionNode::ScaledAttentionNode(const ngraph::Output<Node> &query,
+                                                       const ngraph::Output<Node> &key,
+                                                       const ngraph::Output<Node> &value,
+                                                       const float scale,
+                                                       const bool key_transposed)
+    : Op({query, key, value}), m_scale(scale), m_key_transposed(key_transposed) {
+    validate_and_infer_types();
+}
+
+MKLDNNPlugin::ScaledAttentionNode::ScaledAttentionNode(const ngraph::Output<Node> &query,
+                                                       const ngraph::Output<Node> &key,
+                                                       const ngraph::Output<Node> &value,
+                                                       const ngraph::Output<Node> &mask,
+                                                       const float scale,
+                                                       const bool key_transposed)
+    : Op({query, key, value, mask}), m_scale(scale), m_key_transposed(key_transposed) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                                   m_scale, m_key_transposed);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                                   m_scale, m_key_transposed);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for ScaledDotProductAttention operation");
+}
+
+void MKLDNNPlugin::ScaledAttentionNode::validate_and_infer_types() {
+    const auto inputsNumber = get_input_size();
+    NODE_VALIDATION_CHECK(this, inputsNumber == 3 || inputsNumber == 4,
+        "ScaledDotProductAttention must have 3 or 4 inputs, got: ", inputsNumber);
+
+    const auto& query = get_input_partial_shape(0);
+    const auto& key = get_input_partial_shape(1);
+    const auto& value = get_input_partial_shape(2);
+    NODE_VALIDATION_CHECK(this, query.rank().is_static() && key.rank().is_static() && value.rank().is_static(),
+        "ScaledDotProductAttention doesn't support dynamic ranks");
+
+    const auto rank = query.rank().get_length();
+    NODE_VALIDATION_CHECK(this, rank >= 2 && key.rank().get_length() == rank && value.rank().get_length() == rank,
+        "ScaledDotProductAttention inputs must have the same rank not less than 2");
+
+    const auto headSize = key[m_key_transposed ? rank - 2 : rank - 1];
+    NODE_VALIDATION_CHECK(this, query[rank - 1].compatible(headSize),
+        "ScaledDotProductAttention query and key have different head sizes");
+
+    ngraph::PartialShape batch(std::vector<ngraph::Dimension>(query.begin(), query.end() - 2));
+    for (const auto& shape : {key, value}) {
+        const ngraph::PartialShape inputBatch(std::vector<ngraph::Dimension>(shape.begin(), shape.end() - 2));
+        NODE_VALIDATION_CHECK(this, ngraph::PartialShape::broadcast_merge_into(batch, inputBatch, ngraph::op::AutoBroadcastType::NUMPY),
+            "ScaledDotProductAttention inputs have incompatible batch dimensions");
+    }
+
+    std::vector<ngraph::Dimension> outputDims(batch.begin(), batch.end());
+    outputDims.push_back(query[rank - 2]);
+    outputDims.push_back(value[rank - 1]);
+
+    // integer inputs are dequantized by the scale, so the result is always real
+    const auto& queryType = get_input_element_type(0);
+    set_output_type(0, queryType.is_real() ? queryType : ngraph::element::f32, ngraph::PartialShape(outputDims));
+}
+
+bool MKLDNNPlugin::ScaledAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("key_transposed", m_key_transposed);
+    return true;
+}
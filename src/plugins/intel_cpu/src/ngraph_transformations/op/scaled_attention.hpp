@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * softmax(scale * query x key^T + mask) x value, the mask input is optional and additive.
+ * query is [..., L, D], key is [..., S, D] or [..., D, S] if key_transposed is set, value is [..., S, Dv].
+ */
+class ScaledAttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledAttentionNode() = default;
+
+    ScaledAttentionNode(const ngraph::Output<Node> &query,
+                        const ngraph::Output<Node> &key,
+                        const ngraph::Output<Node> &value,
+                        float scale,
+                        bool key_transposed);
+
+    ScaledAttentionNode(const ngraph::Output<Node> &query,
+                        const ngraph::Output<Node> &key,
+                        const ngraph::Output<Node> &value,
+                        const ngraph::Output<Node> &mask,
+                        float scale,
+                        bool key_transposed);
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_key_transposed() const { return m_key_transposed; }
+
+private:
+    float m_scale = 1.f;
+    bool m_key_transposed = false;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_attention_fusion.hpp"
+#include "op/scaled_attention.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ScaledAttentionFusion, "ScaledAttentionFusion", 0);
+
+namespace {
+
+bool has_single_consumer(const ngraph::Output<ngraph::Node>& output) {
+    return output.get_target_inputs().size() == 1;
+}
+
+bool get_scalar_value(const ngraph::Output<ngraph::Node>& output, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+int64_t get_softmax_axis(const std::shared_ptr<ngraph::Node>& softmax, int64_t rank) {
+    if (auto softmax_v1 = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(softmax))
+        return static_cast<int64_t>(softmax_v1->get_axis());
+    auto axis = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(softmax)->get_axis();
+    return axis < 0 ? axis + rank : axis;
+}
+
+} // namespace
+
+MKLDNNPlugin::ScaledAttentionFusion::ScaledAttentionFusion() {
+    auto softmax_m = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(ngraph::pattern::has_static_rank());
+    auto value_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ softmax_m, value_m });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+
+        auto output_matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        if (!output_matmul || transformation_callback(output_matmul) ||
+            output_matmul->get_transpose_a() || output_matmul->get_transpose_b()) {
+            return false;
+        }
+
+        auto softmax = pattern_map.at(softmax_m).get_node_shared_ptr();
+        const auto rank = softmax->get_output_partial_shape(0).rank().get_length();
+        if (rank < 2 || !has_single_consumer(softmax->output(0)) || get_softmax_axis(softmax, rank) != rank - 1)
+            return false;
+
+        ngraph::NodeVector fused_nodes{softmax, output_matmul};
+        auto scores = softmax->input_value(0);
+
+        ngraph::Output<ngraph::Node> mask;
+        if (auto add = std::dynamic_pointer_cast<ngraph::opset1::Add>(scores.get_node_shared_ptr())) {
+            if (!has_single_consumer(scores) || add->get_autob() != ngraph::op::AutoBroadcastType::NUMPY)
+                return false;
+            // the scores come from the producer chain which ends with MatMul, the other input is the mask
+            auto is_scores_producer = [](const ngraph::Output<ngraph::Node>& output) {
+                const auto node = output.get_node_shared_ptr();
+                return std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node) ||
+                       std::dynamic_pointer_cast<ngraph::opset1::Multiply>(node) ||
+                       std::dynamic_pointer_cast<ngraph::opset1::Divide>(node);
+            };
+            const size_t scores_port = is_scores_producer(add->input_value(0)) ? 0 : 1;
+            mask = add->input_value(1 - scores_port);
+            scores = add->input_value(scores_port);
+
+            const auto& mask_shape = mask.get_partial_shape();
+            if (mask_shape.rank().is_dynamic() || mask_shape.rank().get_length() > rank ||
+                !add->get_output_partial_shape(0).same_scheme(scores.get_partial_shape()))
+                return false;
+            fused_nodes.push_back(add);
+        }
+
+        // dequantization and normalization scales may follow each other
+        float scale = 1.f;
+        while (true) {
+            auto node = scores.get_node_shared_ptr();
+            float value = 0.f;
+            if (std::dynamic_pointer_cast<ngraph::opset1::Multiply>(node) && has_single_consumer(scores)) {
+                const size_t scale_port = get_scalar_value(node->input_value(1), value) ? 1 : 0;
+                if (!get_scalar_value(node->input_value(scale_port), value))
+                    return false;
+                scale *= value;
+                scores = node->input_value(1 - scale_port);
+            } else if (std::dynamic_pointer_cast<ngraph::opset1::Divide>(node) && has_single_consumer(scores)) {
+                if (!get_scalar_value(node->input_value(1), value) || value == 0.f)
+                    return false;
+                scale /= value;
+                scores = node->input_value(0);
+            } else {
+                break;
+            }
+            fused_nodes.push_back(node);
+        }
+
+        auto qk_matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(scores.get_node_shared_ptr());
+        if (!qk_matmul || !has_single_consumer(scores) || qk_matmul->get_transpose_a())
+            return false;
+        fused_nodes.push_back(qk_matmul);
+
+        const auto query = qk_matmul->input_value(0);
+        const auto key = qk_matmul->input_value(1);
+        const auto value = pattern_map.at(value_m);
+        for (const auto& input : {query, key, value}) {
+            const auto& shape = input.get_partial_shape();
+            if (shape.rank().is_dynamic() || shape.rank().get_length() != rank)
+                return false;
+        }
+
+        const bool key_transposed = !qk_matmul->get_transpose_b();
+        std::shared_ptr<ngraph::Node> attention;
+        if (mask.get_node()) {
+            attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(query, key, value, mask, scale, key_transposed);
+        } else {
+            attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(query, key, value, scale, key_transposed);
+        }
+
+        attention->set_friendly_name(output_matmul->get_friendly_name());
+        ngraph::copy_runtime_info(fused_nodes, attention);
+        ngraph::replace_node(output_matmul, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "ScaledAttentionFusion");
+    this->register_matcher(m, callback);
+}
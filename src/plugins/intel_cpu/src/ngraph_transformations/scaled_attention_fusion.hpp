@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     MatMul(query, key) -> [Multiply/Divide by scalar] -> [Add(mask)] -> Softmax(last axis) -> MatMul(value)
+ *     is replaced with ScaledAttentionNode, so the attention scores are never materialized.
+ */
+class ScaledAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledAttentionFusion();
+};
+
+}  // namespace MKLDNNPlugin
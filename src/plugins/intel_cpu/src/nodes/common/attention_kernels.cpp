@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "attention_kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// the keys of one block stay in L1 while all the query rows of the block are processed
+constexpr size_t keyBlock = 64;
+
+inline float dot(const float* a, const float* b, size_t size) {
+    size_t i = 0;
+    float sum = 0.f;
+#if defined(HAVE_AVX512F)
+    __m512 acc = _mm512_setzero_ps();
+    for (; i + 16 <= size; i += 16)
+        acc = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc);
+    if (i < size) {
+        const __mmask16 tail = static_cast<__mmask16>((1u << (size - i)) - 1);
+        acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, a + i), _mm512_maskz_loadu_ps(tail, b + i), acc);
+        i = size;
+    }
+    sum = _mm512_reduce_add_ps(acc);
+#elif defined(HAVE_AVX2)
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= size; i += 8)
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc);
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    half = _mm_add_ss(half, _mm_movehdup_ps(half));
+    sum = _mm_cvtss_f32(half);
+#endif
+    for (; i < size; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+// y = y * beta + alpha * x
+inline void scale_add(float* y, float beta, float alpha, const float* x, size_t size) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 vAlpha = _mm512_set1_ps(alpha);
+    const __m512 vBeta = _mm512_set1_ps(beta);
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(vAlpha, _mm512_loadu_ps(x + i), _mm512_mul_ps(vBeta, _mm512_loadu_ps(y + i))));
+#elif defined(HAVE_AVX2)
+    const __m256 vAlpha = _mm256_set1_ps(alpha);
+    const __m256 vBeta = _mm256_set1_ps(beta);
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(vAlpha, _mm256_loadu_ps(x + i), _mm256_mul_ps(vBeta, _mm256_loadu_ps(y + i))));
+#endif
+    for (; i < size; i++)
+        y[i] = y[i] * beta + alpha * x[i];
+}
+
+}  // namespace
+
+void scaled_attention_rows(const float* query, size_t rows, const float* key, const float* value,
+                           const float* mask, size_t maskRowStride, size_t maskColStride,
+                           size_t seqLen, size_t headSize, size_t valueSize, float scale, float* output, float* scratch) {
+    float* maxima = scratch;
+    float* sums = scratch + rows;
+    float* scores = scratch + 2 * rows;
+
+    std::fill(maxima, maxima + rows, -std::numeric_limits<float>::infinity());
+    std::fill(sums, sums + rows, 0.f);
+    std::fill(output, output + rows * valueSize, 0.f);
+
+    for (size_t blockStart = 0; blockStart < seqLen; blockStart += keyBlock) {
+        const size_t blockSize = std::min(keyBlock, seqLen - blockStart);
+        const float* blockKey = key + blockStart * headSize;
+        const float* blockValue = value + blockStart * valueSize;
+
+        for (size_t row = 0; row < rows; row++) {
+            const float* rowQuery = query + row * headSize;
+            float* rowOutput = output + row * valueSize;
+
+            float blockMax = -std::numeric_limits<float>::infinity();
+            for (size_t j = 0; j < blockSize; j++) {
+                float score = scale * dot(rowQuery, blockKey + j * headSize, headSize);
+                if (mask)
+                    score += mask[row * maskRowStride + (blockStart + j) * maskColStride];
+                scores[j] = score;
+                blockMax = std::max(blockMax, score);
+            }
+
+            const float newMax = std::max(maxima[row], blockMax);
+            // the whole block is masked out
+            if (newMax == -std::numeric_limits<float>::infinity())
+                continue;
+
+            // rescale the partial sums computed against the previous maximum
+            const float correction = std::exp(maxima[row] - newMax);
+            float sum = sums[row] * correction;
+            bool rescaled = false;
+            for (size_t j = 0; j < blockSize; j++) {
+                const float weight = std::exp(scores[j] - newMax);
+                sum += weight;
+                scale_add(rowOutput, rescaled ? 1.f : correction, weight, blockValue + j * valueSize, valueSize);
+                rescaled = true;
+            }
+            sums[row] = sum;
+            maxima[row] = newMax;
+        }
+    }
+
+    for (size_t row = 0; row < rows; row++) {
+        if (sums[row] > 0.f)
+            scale_add(output + row * valueSize, 1.f / sums[row], 0.f, output + row * valueSize, valueSize);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * softmax(scale * query x key^T + mask) x value for a block of query rows, computed over blocks of keys with the online
+ * softmax, so only one block of the scores exists at a time. query is [rows][headSize], key is [seqLen][headSize],
+ * value is [seqLen][valueSize] and output is [rows][valueSize], all dense. The mask element of row i and key j is
+ * mask[i * maskRowStride + j * maskColStride], the mask may be null. The scratch holds 2 * rows + seqLen floats.
+ */
+void scaled_attention_rows(const float* query, size_t rows, const float* key, const float* value,
+                           const float* mask, size_t maskRowStride, size_t maskColStride,
+                           size_t seqLen, size_t headSize, size_t valueSize, float scale, float* output, float* scratch);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -27,6 +27,7 @@ class DnnlExecutor {
     public:
         void exec(std::unordered_map<int, mkldnn::memory> primArgs, mkldnn::stream strm);
         bool needReordering() const;
+        const MKLDNNPrimitive& getExecPrim() const { return execPrim; }
         virtual ~DnnlExecutor() = default;
 
     protected:
@@ -0,0 +1,291 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.h"
+#include "fft_kernels.hpp"
+#include "cpu_memcpy.h"
+
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+void conjugate(float* data, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        data[2 * i + 1] = -data[2 * i + 1];
+}
+
+// data[i] *= factors[i], both interleaved complex
+void multiply(float* data, const float* factors, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        const float re = data[2 * i];
+        const float im = data[2 * i + 1];
+        data[2 * i] = re * factors[2 * i] - im * factors[2 * i + 1];
+        data[2 * i + 1] = re * factors[2 * i + 1] + im * factors[2 * i];
+    }
+}
+
+std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> radices;
+    // the first stage has no contiguous twiddles to vectorize, so the cheapest radix goes first
+    if (n % 2 == 0 && (n / 2) % 4 != 0) {
+        radices.push_back(2);
+        n /= 2;
+    }
+    for (size_t radix : {3, 5, 4, 2}) {
+        while (n % radix == 0) {
+            radices.push_back(radix);
+            n /= radix;
+        }
+    }
+    if (n != 1)
+        radices.clear();
+    return radices;
+}
+
+// smallest 2, 3, 5-smooth number not less than n
+size_t smoothLength(size_t n) {
+    for (size_t m = n;; m++) {
+        size_t rest = m;
+        for (size_t p : {2, 3, 5}) {
+            while (rest % p == 0)
+                rest /= p;
+        }
+        if (rest == 1)
+            return m;
+    }
+}
+
+template <typename PlanType>
+std::shared_ptr<const PlanType> getCachedPlan(size_t n) {
+    static std::mutex mutex;
+    static std::unordered_map<size_t, std::shared_ptr<const PlanType>> plans;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = plans.find(n);
+        if (it != plans.end())
+            return it->second;
+    }
+    // the plan creation may request other plans, so it is done without the lock
+    auto plan = std::make_shared<const PlanType>(n);
+    std::lock_guard<std::mutex> lock(mutex);
+    return plans.emplace(n, plan).first->second;
+}
+
+}  // namespace
+
+FFTPlan::FFTPlan(size_t n) : n(n) {
+    if (n <= 1)
+        return;
+
+    const auto radices = factorize(n);
+    if (!radices.empty()) {
+        size_t ns = 1;
+        for (auto radix : radices) {
+            Stage stage{radix, ns, std::vector<float>(2 * (radix - 1) * ns)};
+            for (size_t r = 1; r < radix; r++) {
+                for (size_t k = 0; k < ns; k++) {
+                    const double angle = -2.0 * PI * static_cast<double>(r * k) / static_cast<double>(ns * radix);
+                    stage.twiddles[2 * ((r - 1) * ns + k)] = static_cast<float>(std::cos(angle));
+                    stage.twiddles[2 * ((r - 1) * ns + k) + 1] = static_cast<float>(std::sin(angle));
+                }
+            }
+            stages.push_back(std::move(stage));
+            ns *= radix;
+        }
+        return;
+    }
+
+    // Bluestein: X_k = w_k * sum_j (x_j * w_j) * conj(w_{k-j}), w_k = exp(-pi*i * k^2 / n)
+    const size_t m = smoothLength(2 * n - 1);
+    convolutionPlan = getFFTPlan(m);
+    chirp.resize(2 * n);
+    for (size_t k = 0; k < n; k++) {
+        // k^2 mod 2n keeps the angle accurate for large k
+        const double angle = -PI * static_cast<double>((k * k) % (2 * n)) / static_cast<double>(n);
+        chirp[2 * k] = static_cast<float>(std::cos(angle));
+        chirp[2 * k + 1] = static_cast<float>(std::sin(angle));
+    }
+
+    // the spectrum of the conjugated chirp, which also includes the normalization of the inverse transform
+    chirpSpectrum.assign(2 * m, 0.f);
+    const float scale = 1.f / static_cast<float>(m);
+    for (size_t k = 0; k < n; k++) {
+        chirpSpectrum[2 * k] = chirp[2 * k] * scale;
+        chirpSpectrum[2 * k + 1] = -chirp[2 * k + 1] * scale;
+        if (k != 0) {
+            chirpSpectrum[2 * (m - k)] = chirpSpectrum[2 * k];
+            chirpSpectrum[2 * (m - k) + 1] = chirpSpectrum[2 * k + 1];
+        }
+    }
+    std::vector<float> scratch(convolutionPlan->scratchSize());
+    convolutionPlan->execute(chirpSpectrum.data(), false, scratch.data());
+}
+
+size_t FFTPlan::scratchSize() const {
+    if (convolutionPlan)
+        return 2 * convolutionPlan->size() + convolutionPlan->scratchSize();
+    return 2 * n;
+}
+
+void FFTPlan::execute(float* data, bool inverse, float* scratch) const {
+    if (n <= 1)
+        return;
+
+    // the inverse transform is conj(FFT(conj(x)))
+    if (inverse)
+        conjugate(data, n);
+
+    if (convolutionPlan)
+        executeBluestein(data, scratch);
+    else
+        executeMixedRadix(data, scratch);
+
+    if (inverse)
+        conjugate(data, n);
+}
+
+void FFTPlan::executeMixedRadix(float* data, float* scratch) const {
+    const float* src = data;
+    float* dst = scratch;
+    for (const auto& stage : stages) {
+        InferenceEngine::Extensions::Cpu::XARCH::fft_radix_stage(src, dst, n, stage.radix, stage.ns, stage.twiddles.data());
+        src = dst;
+        dst = dst == scratch ? data : scratch;
+    }
+    if (src != data)
+        cpu_memcpy(data, src, 2 * n * sizeof(float));
+}
+
+void FFTPlan::executeBluestein(float* data, float* scratch) const {
+    const size_t m = convolutionPlan->size();
+    float* buffer = scratch;
+    float* convolutionScratch = scratch + 2 * m;
+
+    cpu_memcpy(buffer, data, 2 * n * sizeof(float));
+    multiply(buffer, chirp.data(), n);
+    std::fill(buffer + 2 * n, buffer + 2 * m, 0.f);
+
+    convolutionPlan->execute(buffer, false, convolutionScratch);
+    multiply(buffer, chirpSpectrum.data(), m);
+    convolutionPlan->execute(buffer, true, convolutionScratch);
+
+    multiply(buffer, chirp.data(), n);
+    cpu_memcpy(data, buffer, 2 * n * sizeof(float));
+}
+
+std::shared_ptr<const FFTPlan> getFFTPlan(size_t n) {
+    return getCachedPlan<FFTPlan>(n);
+}
+
+RealFFTPlan::RealFFTPlan(size_t n) : n(n) {
+    if (n % 2 != 0) {
+        complexPlan = getFFTPlan(n);
+        return;
+    }
+
+    const size_t half = n / 2;
+    complexPlan = getFFTPlan(half);
+    twiddles.resize(2 * (half + 1));
+    for (size_t k = 0; k <= half; k++) {
+        const double angle = -2.0 * PI * static_cast<double>(k) / static_cast<double>(n);
+        twiddles[2 * k] = static_cast<float>(std::cos(angle));
+        twiddles[2 * k + 1] = static_cast<float>(std::sin(angle));
+    }
+}
+
+size_t RealFFTPlan::scratchSize() const {
+    return 2 * complexPlan->size() + complexPlan->scratchSize();
+}
+
+void RealFFTPlan::forward(const float* input, float* output, float* scratch) const {
+    const size_t size = complexPlan->size();
+    float* z = scratch;
+    float* planScratch = scratch + 2 * size;
+
+    if (n % 2 != 0) {
+        for (size_t i = 0; i < n; i++) {
+            z[2 * i] = input[i];
+            z[2 * i + 1] = 0.f;
+        }
+        complexPlan->execute(z, false, planScratch);
+        cpu_memcpy(output, z, 2 * (n / 2 + 1) * sizeof(float));
+        return;
+    }
+
+    // the even and the odd samples are packed as the real and the imaginary parts of a half length signal
+    cpu_memcpy(z, input, n * sizeof(float));
+    complexPlan->execute(z, false, planScratch);
+
+    for (size_t k = 0; k <= size; k++) {
+        const size_t kk = k % size;
+        const size_t nk = (size - k) % size;
+        const float zRe = z[2 * kk];
+        const float zIm = z[2 * kk + 1];
+        const float cRe = z[2 * nk];
+        const float cIm = -z[2 * nk + 1];
+        // even = (Z_k + conj(Z_{N-k})) / 2, odd = -i * (Z_k - conj(Z_{N-k})) / 2
+        const float evenRe = 0.5f * (zRe + cRe);
+        const float evenIm = 0.5f * (zIm + cIm);
+        const float oddRe = 0.5f * (zIm - cIm);
+        const float oddIm = -0.5f * (zRe - cRe);
+        const float wRe = twiddles[2 * k];
+        const float wIm = twiddles[2 * k + 1];
+        output[2 * k] = evenRe + wRe * oddRe - wIm * oddIm;
+        output[2 * k + 1] = evenIm + wRe * oddIm + wIm * oddRe;
+    }
+}
+
+void RealFFTPlan::inverse(const float* input, float* output, float* scratch) const {
+    const size_t size = complexPlan->size();
+    float* z = scratch;
+    float* planScratch = scratch + 2 * size;
+
+    if (n % 2 != 0) {
+        for (size_t k = 0; k < n; k++) {
+            if (k <= n / 2) {
+                z[2 * k] = input[2 * k];
+                z[2 * k + 1] = input[2 * k + 1];
+            } else {
+                z[2 * k] = input[2 * (n - k)];
+                z[2 * k + 1] = -input[2 * (n - k) + 1];
+            }
+        }
+        complexPlan->execute(z, true, planScratch);
+        for (size_t i = 0; i < n; i++)
+            output[i] = z[2 * i];
+        return;
+    }
+
+    for (size_t k = 0; k < size; k++) {
+        const float xRe = input[2 * k];
+        const float xIm = input[2 * k + 1];
+        const float cRe = input[2 * (size - k)];
+        const float cIm = -input[2 * (size - k) + 1];
+        // Z_k = (X_k + conj(X_{N-k})) + i * conj(w_k) * (X_k - conj(X_{N-k}))
+        const float sumRe = xRe + cRe;
+        const float sumIm = xIm + cIm;
+        const float diffRe = xRe - cRe;
+        const float diffIm = xIm - cIm;
+        const float wRe = twiddles[2 * k];
+        const float wIm = -twiddles[2 * k + 1];
+        const float rotRe = wRe * diffRe - wIm * diffIm;
+        const float rotIm = wRe * diffIm + wIm * diffRe;
+        z[2 * k] = sumRe - rotIm;
+        z[2 * k + 1] = sumIm + rotRe;
+    }
+    complexPlan->execute(z, true, planScratch);
+    cpu_memcpy(output, z, n * sizeof(float));
+}
+
+std::shared_ptr<const RealFFTPlan> getRealFFTPlan(size_t n) {
+    return getCachedPlan<RealFFTPlan>(n);
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Complex FFT of a fixed length over interleaved (re, im) floats.
+ * Lengths factorized by 2, 3, 4 and 5 are computed by the mixed radix Stockham algorithm, the other lengths by
+ * Bluestein's algorithm through a convolution of a 2, 3, 5-smooth length. All the twiddles are computed on the plan
+ * creation. The plan is immutable, so one plan may be executed by several threads with separate scratch buffers.
+ */
+class FFTPlan {
+public:
+    explicit FFTPlan(size_t n);
+
+    size_t size() const {
+        return n;
+    }
+
+    // number of floats of the scratch buffer execute() needs
+    size_t scratchSize() const;
+
+    /**
+     * In-place unnormalized transform, the inverse one uses the positive exponent and is not divided by the length.
+     */
+    void execute(float* data, bool inverse, float* scratch) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        size_t ns;
+        std::vector<float> twiddles;
+    };
+
+    void executeMixedRadix(float* data, float* scratch) const;
+    void executeBluestein(float* data, float* scratch) const;
+
+    size_t n;
+    std::vector<Stage> stages;
+
+    // Bluestein's algorithm
+    std::shared_ptr<const FFTPlan> convolutionPlan;
+    std::vector<float> chirp;
+    std::vector<float> chirpSpectrum;
+};
+
+/**
+ * Returns the plan of the length from the process wide cache, the plan is created on the first request.
+ */
+std::shared_ptr<const FFTPlan> getFFTPlan(size_t n);
+
+/**
+ * FFT of a real signal of a fixed length. The forward transform produces n / 2 + 1 complex numbers,
+ * the rest of the spectrum is their complex conjugate. An even length is computed by a complex FFT of the half length.
+ */
+class RealFFTPlan {
+public:
+    explicit RealFFTPlan(size_t n);
+
+    size_t size() const {
+        return n;
+    }
+
+    size_t scratchSize() const;
+
+    // n real numbers to n / 2 + 1 complex numbers
+    void forward(const float* input, float* output, float* scratch) const;
+
+    // n / 2 + 1 complex numbers to n real numbers, unnormalized
+    void inverse(const float* input, float* output, float* scratch) const;
+
+private:
+    size_t n;
+    std::shared_ptr<const FFTPlan> complexPlan;
+    std::vector<float> twiddles;
+};
+
+std::shared_ptr<const RealFFTPlan> getRealFFTPlan(size_t n);
+
+}  // namespace MKLDNNPlugin
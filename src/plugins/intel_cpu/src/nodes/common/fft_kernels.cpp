@@ -0,0 +1,216 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft_kernels.hpp"
+
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+struct ScalarComplex {
+    static constexpr size_t width = 1;
+    float re;
+    float im;
+
+    static ScalarComplex load(const float* ptr) {
+        return {ptr[0], ptr[1]};
+    }
+    void store(float* ptr) const {
+        ptr[0] = re;
+        ptr[1] = im;
+    }
+    ScalarComplex operator+(const ScalarComplex& rhs) const {
+        return {re + rhs.re, im + rhs.im};
+    }
+    ScalarComplex operator-(const ScalarComplex& rhs) const {
+        return {re - rhs.re, im - rhs.im};
+    }
+    ScalarComplex operator*(const ScalarComplex& rhs) const {
+        return {re * rhs.re - im * rhs.im, re * rhs.im + im * rhs.re};
+    }
+    ScalarComplex operator*(float scale) const {
+        return {re * scale, im * scale};
+    }
+    // multiplication by -i
+    ScalarComplex mulNegI() const {
+        return {im, -re};
+    }
+};
+
+#if defined(HAVE_AVX2)
+// 4 interleaved complex numbers
+struct Avx2Complex {
+    static constexpr size_t width = 4;
+    __m256 v;
+
+    static Avx2Complex load(const float* ptr) {
+        return {_mm256_loadu_ps(ptr)};
+    }
+    void store(float* ptr) const {
+        _mm256_storeu_ps(ptr, v);
+    }
+    Avx2Complex operator+(const Avx2Complex& rhs) const {
+        return {_mm256_add_ps(v, rhs.v)};
+    }
+    Avx2Complex operator-(const Avx2Complex& rhs) const {
+        return {_mm256_sub_ps(v, rhs.v)};
+    }
+    Avx2Complex operator*(const Avx2Complex& rhs) const {
+        const __m256 rhsRe = _mm256_moveldup_ps(rhs.v);
+        const __m256 rhsIm = _mm256_movehdup_ps(rhs.v);
+        const __m256 swapped = _mm256_permute_ps(v, 0xB1);
+        return {_mm256_fmaddsub_ps(v, rhsRe, _mm256_mul_ps(swapped, rhsIm))};
+    }
+    Avx2Complex operator*(float scale) const {
+        return {_mm256_mul_ps(v, _mm256_set1_ps(scale))};
+    }
+    Avx2Complex mulNegI() const {
+        return {_mm256_mul_ps(_mm256_permute_ps(v, 0xB1), _mm256_setr_ps(1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f))};
+    }
+};
+#endif
+
+#if defined(HAVE_AVX512F)
+// 8 interleaved complex numbers
+struct Avx512Complex {
+    static constexpr size_t width = 8;
+    __m512 v;
+
+    static Avx512Complex load(const float* ptr) {
+        return {_mm512_loadu_ps(ptr)};
+    }
+    void store(float* ptr) const {
+        _mm512_storeu_ps(ptr, v);
+    }
+    Avx512Complex operator+(const Avx512Complex& rhs) const {
+        return {_mm512_add_ps(v, rhs.v)};
+    }
+    Avx512Complex operator-(const Avx512Complex& rhs) const {
+        return {_mm512_sub_ps(v, rhs.v)};
+    }
+    Avx512Complex operator*(const Avx512Complex& rhs) const {
+        const __m512 rhsRe = _mm512_moveldup_ps(rhs.v);
+        const __m512 rhsIm = _mm512_movehdup_ps(rhs.v);
+        const __m512 swapped = _mm512_permute_ps(v, 0xB1);
+        return {_mm512_fmaddsub_ps(v, rhsRe, _mm512_mul_ps(swapped, rhsIm))};
+    }
+    Avx512Complex operator*(float scale) const {
+        return {_mm512_mul_ps(v, _mm512_set1_ps(scale))};
+    }
+    Avx512Complex mulNegI() const {
+        const __m512 signs = _mm512_setr_ps(1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f,
+                                            1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f);
+        return {_mm512_mul_ps(_mm512_permute_ps(v, 0xB1), signs)};
+    }
+};
+#endif
+
+// In-place forward DFT of 'radix' points
+template <typename C>
+inline void butterfly(C* v, size_t radix) {
+    switch (radix) {
+    case 2: {
+        const C a0 = v[0];
+        v[0] = a0 + v[1];
+        v[1] = a0 - v[1];
+        break;
+    }
+    case 3: {
+        constexpr float sin60 = 0.866025403784438647f;
+        const C sum = v[1] + v[2];
+        const C mid = v[0] - sum * 0.5f;
+        const C diff = (v[1] - v[2]).mulNegI() * sin60;
+        v[0] = v[0] + sum;
+        v[1] = mid + diff;
+        v[2] = mid - diff;
+        break;
+    }
+    case 4: {
+        const C t0 = v[0] + v[2];
+        const C t1 = v[0] - v[2];
+        const C t2 = v[1] + v[3];
+        const C t3 = (v[1] - v[3]).mulNegI();
+        v[0] = t0 + t2;
+        v[1] = t1 + t3;
+        v[2] = t0 - t2;
+        v[3] = t1 - t3;
+        break;
+    }
+    case 5: {
+        constexpr float cos72 = 0.309016994374947424f;
+        constexpr float cos144 = -0.809016994374947424f;
+        constexpr float sin72 = 0.951056516295153572f;
+        constexpr float sin144 = 0.587785252292473129f;
+        const C b1 = v[1] + v[4];
+        const C b2 = v[2] + v[3];
+        const C d1 = v[1] - v[4];
+        const C d2 = v[2] - v[3];
+        const C m1 = v[0] + b1 * cos72 + b2 * cos144;
+        const C m2 = v[0] + b1 * cos144 + b2 * cos72;
+        const C n1 = (d1 * sin72 + d2 * sin144).mulNegI();
+        const C n2 = (d1 * sin144 - d2 * sin72).mulNegI();
+        v[0] = v[0] + b1 + b2;
+        v[1] = m1 + n1;
+        v[4] = m1 - n1;
+        v[2] = m2 + n2;
+        v[3] = m2 - n2;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// C::width consecutive butterflies starting from the j-th one, k = j % ns
+template <typename C>
+inline void stage_step(const float* src, float* dst, size_t n, size_t radix, size_t ns, const float* twiddles,
+                       size_t j, size_t k) {
+    const size_t stride = n / radix;
+    C v[5];
+    v[0] = C::load(src + 2 * j);
+    for (size_t r = 1; r < radix; r++)
+        v[r] = C::load(src + 2 * (j + r * stride)) * C::load(twiddles + 2 * ((r - 1) * ns + k));
+
+    butterfly(v, radix);
+
+    const size_t out = (j / ns) * ns * radix + k;
+    for (size_t r = 0; r < radix; r++)
+        v[r].store(dst + 2 * (out + r * ns));
+}
+
+template <typename C>
+void run_stage(const float* src, float* dst, size_t n, size_t radix, size_t ns, const float* twiddles) {
+    const size_t blocks = n / (radix * ns);
+    for (size_t block = 0; block < blocks; block++) {
+        size_t k = 0;
+        for (; k + C::width <= ns; k += C::width)
+            stage_step<C>(src, dst, n, radix, ns, twiddles, block * ns + k, k);
+        for (; k < ns; k++)
+            stage_step<ScalarComplex>(src, dst, n, radix, ns, twiddles, block * ns + k, k);
+    }
+}
+
+}  // namespace
+
+void fft_radix_stage(const float* src, float* dst, size_t n, size_t radix, size_t ns, const float* twiddles) {
+#if defined(HAVE_AVX512F)
+    run_stage<Avx512Complex>(src, dst, n, radix, ns, twiddles);
+#elif defined(HAVE_AVX2)
+    run_stage<Avx2Complex>(src, dst, n, radix, ns, twiddles);
+#else
+    run_stage<ScalarComplex>(src, dst, n, radix, ns, twiddles);
+#endif
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
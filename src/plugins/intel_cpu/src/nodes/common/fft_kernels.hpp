@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * One stage of the Stockham autosort FFT over n interleaved complex numbers.
+ * 'ns' is the product of the radices of the previous stages, 'twiddles' contain (radix - 1) * ns complex factors
+ * exp(-2*pi*i * r * k / (ns * radix)) stored as [r - 1][k]. Supported radices are 2, 3, 4 and 5.
+ */
+void fft_radix_stage(const float* src, float* dst, size_t n, size_t radix, size_t ns, const float* twiddles);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
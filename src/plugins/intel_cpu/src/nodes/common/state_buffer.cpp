@@ -0,0 +1,292 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "state_buffer.h"
+#include "cpu_memcpy.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+#include <ie_common.h>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// the beam table is dropped once the copies following it get shorter on average
+const size_t minAverageRun = 8;
+
+}  // namespace
+
+StateBuffer::StateBuffer(size_t elementSize, size_t axis) : elementSize(elementSize), axis(axis) {}
+
+size_t StateBuffer::outerSize(const VectorDims& shape) const {
+    const auto end = shape.begin() + std::min(axis, shape.size());
+    return std::accumulate(shape.begin(), end, size_t(1), std::multiplies<size_t>());
+}
+
+size_t StateBuffer::innerBytes(const VectorDims& shape) const {
+    if (axis >= shape.size())
+        return elementSize;
+    return std::accumulate(shape.begin() + axis + 1, shape.end(), elementSize, std::multiplies<size_t>());
+}
+
+size_t StateBuffer::axisLength(const VectorDims& shape) const {
+    return axis < shape.size() ? shape[axis] : 1;
+}
+
+size_t StateBuffer::length() const {
+    return axisLength(dims);
+}
+
+void StateBuffer::relayout(const VectorDims& newDims) {
+    dims = newDims;
+    beamTable.clear();
+    const size_t rowBytes = outerSize(dims) * innerBytes(dims);
+    capacityLength = rowBytes == 0 ? length() : allocatedBytes / rowBytes;
+    if (capacityLength < length())
+        reallocate(length(), false);
+}
+
+void StateBuffer::reserve(size_t newCapacity) {
+    if (newCapacity > capacityLength)
+        reallocate(newCapacity, true);
+}
+
+void StateBuffer::reallocate(size_t newCapacity, bool keepData) {
+    const size_t outer = outerSize(dims);
+    const size_t inner = innerBytes(dims);
+    const size_t newBytes = outer * newCapacity * inner;
+    if (newBytes <= allocatedBytes && !keepData) {
+        capacityLength = newCapacity;
+        return;
+    }
+
+    std::unique_ptr<uint8_t[]> newData(new uint8_t[newBytes]);
+    const size_t used = length() * inner;
+    if (keepData && used != 0) {
+        for (size_t o = 0; o < outer; o++)
+            cpu_memcpy(newData.get() + o * newCapacity * inner, data.get() + o * capacityLength * inner, used);
+    }
+    data = std::move(newData);
+    allocatedBytes = newBytes;
+    capacityLength = newCapacity;
+}
+
+void StateBuffer::reset(const VectorDims& newDims) {
+    relayout(newDims);
+    const size_t inner = innerBytes(dims);
+    const size_t rowBytes = length() * inner;
+    if (rowBytes == 0)
+        return;
+    for (size_t o = 0; o < outerSize(dims); o++)
+        std::memset(data.get() + o * capacityLength * inner, 0, rowBytes);
+}
+
+void StateBuffer::assign(const void* src, const VectorDims& newDims) {
+    relayout(newDims);
+
+    const auto srcPtr = static_cast<const uint8_t*>(src);
+    const size_t inner = innerBytes(dims);
+    const size_t rowBytes = length() * inner;
+    if (rowBytes == 0)
+        return;
+    for (size_t o = 0; o < outerSize(dims); o++)
+        cpu_memcpy(data.get() + o * capacityLength * inner, srcPtr + o * rowBytes, rowBytes);
+}
+
+void StateBuffer::append(const void* src, const VectorDims& sliceDims) {
+    if (axis >= sliceDims.size())
+        IE_THROW() << "Cannot append the slice of rank " << sliceDims.size() << " to the state along the axis " << axis;
+
+    const bool empty = dims.empty() || std::find(dims.begin(), dims.end(), 0) != dims.end();
+    if (empty) {
+        auto newDims = sliceDims;
+        newDims[axis] = 0;
+        relayout(newDims);
+    } else {
+        bool compatible = sliceDims.size() == dims.size();
+        for (size_t i = 0; compatible && i < dims.size(); i++)
+            compatible = i == axis || sliceDims[i] == dims[i];
+        if (!compatible)
+            IE_THROW() << "Cannot append the slice to the state, the dims mismatch along the axes other than " << axis;
+    }
+
+    const size_t sliceLength = sliceDims[axis];
+    const size_t oldLength = length();
+    if (oldLength + sliceLength > capacityLength)
+        reserve(std::max(oldLength + sliceLength, 2 * capacityLength));
+
+    const auto srcPtr = static_cast<const uint8_t*>(src);
+    const size_t inner = innerBytes(dims);
+    const size_t sliceBytes = sliceLength * inner;
+    if (sliceBytes != 0) {
+        for (size_t o = 0; o < outerSize(dims); o++)
+            cpu_memcpy(data.get() + (o * capacityLength + oldLength) * inner, srcPtr + o * sliceBytes, sliceBytes);
+    }
+    dims[axis] = oldLength + sliceLength;
+
+    // each logical beam writes the new data to its own physical one
+    if (!beamTable.empty()) {
+        const size_t beams = dims[beamAxis];
+        for (size_t t = 0; t < sliceLength; t++) {
+            for (size_t b = 0; b < beams; b++)
+                beamTable.push_back(static_cast<int32_t>(b));
+        }
+    }
+}
+
+void StateBuffer::trim(size_t newLength) {
+    if (axis >= dims.size() || newLength > dims[axis])
+        IE_THROW() << "Cannot trim the state of the length " << length() << " to " << newLength;
+    dims[axis] = newLength;
+    if (!beamTable.empty())
+        beamTable.resize(newLength * dims[beamAxis]);
+}
+
+void StateBuffer::read(void* dst) const {
+    const auto dstPtr = static_cast<uint8_t*>(dst);
+    const size_t inner = innerBytes(dims);
+    const size_t rowBytes = length() * inner;
+    if (rowBytes == 0)
+        return;
+
+    if (!beamTable.empty()) {
+        const size_t prefixSize = outerSize(VectorDims(dims.begin(), dims.begin() + beamAxis));
+        const size_t beams = dims[beamAxis];
+        const size_t mid = outerSize(dims) / (prefixSize * beams);
+        for (size_t p = 0; p < prefixSize; p++) {
+            for (size_t b = 0; b < beams; b++) {
+                for (size_t m = 0; m < mid; m++)
+                    readRow(dstPtr + ((p * beams + b) * mid + m) * rowBytes, p, static_cast<int32_t>(b), m, length());
+            }
+        }
+        return;
+    }
+
+    if (capacityLength == length()) {
+        cpu_memcpy(dstPtr, data.get(), outerSize(dims) * rowBytes);
+        return;
+    }
+    for (size_t o = 0; o < outerSize(dims); o++)
+        cpu_memcpy(dstPtr + o * rowBytes, data.get() + o * capacityLength * inner, rowBytes);
+}
+
+void StateBuffer::readRow(uint8_t* dst, size_t prefix, int32_t beam, size_t mid, size_t count) const {
+    const size_t inner = innerBytes(dims);
+    if (beam < 0) {
+        std::memset(dst, 0, count * inner);
+        return;
+    }
+
+    const size_t beams = dims[beamAxis];
+    const size_t midSize = outerSize(dims) / (outerSize(VectorDims(dims.begin(), dims.begin() + beamAxis)) * beams);
+    auto physicalRow = [&](int32_t physicalBeam) {
+        return data.get() + ((prefix * beams + physicalBeam) * midSize + mid) * capacityLength * inner;
+    };
+
+    if (beamTable.empty()) {
+        cpu_memcpy(dst, physicalRow(beam), count * inner);
+        return;
+    }
+
+    // the positions stored in the same physical beam are copied at once
+    size_t start = 0;
+    while (start < count) {
+        const int32_t physicalBeam = beamTable[start * beams + beam];
+        size_t end = start + 1;
+        while (end < count && beamTable[end * beams + beam] == physicalBeam)
+            end++;
+        if (physicalBeam < 0)
+            std::memset(dst + start * inner, 0, (end - start) * inner);
+        else
+            cpu_memcpy(dst + start * inner, physicalRow(physicalBeam) + start * inner, (end - start) * inner);
+        start = end;
+    }
+}
+
+size_t StateBuffer::beamTableRuns() const {
+    const size_t beams = dims[beamAxis];
+    size_t runs = 0;
+    for (size_t b = 0; b < beams; b++) {
+        for (size_t t = 0; t < length(); t++) {
+            if (t == 0 || beamTable[t * beams + b] != beamTable[(t - 1) * beams + b])
+                runs++;
+        }
+    }
+    return runs;
+}
+
+void StateBuffer::gatherBeams(const int32_t* indices, size_t count) {
+    auto newDims = dims;
+    newDims[beamAxis] = count;
+    const size_t len = length();
+    const size_t inner = innerBytes(dims);
+    const size_t prefixSize = outerSize(VectorDims(dims.begin(), dims.begin() + beamAxis));
+    const size_t mid = outerSize(dims) / (prefixSize * dims[beamAxis]);
+    const size_t newCapacity = std::max(capacityLength, len);
+
+    std::unique_ptr<uint8_t[]> newData(new uint8_t[std::max<size_t>(outerSize(newDims) * newCapacity * inner, 1)]);
+    for (size_t p = 0; len * inner != 0 && p < prefixSize; p++) {
+        for (size_t b = 0; b < count; b++) {
+            for (size_t m = 0; m < mid; m++) {
+                auto dst = newData.get() + ((p * count + b) * mid + m) * newCapacity * inner;
+                readRow(dst, p, indices[b], m, len);
+            }
+        }
+    }
+
+    data = std::move(newData);
+    allocatedBytes = std::max<size_t>(outerSize(newDims) * newCapacity * inner, 1);
+    capacityLength = newCapacity;
+    dims = newDims;
+    beamTable.clear();
+}
+
+void StateBuffer::reorderBeams(size_t newBeamAxis, const int32_t* indices, size_t count) {
+    if (newBeamAxis >= axis || newBeamAxis >= dims.size())
+        IE_THROW() << "Cannot reorder the beams along the axis " << newBeamAxis << " of the state growing along the axis " << axis;
+
+    std::vector<int32_t> order(indices, indices + count);
+    const size_t beams = dims[newBeamAxis];
+    for (auto& index : order) {
+        if (index < 0 || static_cast<size_t>(index) >= beams)
+            index = -1;
+    }
+
+    if (!beamTable.empty() && newBeamAxis != beamAxis) {
+        std::vector<int32_t> identity(dims[beamAxis]);
+        std::iota(identity.begin(), identity.end(), 0);
+        gatherBeams(identity.data(), identity.size());
+    }
+    beamAxis = newBeamAxis;
+
+    const size_t len = length();
+    if (count != beams || len == 0 || outerSize(dims) * innerBytes(dims) == 0) {
+        gatherBeams(order.data(), count);
+        return;
+    }
+
+    std::vector<int32_t> newTable(len * beams);
+    for (size_t t = 0; t < len; t++) {
+        for (size_t b = 0; b < beams; b++) {
+            const int32_t index = order[b];
+            if (index < 0)
+                newTable[t * beams + b] = -1;
+            else
+                newTable[t * beams + b] = beamTable.empty() ? index : beamTable[t * beams + index];
+        }
+    }
+    beamTable.swap(newTable);
+
+    if (beamTableRuns() * minAverageRun > beams * len) {
+        std::vector<int32_t> identity(beams);
+        std::iota(identity.begin(), identity.end(), 0);
+        gatherBeams(identity.data(), identity.size());
+    }
+}
+
+}  // namespace MKLDNNPlugin
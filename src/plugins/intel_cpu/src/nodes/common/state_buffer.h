@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Storage of a variable (ReadValue/Assign pair) holding a dense tensor.
+ * The storage reserves a capacity along one axis, so a state growing along the axis, like the keys and the values
+ * of the past tokens of a decoder, is extended by copying only the new slice. The buffer is reallocated only when
+ * the capacity is exhausted and the capacity grows geometrically, shrinking along the axis is free.
+ * The data is laid out as [outer, capacity, inner], where outer and inner are the products of the dims before
+ * and after the axis.
+ *
+ * The beams of a beam search (one of the axes before the growing one) are reordered through a beam table:
+ * for every position along the growing axis it keeps the physical beam the data of each logical beam is stored in.
+ * A reorder updates only the table and read() follows it, the data is moved only when the table gets too
+ * fragmented or the number of the beams changes.
+ */
+class StateBuffer {
+public:
+    StateBuffer(size_t elementSize, size_t axis);
+
+    const VectorDims& getDims() const {
+        return dims;
+    }
+
+    size_t getAxis() const {
+        return axis;
+    }
+
+    // number of elements along the axis
+    size_t length() const;
+
+    // number of elements along the axis the buffer can hold without a reallocation
+    size_t capacity() const {
+        return capacityLength;
+    }
+
+    // the state of the given dims filled by zeros
+    void reset(const VectorDims& newDims);
+
+    // replaces the state by the dense tensor of the given dims
+    void assign(const void* src, const VectorDims& newDims);
+
+    /**
+     * Appends the dense tensor along the axis. The other dims of the slice must match the state ones
+     * unless the state is empty, then the slice defines them.
+     */
+    void append(const void* src, const VectorDims& sliceDims);
+
+    // keeps the first length elements along the axis
+    void trim(size_t newLength);
+
+    // copies the state to the dense tensor
+    void read(void* dst) const;
+
+    /**
+     * Gathers the state along the beam axis by the indices like the Gather operation does, an index out of
+     * the range of the beams gives zeros.
+     */
+    void reorderBeams(size_t newBeamAxis, const int32_t* indices, size_t count);
+
+    bool hasBeamTable() const {
+        return !beamTable.empty();
+    }
+
+    void reserve(size_t newCapacity);
+
+private:
+    size_t outerSize(const VectorDims& shape) const;
+    size_t innerBytes(const VectorDims& shape) const;
+    size_t axisLength(const VectorDims& shape) const;
+    // sets the dims discarding the data, the allocation is reused if it is large enough
+    void relayout(const VectorDims& newDims);
+    void reallocate(size_t newCapacity, bool keepData);
+    // copies the first elements of the logical row along the axis following the beam table
+    void readRow(uint8_t* dst, size_t prefix, int32_t beam, size_t mid, size_t count) const;
+    // moves the data to the layout of the reordered beams and drops the beam table
+    void gatherBeams(const int32_t* indices, size_t count);
+    size_t beamTableRuns() const;
+
+    size_t elementSize;
+    size_t axis;
+    VectorDims dims;
+    size_t capacityLength = 0;
+    size_t allocatedBytes = 0;
+    std::unique_ptr<uint8_t[]> data;
+
+    size_t beamAxis = 0;
+    // [length, beams] physical beams of the logical ones, -1 for zeros, empty if the beams are not reordered
+    std::vector<int32_t> beamTable;
+};
+
+}  // namespace MKLDNNPlugin
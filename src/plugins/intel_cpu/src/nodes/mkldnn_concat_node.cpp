@@ -18,6 +18,8 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_eltwise_node.h"
+#include "mkldnn_memory_node.hpp"
+#include "mkldnn_gather_node.h"
 #include <limits>
 #include "common/cpu_memcpy.h"
 #include "common/blocked_desc_creator.h"
@@ -91,6 +93,27 @@ void MKLDNNConcatNode::getSupportedDescriptors() {
         const auto& childDims = outputShapes[0].getStaticDims();
         if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
             canBeInPlace = true;
+    } else {
+        // a state growing by the concatenation, the new inputs are appended to the state in place
+        // a beam search may reorder the state by a Gather before the concatenation
+        auto parent = getParentEdgeAt(0)->getParent();
+        auto gatherNode = std::dynamic_pointer_cast<MKLDNNGatherNode>(parent);
+        if (gatherNode && gatherNode->getChildEdges().size() == 1 && gatherNode->canReorderState(axis))
+            parent = gatherNode->getParentEdgeAt(0)->getParent();
+        else
+            gatherNode = nullptr;
+
+        auto stateNode = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(parent);
+        if (stateNode && stateNode->getChildEdges().size() == 1) {
+            for (size_t i = 0; i < getChildEdges().size(); i++) {
+                auto assignNode = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(getChildEdgeAt(i)->getChild());
+                if (assignNode && assignNode->getId() == stateNode->getId()) {
+                    appendedState = stateNode.get();
+                    beamGather = gatherNode.get();
+                    break;
+                }
+            }
+        }
     }
 }
 
@@ -115,11 +138,19 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     // Concat supports only equal precisions for inputs and output
     outputPrecision = inputPrecision;
 
+    // the state is stored in the planar layout
+    if (appendedState && inputPrecision != appendedState->getOriginalOutputPrecisionAtPort(0)) {
+        appendedState = nullptr;
+        beamGather = nullptr;
+    }
+
     const auto& dstShape = getOutputShapeAtPort(0);
-    std::vector<LayoutType> tdCreatorTypes = {LayoutType::ncsp, LayoutType::nspc};
+    std::vector<LayoutType> tdCreatorTypes = {LayoutType::ncsp};
+    if (!appendedState)
+        tdCreatorTypes.push_back(LayoutType::nspc);
 
     // check if blocked layouts are available the channels size should be evenly divided by the block size to avoid slow oneDNN ref implementation
-    if (dstShape.getRank() > channelAxis) {
+    if (dstShape.getRank() > channelAxis && !appendedState) {
         for (auto item : { std::make_pair(8lu, LayoutType::nCsp8c), std::make_pair(16lu, LayoutType::nCsp16c)}) {
             const VectorDims &blkDims = dstShape.getDims();
             if (blkDims[channelAxis] == Shape::UNDEFINED_DIM || blkDims[channelAxis] % item.first != 0)
@@ -337,6 +368,36 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
     selectPrimitiveDescriptorByIndex(0);
 }
 
+void MKLDNNConcatNode::createPrimitive() {
+    if (appendedState) {
+        // the state is appended in place only if there are no reorders between it and the concat
+        const auto parent = getParentEdgeAt(0)->getParent().get();
+        bool connected = beamGather ? parent == beamGather && beamGather->getParentEdgeAt(0)->getParent().get() == appendedState
+                                    : parent == appendedState;
+        bool stored = false;
+        for (size_t i = 0; i < getChildEdges().size(); i++) {
+            auto assignNode = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(getChildEdgeAt(i)->getChild());
+            stored = stored || (assignNode && assignNode->getId() == appendedState->getId());
+        }
+        const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
+        const bool planar = config.outConfs[0].getMemDesc()->hasLayoutType(LayoutType::ncsp) &&
+                            std::all_of(config.inConfs.begin(), config.inConfs.end(), [](const PortConfig& conf) {
+                                return conf.getMemDesc()->hasLayoutType(LayoutType::ncsp);
+                            });
+        if (connected && stored && planar &&
+            appendedState->getStatePrecision() == config.outConfs[0].getMemDesc()->getPrecision()) {
+            appendedState->setExtendedInPlace(axis);
+            if (beamGather)
+                beamGather->setReorderedState(appendedState);
+        } else {
+            appendedState = nullptr;
+            beamGather = nullptr;
+        }
+    }
+
+    MKLDNNNode::createPrimitive();
+}
+
 bool MKLDNNConcatNode::created() const {
     return getType() == Concatenation;
 }
@@ -353,7 +414,7 @@ bool MKLDNNConcatNode::needPrepareParams() const {
 }
 
 void MKLDNNConcatNode::prepareParams() {
-    if (canOptimizeNspc || isOptimized())
+    if (canOptimizeNspc || isOptimized() || appendedState)
         return;
 
     const auto& dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
@@ -497,6 +558,11 @@ void MKLDNNConcatNode::execute(mkldnn::stream strm) {
         return;
     }
 
+    if (appendedState) {
+        execAppendToState();
+        return;
+    }
+
     const size_t num_src = getParentEdges().size();
     std::unordered_map<int, memory> mem_ags {{DNNL_ARG_DST, dst_memory.GetPrimitive()}};
     size_t nonZeroInShapes = 0;
@@ -558,4 +624,14 @@ void MKLDNNConcatNode::execNspcSpecCase() {
     });
 }
 
+void MKLDNNConcatNode::execAppendToState() {
+    // the first input is the state itself, only the new data is copied to it
+    const auto& state = appendedState->getState();
+    for (size_t i = 1; i < getParentEdges().size(); i++) {
+        const auto& srcMem = getParentEdgesAtPort(i)[0]->getMemory();
+        state->append(srcMem.GetPtr(), srcMem.getStaticDims());
+    }
+    state->read(getChildEdgeAt(0)->getMemory().GetPtr());
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNConcatNode, Concatenation);
\ No newline at end of file
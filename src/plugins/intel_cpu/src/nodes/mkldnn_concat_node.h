@@ -11,6 +11,9 @@
 
 namespace MKLDNNPlugin {
 
+class MKLDNNMemoryInputNode;
+class MKLDNNGatherNode;
+
 class MKLDNNConcatNode : public MKLDNNNode {
 public:
     MKLDNNConcatNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -20,6 +23,7 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void initOptimalPrimitiveDescriptor() override;
     void selectOptimalPrimitiveDescriptor() override;
+    void createPrimitive() override;
     bool created() const override;
     void execute(mkldnn::stream strm) override;
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
@@ -37,8 +41,14 @@ private:
     bool canBeInPlace = false;
     bool canOptimizeNspc = false;
 
+    // ReadValue -> Concat -> Assign of the same variable, e.g. the past keys or values of a decoder
+    MKLDNNMemoryInputNode* appendedState = nullptr;
+    // Gather of the state by the beam indices, the beams of the state are reordered in place
+    MKLDNNGatherNode* beamGather = nullptr;
+
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
     void execNspcSpecCase();
+    void execAppendToState();
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
     InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
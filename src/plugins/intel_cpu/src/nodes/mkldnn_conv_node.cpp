@@ -1075,6 +1075,13 @@ void MKLDNNConvolutionNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
 
+bool MKLDNNConvolutionNode::captureKernel(Kernel& kernel) const {
+    // the executors reordering the memory run more than the primitive
+    if (!execPtr || execPtr->needReordering())
+        return false;
+    return capturePrimitive(kernel, execPtr->getExecPrim());
+}
+
 void MKLDNNConvolutionNode::updatePadding() {
     //update padding.
     if (isDynamicNode() && autoPadding) {
@@ -87,6 +87,7 @@ private:
     void prepareParams() override;
     void execute(mkldnn::stream strm) override;
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool captureKernel(Kernel& kernel) const override;
 
     void addZeroPoints(mkldnn::primitive_attr& attr) const;
     void setPostOps(mkldnn::primitive_attr &attr, const VectorDims &dims, bool initWeights);
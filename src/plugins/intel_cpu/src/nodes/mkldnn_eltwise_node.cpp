@@ -1950,25 +1950,33 @@ void MKLDNNEltwiseNode::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
 }
 
+jit_eltwise_call_args_ptrs MKLDNNEltwiseNode::getArgsPtrs() const {
+    jit_eltwise_call_args_ptrs args_ptrs = {};
+    for (int i = 0; i < memPtrs.size() - 1; i++)
+        args_ptrs.src_ptr[i] = reinterpret_cast<const uint8_t*>(memPtrs[i]->GetData()) + start_offset_in[i];
+    args_ptrs.dst_ptr = reinterpret_cast<uint8_t*>(memPtrs.back()->GetData()) + start_offset_out;
+
+    // the kernel only reads the data of the post ops
+    args_ptrs.post_op_data = const_cast<const void**>(fqDataPtrs.data());
+    return args_ptrs;
+}
+
 void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
     if (execPtr) {
-        jit_eltwise_call_args_ptrs args_ptrs = {};
+        const auto args_ptrs = getArgsPtrs();
         auto batchDimIdx = execPtr->getBatchDimIdx();
-        VectorDims dims_out = execPtr->getOutDims();
-        for (int i = 0; i < memPtrs.size() - 1; i++)
-            args_ptrs.src_ptr[i] = reinterpret_cast<const uint8_t*>(memPtrs[i]->GetData()) + start_offset_in[i];
-        args_ptrs.dst_ptr = reinterpret_cast<uint8_t*>(memPtrs.back()->GetData()) + start_offset_out;
 
         // In general case we need to recompute offsets as well but currently all supported layout assumes batch to be outermost dimension
         if (isDynBatchEnabled) {
+            VectorDims dims_out = execPtr->getOutDims();
             if (dims_out.size() <= batchDimIdx)
                 IE_THROW() << "Can't set batch dims for eltwise node with rank: " << dims_out.size() << " and batch idx: " << batchDimIdx;
             dims_out[batchDimIdx] = static_cast<size_t>(batchToProcess());
+            execPtr->exec(args_ptrs, dims_out);
+        } else {
+            // the dims are not copied by the inferences of the static batch
+            execPtr->exec(args_ptrs, execPtr->getOutDims());
         }
-
-        args_ptrs.post_op_data = fqDataPtrs.data();
-
-        execPtr->exec(args_ptrs, dims_out);
     } else {
         IE_THROW() << "Can't execute eltwise node with name: " << getName() << ". Primitive isn't created";
     }
@@ -1978,6 +1986,19 @@ void MKLDNNEltwiseNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
 
+bool MKLDNNEltwiseNode::captureKernel(Kernel& kernel) const {
+    // the reference executor is not a kernel, and the dynamic batch changes the dims of each inference
+    if (isDynBatchEnabled || !std::dynamic_pointer_cast<EltwiseJitExecutor>(execPtr))
+        return false;
+    kernel.function = [](const void* node, const void* args, const mkldnn::stream& strm) {
+        const auto& eltwise = *static_cast<const MKLDNNEltwiseNode*>(node);
+        eltwise.execPtr->exec(eltwise.getArgsPtrs(), eltwise.execPtr->getOutDims());
+    };
+    kernel.kernel = this;
+    kernel.args = nullptr;
+    return true;
+}
+
 void MKLDNNEltwiseNode::setDynamicBatchLim(int lim) {
     MKLDNNNode::setDynamicBatchLim(lim);
 
@@ -117,6 +117,7 @@ public:
     void prepareParams() override;
 
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool captureKernel(Kernel& kernel) const override;
 
     void setDynamicBatchLim(int lim) override;
 
@@ -159,6 +160,9 @@ private:
     std::vector<MKLDNNMemoryPtr> memPtrs = {};
     std::vector<const void*> fqDataPtrs;
 
+    // the pointers to the current memory of the inputs and the output the executor is run with
+    jit_eltwise_call_args_ptrs getArgsPtrs() const;
+
     using Initializer = std::function<void(const std::shared_ptr<ngraph::Node>&, MKLDNNEltwiseNode& node)>;
     static const std::map<const ngraph::DiscreteTypeInfo, Initializer> initializers;
 
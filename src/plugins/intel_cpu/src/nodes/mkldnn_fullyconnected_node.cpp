@@ -349,25 +349,43 @@ void MKLDNNFullyConnectedNode::setDynamicBatchLim(int lim) {
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
     if (prim) {
-        // in cases parameter -> FullyConnected or dynamic shapes
-        // we keep old pointer to data in primArgs on second iteration with same input shapes
-        auto updateMemoryPtr = [this](int argType) {
-            auto param = primArgs.find(argType);
-            if (param != primArgs.end()) {
-                if (argType == DNNL_ARG_SRC && getInputShapeAtPort(DATA_ID).getRank() == 3) {
-                    primArgs.at(argType).set_data_handle(getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetData());
-                }
-                if (argType == DNNL_ARG_DST && getOutputShapeAtPort(0).getRank() == 3) {
-                    primArgs.at(argType).set_data_handle(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetData());
-                }
+        executePrimitive(strm);
+    }
+}
+
+void MKLDNNFullyConnectedNode::executePrimitive(const mkldnn::stream& strm) const {
+    // in cases parameter -> FullyConnected or dynamic shapes
+    // we keep old pointer to data in primArgs on second iteration with same input shapes
+    auto updateMemoryPtr = [this](int argType) {
+        auto param = primArgs.find(argType);
+        if (param != primArgs.end()) {
+            if (argType == DNNL_ARG_SRC && getInputShapeAtPort(DATA_ID).getRank() == 3) {
+                param->second.set_data_handle(getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetData());
+            }
+            if (argType == DNNL_ARG_DST && getOutputShapeAtPort(0).getRank() == 3) {
+                param->second.set_data_handle(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetData());
             }
-        };
+        }
+    };
 
-        updateMemoryPtr(DNNL_ARG_SRC);
-        updateMemoryPtr(DNNL_ARG_DST);
+    updateMemoryPtr(DNNL_ARG_SRC);
+    updateMemoryPtr(DNNL_ARG_DST);
 
-        (*prim).execute(strm, primArgs);
-    }
+    prim.get()->execute(strm, primArgs);
+}
+
+bool MKLDNNFullyConnectedNode::captureKernel(Kernel& kernel) const {
+    if (!prim)
+        return false;
+    // the 3D source and destination are reshaped copies of the memory of the edges, which are set on each inference
+    if (getInputShapeAtPort(DATA_ID).getRank() != 3 && getOutputShapeAtPort(0).getRank() != 3)
+        return capturePrimitive(kernel);
+    kernel.function = [](const void* node, const void* args, const mkldnn::stream& strm) {
+        static_cast<const MKLDNNFullyConnectedNode*>(node)->executePrimitive(strm);
+    };
+    kernel.kernel = this;
+    kernel.args = nullptr;
+    return true;
 }
 
 void MKLDNNFullyConnectedNode::executeDynamicImpl(mkldnn::stream strm) {
@@ -51,10 +51,12 @@ public:
 
     void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool captureKernel(Kernel& kernel) const override;
 
     void setDynamicBatchLim(int lim) override;
 
 private:
+    void executePrimitive(const mkldnn::stream& strm) const;
     void createDescriptorInternal(const mkldnn::memory::desc &inputDesc,
                                   const mkldnn::memory::desc &outputDesc);
 
@@ -7,6 +7,7 @@
 
 #include "ie_parallel.hpp"
 #include "mkldnn_gather_node.h"
+#include "mkldnn_memory_node.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
 #include <utils/general_utils.h>
@@ -206,6 +207,9 @@ bool MKLDNNGatherNode::needPrepareParams() const {
 }
 
 void MKLDNNGatherNode::prepareParams() {
+    if (reorderedState)
+        return;
+
     auto& dataMemPtr = getParentEdgeAt(GATHER_DATA)->getMemoryPtr();
     if (!dataMemPtr || !dataMemPtr->isAllocated())
         THROW_ERROR << " has not allocated input data memory.";
@@ -261,6 +265,11 @@ void MKLDNNGatherNode::prepareParams() {
 }
 
 void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+    if (reorderedState) {
+        execReorderState();
+        return;
+    }
+
     if (jitKernel && jitKernel->isSupportedConfiguration(afterAxisSize)) {
         const void* srcIndices = getParentEdgeAt(GATHER_INDICES)->getMemoryPtr()->GetPtr();
         const void* srcData = getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr();
@@ -314,6 +323,11 @@ void MKLDNNGatherNode::execute(mkldnn::stream strm) {
 }
 
 void MKLDNNGatherNode::executeDynamicImpl(mkldnn::stream strm) {
+    if (reorderedState) {
+        execReorderState();
+        return;
+    }
+
     if (jitKernel && jitKernel->isSupportedConfiguration(afterAxisSize)) {
         const void* srcIndices = getParentEdgeAt(GATHER_INDICES)->getMemoryPtr()->GetPtr();
         const void* srcData = getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr();
@@ -472,6 +486,28 @@ void MKLDNNGatherNode::execReference() {
     });
 }
 
+bool MKLDNNGatherNode::canReorderState(size_t appendAxis) const {
+    return isAxisInputConst && batchDims == 0 && getInputShapeAtPort(GATHER_INDICES).getRank() == 1 &&
+           static_cast<size_t>(axis) < appendAxis;
+}
+
+void MKLDNNGatherNode::execReorderState() {
+    const auto& state = reorderedState->getState();
+    const auto& idxMemPtr = getParentEdgeAt(GATHER_INDICES)->getMemoryPtr();
+    const int32_t* srcIndices = reinterpret_cast<const int32_t*>(idxMemPtr->GetPtr());
+    const size_t beams = state->getDims()[axis];
+
+    std::vector<int32_t> indices(srcIndices, srcIndices + idxMemPtr->getStaticDims()[0]);
+    if (reverseIndexing) {
+        for (auto& index : indices) {
+            if (index < 0)
+                index += static_cast<int32_t>(beams);
+        }
+    }
+    // the data is not copied, the state follows the new order of the beams and the concat reads it
+    state->reorderBeams(axis, indices.data(), indices.size());
+}
+
 std::vector<VectorDims> MKLDNNGatherNode::shapeInfer() const {
     return MKLDNNNode::shapeInferGeneric(PortMask(1, 2, 3));
 }
@@ -13,6 +13,8 @@
 
 namespace MKLDNNPlugin {
 
+class MKLDNNMemoryInputNode;
+
 class MKLDNNGatherNode : public MKLDNNNode {
 public:
     MKLDNNGatherNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -25,6 +27,13 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    // whether the node can reorder the beams of a state appended along the axis
+    bool canReorderState(size_t appendAxis) const;
+    // the beams of the state are reordered in place instead of gathering the input data
+    void setReorderedState(MKLDNNMemoryInputNode* state) {
+        reorderedState = state;
+    }
+
     struct threadExecParams {
         std::vector<int> specIdxInBytes;
         std::vector<int> permIdxMask;
@@ -52,6 +61,7 @@ protected:
 private:
     void initShortParams(threadExecParams& p, uint64_t start);
     void execReference();
+    void execReorderState();
 
     bool isDataShapeStat = false;
     bool isIdxShapeStat = false;
@@ -84,6 +94,9 @@ private:
     static constexpr size_t GATHER_AXIS = 2;
 
     std::shared_ptr<jitGatherKernelBase> jitKernel;
+
+    // ReadValue -> Gather by the beam indices -> Concat -> Assign of a beam search
+    MKLDNNMemoryInputNode* reorderedState = nullptr;
 };
 
 }  // namespace MKLDNNPlugin
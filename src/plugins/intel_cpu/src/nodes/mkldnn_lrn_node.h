@@ -30,6 +30,9 @@ public:
 
     void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool captureKernel(Kernel& kernel) const override {
+        return capturePrimitive(kernel);
+    }
     std::vector<VectorDims> shapeInfer() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
@@ -37,6 +37,9 @@ public:
 
     void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool captureKernel(Kernel& kernel) const override {
+        return capturePrimitive(kernel);
+    }
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     const std::vector<impl_desc_type>& getPrimitivesPriority() override;
@@ -6,7 +6,6 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
-#include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/ngraph_utils.hpp"
@@ -25,10 +24,18 @@ MKLDNNMemoryNode::MKLDNNMemoryNode(const std::shared_ptr<ngraph::Node>& op) {
     }
 }
 
+std::string MKLDNNMemoryNode::getVariableName() {
+    auto name = _id;
+    auto suffix_idx = name.find("/id=");
+    if (suffix_idx != std::string::npos)
+        name = name.substr(0, suffix_idx);
+    return name;
+}
+
 bool MKLDNNMemoryOutputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_input_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -80,13 +87,16 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
     auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
+    // the producer has already appended the new data to the state
+    if (inputMemoryNode->isExtendedInPlace())
+        return;
     inputMemoryNode->storeState(srcMemory);
 }
 
 bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_output_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -103,7 +113,7 @@ bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngr
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(op, eng, cache), MKLDNNMemoryNode(op) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -116,51 +126,72 @@ MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>
 void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    state = createState();
+}
 
-    // default memory state is zero filled
-    if (dataStore->getDesc().hasDefinedMaxSize())
-        dataStore->FillZero();
+MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
+    MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
 }
 
-/**
- * Copy data from one tensor into other.
- * As is. Assume that data is dense tensor with same layout.
- * @param dst destination memory object
- * @param src source memory object
- */
-inline
-static void simple_copy(const MKLDNNMemory& dst, const MKLDNNMemory& src) {
-    auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
-    auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
-    auto srcSizeInByte = src.GetSize();
-    auto dstSizeInByte = dst.GetSize();
+InferenceEngine::Precision MKLDNNMemoryInputNode::getStatePrecision() const {
+    const auto selectedPd = getSelectedPrimitiveDescriptor();
+    if (selectedPd == nullptr)
+        IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+    return selectedPd->getConfig().outConfs[0].getMemDesc()->getPrecision();
+}
 
-    IE_ASSERT(srcSizeInByte == dstSizeInByte) << "Memory objects are not compatible. Has different sizes.";
+std::shared_ptr<StateBuffer> MKLDNNMemoryInputNode::createState() const {
+    auto newState = std::make_shared<StateBuffer>(getStatePrecision().size(), stateAxis);
+    // default memory state is zero filled, a dynamic one is taken from the init value on the first inference
+    if (!isDynamicNode())
+        newState->reset(getOutputShapeAtPort(0).getStaticDims());
+    return newState;
+}
 
-    cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
+void MKLDNNMemoryInputNode::setExtendedInPlace(size_t axis) {
+    extendedInPlace = true;
+    stateAxis = axis;
+    state = createState();
 }
 
-MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
+bool MKLDNNMemoryInputNode::isStateSet() const {
+    return !isDynamicNode() || !state->getDims().empty();
 }
 
-MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
-    return dataStore;
+std::vector<VectorDims> MKLDNNMemoryInputNode::shapeInfer() const {
+    if (isStateSet())
+        return {state->getDims()};
+    if (!getParentEdges().empty())
+        return {getParentEdgesAtPort(0)[0]->getMemory().getStaticDims()};
+
+    auto dims = getOutputShapeAtPort(0).getDims();
+    for (auto& dim : dims) {
+        if (dim == Shape::UNDEFINED_DIM)
+            dim = 0;
+    }
+    return {dims};
 }
 
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    state->assign(new_state.GetPtr(), new_state.getStaticDims());
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    if (!isStateSet()) {
+        if (!getParentEdges().empty()) {
+            const auto& initMemory = getParentEdgeAt(0)->getMemory();
+            state->assign(initMemory.GetPtr(), initMemory.getStaticDims());
+        } else {
+            state->reset(dstMemory.getStaticDims());
+        }
+    }
+
+    if (extendedInPlace)
+        return;
+
+    // the dense copy of the state, the data is laid out with the reserved capacity inside the storage
+    state->read(dstMemory.GetPtr());
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
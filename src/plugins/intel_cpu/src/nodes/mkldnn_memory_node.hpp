@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include "ie_algorithm.hpp"
 #include "mkldnn_input_node.h"
+#include "common/state_buffer.h"
 #include <mkldnn_node.h>
 #include <string>
 #include <memory>
@@ -23,6 +24,8 @@ class MKLDNNMemoryNode {
     std::string getId() {
         return _id;
     }
+    // the variable id without the internal suffix with the pair ID
+    std::string getVariableName();
     virtual void setInputNode(MKLDNNNode *) = 0;
 };
 class MKLDNNMemoryOutputNode;
@@ -64,10 +67,14 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
     bool created() const override {
         return getType() == MemoryOutput;
     }
 
+    bool needShapeInfer() const override { return false; }
+    bool needPrepareParams() const override { return false; }
+
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
@@ -93,14 +100,45 @@ public:
         return true;
     }
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
 
     void createPrimitive() override;
 
+    bool needShapeInfer() const override { return isDynamicNode(); }
+    std::vector<VectorDims> shapeInfer() const override;
+
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
-    MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief the storage the node reads and the paired MemoryOutput writes, each infer request sets its own one
+     */
+    const std::shared_ptr<StateBuffer>& getState() const {
+        return state;
+    }
+    void setState(const std::shared_ptr<StateBuffer>& newState) {
+        state = newState;
+    }
+    // a new storage holding the initial value of the variable
+    std::shared_ptr<StateBuffer> createState() const;
+    InferenceEngine::Precision getStatePrecision() const;
+
+    /**
+     * @brief the state is extended in place by the consumer, e.g. the Concat of the keys or the values of a decoder,
+     * so the node doesn't copy it to the output and the paired MemoryOutput doesn't store it back
+     */
+    void setExtendedInPlace(size_t axis);
+    bool isExtendedInPlace() const {
+        return extendedInPlace;
+    }
+
  private:
-    MKLDNNMemoryPtr dataStore;
+    // the state of a dynamic node is not set until the first inference or after a reset, the init value is used then
+    bool isStateSet() const;
+
+    std::shared_ptr<StateBuffer> state;
+    size_t stateAxis = 0;
+    bool extendedInPlace = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -29,6 +29,9 @@ public:
 
     void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool captureKernel(Kernel& kernel) const override {
+        return capturePrimitive(kernel);
+    }
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
@@ -348,13 +348,32 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
     } else if (canUseNcsp2Nspc) {
         optimizedNcsp2Nspc();
     } else {
-        src_blocked->setDataHandle(getParentEdgeAt(0)->getMemory().GetData());
-        dst_blocked->setDataHandle(getChildEdgeAt(0)->getMemory().GetData());
+        executePrimitive(strm);
+    }
+}
 
-        MKLDNNNode::execute(strm);
+void MKLDNNReorderNode::executePrimitive(const mkldnn::stream& strm) const {
+    src_blocked->setDataHandle(getParentEdgeAt(0)->getMemory().GetData());
+    dst_blocked->setDataHandle(getChildEdgeAt(0)->getMemory().GetData());
+
+    if (prim) {
+        prim.get()->execute(strm, primArgs);
     }
 }
 
+bool MKLDNNReorderNode::captureKernel(Kernel& kernel) const {
+    // the optimized layout conversions are not run by the primitive
+    if (isOptimized || canUseNspc2Ncsp || canUseNcsp2Nspc || !prim)
+        return false;
+    // the memory of the edges is set to the blocked memory of the primitive on each inference
+    kernel.function = [](const void* node, const void* args, const mkldnn::stream& strm) {
+        static_cast<const MKLDNNReorderNode*>(node)->executePrimitive(strm);
+    };
+    kernel.kernel = this;
+    kernel.args = nullptr;
+    return true;
+}
+
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
     if (prim) {
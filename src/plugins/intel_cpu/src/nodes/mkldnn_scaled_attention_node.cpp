@@ -0,0 +1,229 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <limits>
+#include <numeric>
+#include <functional>
+
+#include "mkldnn_scaled_attention_node.h"
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+#include "common/cpu_convert.h"
+#include "common/attention_kernels.hpp"
+#include "ngraph_transformations/op/scaled_attention.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNScaledAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const ScaledAttentionNode>(op)) {
+            errorMessage = "Only ScaledDotProductAttention operation from the CPU plugin opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledAttentionNode::MKLDNNScaledAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                     MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledDotProductAttention node with name '" + getName() + "'";
+    const auto attention = std::dynamic_pointer_cast<const ScaledAttentionNode>(op);
+    scale = attention->get_scale();
+    keyTransposed = attention->get_key_transposed();
+
+    const auto inputsNumber = getOriginalInputsNumber();
+    if (inputsNumber != 3 && inputsNumber != 4)
+        IE_THROW() << errorPrefix << " has invalid number of input edges: " << inputsNumber;
+    withMask = inputsNumber == 4;
+}
+
+void MKLDNNScaledAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the tiles are converted to fp32 by the node, so the integer inputs are taken as is
+    auto getInputPrecision = [&](size_t port) {
+        const auto precision = getOriginalInputPrecisionAtPort(port);
+        return one_of(precision, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8) ? precision : Precision::FP32;
+    };
+
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, getInputPrecision(QUERY)},
+                                                       {LayoutType::ncsp, getInputPrecision(KEY)},
+                                                       {LayoutType::ncsp, getInputPrecision(VALUE)}});
+    if (withMask)
+        inDataConfigurators.push_back({LayoutType::ncsp, Precision::FP32});
+
+    const auto outputPrecision = getOriginalOutputPrecisionAtPort(0) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, outputPrecision}}, impl_desc_type::ref_any);
+}
+
+std::vector<size_t> MKLDNNScaledAttentionNode::getBatchOffsets(const VectorDims& dims, const VectorDims& strides, const VectorDims& batchDims) {
+    const size_t batchCount = std::accumulate(batchDims.begin(), batchDims.end(), size_t(1), std::multiplies<size_t>());
+    std::vector<size_t> offsets(batchCount, 0);
+    for (size_t batch = 0; batch < batchCount; batch++) {
+        size_t rest = batch;
+        for (size_t i = batchDims.size(); i-- > 0;) {
+            const size_t coordinate = rest % batchDims[i];
+            rest /= batchDims[i];
+            if (dims[i] != 1)
+                offsets[batch] += coordinate * strides[i];
+        }
+    }
+    return offsets;
+}
+
+void MKLDNNScaledAttentionNode::prepareParams() {
+    const auto& queryMem = getParentEdgeAt(QUERY)->getMemory();
+    const auto& keyMem = getParentEdgeAt(KEY)->getMemory();
+    const auto& valueMem = getParentEdgeAt(VALUE)->getMemory();
+    const auto& outputDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+
+    const size_t rank = outputDims.size();
+    const VectorDims batchDims(outputDims.begin(), outputDims.end() - 2);
+    batchCount = std::accumulate(batchDims.begin(), batchDims.end(), size_t(1), std::multiplies<size_t>());
+
+    const auto& queryDims = queryMem.getStaticDims();
+    const auto& keyDims = keyMem.getStaticDims();
+    const auto& valueDims = valueMem.getStaticDims();
+    queryLen = queryDims[rank - 2];
+    headSize = queryDims[rank - 1];
+    seqLen = keyDims[keyTransposed ? rank - 1 : rank - 2];
+    valueSize = valueDims[rank - 1];
+
+    queryOffsets = getBatchOffsets(queryDims, queryMem.GetDescWithType<BlockedMemoryDesc>()->getStrides(), batchDims);
+    keyOffsets = getBatchOffsets(keyDims, keyMem.GetDescWithType<BlockedMemoryDesc>()->getStrides(), batchDims);
+    valueOffsets = getBatchOffsets(valueDims, valueMem.GetDescWithType<BlockedMemoryDesc>()->getStrides(), batchDims);
+
+    if (withMask) {
+        const auto& maskMem = getParentEdgeAt(MASK)->getMemory();
+        const auto& maskDims = maskMem.getStaticDims();
+        const auto maskStrides = maskMem.GetDescWithType<BlockedMemoryDesc>()->getStrides();
+        // the mask is broadcast numpy-style to [..., queryLen, seqLen]
+        VectorDims alignedDims(rank, 1);
+        VectorDims alignedStrides(rank, 0);
+        const size_t shift = rank - maskDims.size();
+        for (size_t i = 0; i < maskDims.size(); i++) {
+            alignedDims[shift + i] = maskDims[i];
+            alignedStrides[shift + i] = maskStrides[i];
+        }
+        maskRowStride = alignedDims[rank - 2] == 1 ? 0 : alignedStrides[rank - 2];
+        maskColStride = alignedDims[rank - 1] == 1 ? 0 : alignedStrides[rank - 1];
+        maskOffsets = getBatchOffsets(alignedDims, alignedStrides, batchDims);
+    }
+}
+
+void MKLDNNScaledAttentionNode::execute(mkldnn::stream strm) {
+    const auto& queryMem = getParentEdgeAt(QUERY)->getMemory();
+    const auto& keyMem = getParentEdgeAt(KEY)->getMemory();
+    const auto& valueMem = getParentEdgeAt(VALUE)->getMemory();
+    const auto& outputMem = getChildEdgeAt(0)->getMemory();
+
+    const auto queryPrecision = queryMem.getDesc().getPrecision();
+    const auto keyPrecision = keyMem.getDesc().getPrecision();
+    const auto valuePrecision = valueMem.getDesc().getPrecision();
+    const auto outputPrecision = outputMem.getDesc().getPrecision();
+
+    const auto* queryData = reinterpret_cast<const uint8_t*>(queryMem.GetPtr());
+    const auto* keyData = reinterpret_cast<const uint8_t*>(keyMem.GetPtr());
+    const auto* valueData = reinterpret_cast<const uint8_t*>(valueMem.GetPtr());
+    const auto* maskData = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK)->getMemory().GetPtr()) : nullptr;
+    auto* outputData = reinterpret_cast<uint8_t*>(outputMem.GetPtr());
+
+    const size_t rowBlocks = div_up(queryLen, queryBlock);
+    const size_t workAmount = batchCount * rowBlocks;
+    if (workAmount == 0)
+        return;
+
+    // fp32 tensors are used in place, the others are converted once per batch index by every thread
+    const bool directQuery = queryPrecision == Precision::FP32;
+    const bool directKey = keyPrecision == Precision::FP32 && !keyTransposed;
+    const bool directValue = valuePrecision == Precision::FP32;
+    const bool directOutput = outputPrecision == Precision::FP32;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> queryBuffer(directQuery ? 0 : queryBlock * headSize);
+        std::vector<float> keyBuffer(directKey ? 0 : seqLen * headSize);
+        std::vector<float> transposeBuffer(keyTransposed && keyPrecision != Precision::FP32 ? seqLen * headSize : 0);
+        std::vector<float> valueBuffer(directValue ? 0 : seqLen * valueSize);
+        std::vector<float> outputBuffer(directOutput ? 0 : queryBlock * valueSize);
+        std::vector<float> scratch(2 * queryBlock + seqLen);
+
+        const float* key = nullptr;
+        const float* value = nullptr;
+        size_t currentBatch = std::numeric_limits<size_t>::max();
+        for (size_t item = start; item < end; item++) {
+            const size_t batch = item / rowBlocks;
+            const size_t rowStart = (item % rowBlocks) * queryBlock;
+            const size_t rows = std::min(queryBlock, queryLen - rowStart);
+
+            if (batch != currentBatch) {
+                const uint8_t* keySrc = keyData + keyOffsets[batch] * keyPrecision.size();
+                if (directKey) {
+                    key = reinterpret_cast<const float*>(keySrc);
+                } else if (!keyTransposed) {
+                    cpu_convert(keySrc, keyBuffer.data(), keyPrecision, Precision::FP32, seqLen * headSize);
+                    key = keyBuffer.data();
+                } else {
+                    const float* transposed = reinterpret_cast<const float*>(keySrc);
+                    if (keyPrecision != Precision::FP32) {
+                        cpu_convert(keySrc, transposeBuffer.data(), keyPrecision, Precision::FP32, seqLen * headSize);
+                        transposed = transposeBuffer.data();
+                    }
+                    for (size_t d = 0; d < headSize; d++) {
+                        for (size_t s = 0; s < seqLen; s++)
+                            keyBuffer[s * headSize + d] = transposed[d * seqLen + s];
+                    }
+                    key = keyBuffer.data();
+                }
+
+                const uint8_t* valueSrc = valueData + valueOffsets[batch] * valuePrecision.size();
+                if (directValue) {
+                    value = reinterpret_cast<const float*>(valueSrc);
+                } else {
+                    cpu_convert(valueSrc, valueBuffer.data(), valuePrecision, Precision::FP32, seqLen * valueSize);
+                    value = valueBuffer.data();
+                }
+                currentBatch = batch;
+            }
+
+            const uint8_t* querySrc = queryData + (queryOffsets[batch] + rowStart * headSize) * queryPrecision.size();
+            const float* query = reinterpret_cast<const float*>(querySrc);
+            if (!directQuery) {
+                cpu_convert(querySrc, queryBuffer.data(), queryPrecision, Precision::FP32, rows * headSize);
+                query = queryBuffer.data();
+            }
+
+            const float* mask = withMask ? maskData + maskOffsets[batch] + rowStart * maskRowStride : nullptr;
+            uint8_t* outputDst = outputData + (batch * queryLen + rowStart) * valueSize * outputPrecision.size();
+            float* output = directOutput ? reinterpret_cast<float*>(outputDst) : outputBuffer.data();
+
+            InferenceEngine::Extensions::Cpu::XARCH::scaled_attention_rows(query, rows, key, value, mask, maskRowStride, maskColStride,
+                                                                          seqLen, headSize, valueSize, scale, output, scratch.data());
+
+            if (!directOutput)
+                cpu_convert(outputBuffer.data(), outputDst, Precision::FP32, outputPrecision, rows * valueSize);
+        }
+    });
+}
+
+bool MKLDNNScaledAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledAttentionNode, ScaledDotProductAttention)
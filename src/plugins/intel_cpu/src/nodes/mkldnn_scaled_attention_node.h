@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNScaledAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
+
+    void prepareParams() override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    // offsets of the [..., rows, cols] matrices of the input for every batch index of the output, broadcast batch dimensions repeat
+    static std::vector<size_t> getBatchOffsets(const VectorDims& dims, const VectorDims& strides, const VectorDims& batchDims);
+
+    float scale;
+    bool keyTransposed;
+    bool withMask;
+    std::string errorPrefix;
+
+    size_t batchCount = 0;
+    size_t queryLen = 0;
+    size_t headSize = 0;
+    size_t seqLen = 0;
+    size_t valueSize = 0;
+    std::vector<size_t> queryOffsets;
+    std::vector<size_t> keyOffsets;
+    std::vector<size_t> valueOffsets;
+    std::vector<size_t> maskOffsets;
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+
+    const size_t QUERY = 0;
+    const size_t KEY = 1;
+    const size_t VALUE = 2;
+    const size_t MASK = 3;
+    // number of the query rows processed by a thread against one block of the keys
+    const size_t queryBlock = 32;
+};
+
+}  // namespace MKLDNNPlugin
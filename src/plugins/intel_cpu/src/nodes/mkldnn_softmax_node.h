@@ -26,6 +26,9 @@ public:
 
     void prepareParams() override;
     void executeDynamicImpl(mkldnn::stream strm) override;
+    bool captureKernel(Kernel& kernel) const override {
+        return capturePrimitive(kernel);
+    }
     std::vector<VectorDims> shapeInfer() const override;
 
 private:
@@ -6,12 +6,17 @@
 
 #include <chrono>
 #include <ratio>
+#include <string>
+
+#include "utils/perf_events.h"
 
 namespace MKLDNNPlugin {
 
 class PerfCount {
     uint64_t total_duration;
     uint32_t num;
+    HwCounters hw_total;
+    uint32_t hw_num = 0;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
@@ -25,6 +30,9 @@ public:
 
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
 
+    bool has_hw() const { return hw_num != 0; }
+    HwCounters hw_avg() const { return (hw_num == 0) ? HwCounters{} : hw_total / hw_num; }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -36,7 +44,13 @@ private:
         num++;
     }
 
+    void add_hw(const HwCounters& counters) {
+        hw_total += counters;
+        hw_num++;
+    }
+
     friend class PerfHelper;
+    friend class HwPerfHelper;
 };
 
 class PerfHelper {
@@ -48,7 +62,33 @@ public:
     ~PerfHelper() { counter.finish_itr(); }
 };
 
+class HwPerfHelper {
+    PerfCount &counter;
+    HwProfiler &profiler;
+    const std::string &name;
+    const std::string &type;
+    uint64_t startUs;
+    HwCounters start;
+
+public:
+    HwPerfHelper(PerfCount &count, HwProfiler &prof, const std::string &nodeName, const std::string &nodeType)
+        : counter(count), profiler(prof), name(nodeName), type(nodeType) {
+        startUs = HwProfiler::nowUs();
+        start = profiler.readCounters();
+    }
+
+    ~HwPerfHelper() {
+        const auto delta = profiler.readCounters() - start;
+        if (profiler.countsEvents())
+            counter.add_hw(delta);
+        profiler.addTraceEvent(name, type, startUs, HwProfiler::nowUs() - startUs, delta);
+    }
+};
+
 }  // namespace MKLDNNPlugin
 
 #define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
 #define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define GET_HW_PERF(_node, _profiler) \
+    std::unique_ptr<HwPerfHelper>(new HwPerfHelper(_node->PerfCounter(), *_profiler, _node->getName(), _node->getTypeStr()))
+#define HW_PERF(_node, _profiler) auto hwpc = _profiler ? GET_HW_PERF(_node, _profiler) : nullptr;
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streams_executor_switch.h"
+
+#include <utility>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// the switch and the executor of the task running on the thread. The tasks of the switches of different
+// networks may nest, as an inference run from the callback of another one, so the outer ones are restored
+struct RunningTask {
+    const StreamsExecutorSwitch* executorSwitch = nullptr;
+    IStreamsExecutor* executor = nullptr;
+};
+
+thread_local RunningTask runningTask;
+
+class RunningTaskScope {
+public:
+    RunningTaskScope(const StreamsExecutorSwitch* executorSwitch, IStreamsExecutor* executor) : outer(runningTask) {
+        runningTask = {executorSwitch, executor};
+    }
+    ~RunningTaskScope() {
+        runningTask = outer;
+    }
+
+private:
+    RunningTask outer;
+};
+
+}  // namespace
+
+StreamsExecutorSwitch::StreamsExecutorSwitch(const IStreamsExecutor::Ptr& target) : currentTarget(target) {}
+
+void StreamsExecutorSwitch::setTarget(const IStreamsExecutor::Ptr& target) {
+    std::lock_guard<std::mutex> lock{guard};
+    currentTarget = target;
+}
+
+IStreamsExecutor::Ptr StreamsExecutorSwitch::getTarget() const {
+    std::lock_guard<std::mutex> lock{guard};
+    return currentTarget;
+}
+
+Task StreamsExecutorSwitch::bind(const IStreamsExecutor::Ptr& target, Task task) const {
+    return [this, target, task] {
+        RunningTaskScope scope{this, target.get()};
+        task();
+    };
+}
+
+void StreamsExecutorSwitch::run(Task task) {
+    auto target = getTarget();
+    target->run(bind(target, std::move(task)));
+}
+
+void StreamsExecutorSwitch::Execute(Task task) {
+    auto target = getTarget();
+    target->Execute(bind(target, std::move(task)));
+}
+
+IStreamsExecutor* StreamsExecutorSwitch::runningExecutor() const {
+    return runningTask.executorSwitch == this ? runningTask.executor : nullptr;
+}
+
+int StreamsExecutorSwitch::GetStreamId() {
+    if (auto executor = runningExecutor())
+        return executor->GetStreamId();
+    return getTarget()->GetStreamId();
+}
+
+int StreamsExecutorSwitch::GetNumaNodeId() {
+    if (auto executor = runningExecutor())
+        return executor->GetNumaNodeId();
+    return getTarget()->GetNumaNodeId();
+}
+
+}  // namespace MKLDNNPlugin
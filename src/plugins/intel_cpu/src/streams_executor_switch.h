@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <threading/ie_istreams_executor.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Streams executor forwarding the tasks to the current streams executor of a network, which is replaced when the
+ * streams of the network are reconfigured. The infer requests keep the switch, so the requests created before
+ * the reconfiguration run their asynchronous and synchronous inferences on the new streams.
+ * The stream and the NUMA node ids queried by a task are the ones of the executor running it, even if the target
+ * is replaced meanwhile, the other callers get the ones of the current target.
+ */
+class StreamsExecutorSwitch : public InferenceEngine::IStreamsExecutor {
+public:
+    using Ptr = std::shared_ptr<StreamsExecutorSwitch>;
+
+    explicit StreamsExecutorSwitch(const InferenceEngine::IStreamsExecutor::Ptr& target);
+
+    // the next tasks are run by the new target, the ones already submitted are completed by the previous one
+    void setTarget(const InferenceEngine::IStreamsExecutor::Ptr& target);
+    InferenceEngine::IStreamsExecutor::Ptr getTarget() const;
+
+    void run(InferenceEngine::Task task) override;
+    void Execute(InferenceEngine::Task task) override;
+    int GetStreamId() override;
+    int GetNumaNodeId() override;
+
+private:
+    // the executor running the task of the switch on the current thread, if any
+    InferenceEngine::IStreamsExecutor* runningExecutor() const;
+    InferenceEngine::Task bind(const InferenceEngine::IStreamsExecutor::Ptr& target, InferenceEngine::Task task) const;
+
+    mutable std::mutex guard;
+    InferenceEngine::IStreamsExecutor::Ptr currentTarget;
+};
+
+}  // namespace MKLDNNPlugin
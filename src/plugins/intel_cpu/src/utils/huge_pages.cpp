@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "huge_pages.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include <common/utils.hpp>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+const size_t hugePageSize = 2ul << 20;
+const size_t gigantPageSize = 1ul << 30;
+
+enum class Backing {
+    Explicit,
+    Transparent,
+    Fallback,
+};
+
+struct Allocation {
+    size_t size;
+    Backing backing;
+};
+
+struct Registry {
+    std::mutex guard;
+    std::unordered_map<void*, Allocation> allocations;
+    HugePagesStats stats;
+
+    size_t& bytes(Backing backing) {
+        switch (backing) {
+        case Backing::Explicit: return stats.explicitBytes;
+        case Backing::Transparent: return stats.transparentBytes;
+        default: return stats.fallbackBytes;
+        }
+    }
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+thread_local HugePagesMode threadMode = HugePagesMode::Disabled;
+
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+#ifdef __linux__
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+void* mapHugeTlb(size_t size, size_t pageSize, int pageSizeLog) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (pageSizeLog << MAP_HUGE_SHIFT), -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+#endif
+
+}  // namespace
+
+HugePagesMode HugePagesAllocator::currentMode() {
+    return threadMode;
+}
+
+bool HugePagesAllocator::isEligible(size_t size) {
+    return threadMode != HugePagesMode::Disabled && size >= hugePageSize;
+}
+
+void* HugePagesAllocator::allocate(size_t size) {
+    void* ptr = nullptr;
+    Allocation allocation{size, Backing::Fallback};
+
+#ifdef __linux__
+    if (threadMode == HugePagesMode::Explicit) {
+        // the pool of the pages is reserved by the administrator, the mapping fails at once if it is exhausted
+        if (size >= gigantPageSize) {
+            allocation.size = roundUp(size, gigantPageSize);
+            ptr = mapHugeTlb(allocation.size, gigantPageSize, 30);
+        }
+        if (!ptr) {
+            allocation.size = roundUp(size, hugePageSize);
+            ptr = mapHugeTlb(allocation.size, hugePageSize, 21);
+        }
+        if (ptr)
+            allocation.backing = Backing::Explicit;
+        else
+            allocation.size = size;
+    }
+#endif
+
+    if (!ptr) {
+        ptr = dnnl::impl::malloc(size, static_cast<int>(hugePageSize));
+        if (!ptr)
+            return nullptr;
+#ifdef __linux__
+        // only the whole huge pages inside the buffer are advised, the tail stays on the regular ones
+        if (madvise(ptr, size / hugePageSize * hugePageSize, MADV_HUGEPAGE) == 0)
+            allocation.backing = Backing::Transparent;
+#endif
+    }
+
+    auto& instance = registry();
+    std::lock_guard<std::mutex> lock(instance.guard);
+    instance.allocations[ptr] = allocation;
+    instance.bytes(allocation.backing) += allocation.size;
+    return ptr;
+}
+
+void HugePagesAllocator::free(void* ptr) {
+    if (!ptr)
+        return;
+
+    Allocation allocation{0, Backing::Fallback};
+    {
+        auto& instance = registry();
+        std::lock_guard<std::mutex> lock(instance.guard);
+        auto found = instance.allocations.find(ptr);
+        if (found == instance.allocations.end())
+            return;
+        allocation = found->second;
+        instance.bytes(allocation.backing) -= allocation.size;
+        instance.allocations.erase(found);
+    }
+
+#ifdef __linux__
+    if (allocation.backing == Backing::Explicit) {
+        munmap(ptr, allocation.size);
+        return;
+    }
+#endif
+    dnnl::impl::free(ptr);
+}
+
+HugePagesStats HugePagesAllocator::stats() {
+    auto& instance = registry();
+    std::lock_guard<std::mutex> lock(instance.guard);
+    return instance.stats;
+}
+
+HugePagesScope::HugePagesScope(HugePagesMode mode) : previous(threadMode) {
+    threadMode = mode;
+}
+
+HugePagesScope::~HugePagesScope() {
+    threadMode = previous;
+}
+
+}  // namespace MKLDNNPlugin
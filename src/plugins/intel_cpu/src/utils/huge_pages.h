@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace MKLDNNPlugin {
+
+enum class HugePagesMode {
+    Disabled,
+    // transparent huge pages requested by madvise
+    Transparent,
+    // hugetlbfs pages (1 GB for the buffers of at least 1 GB, 2 MB otherwise), the transparent ones if the pool is empty
+    Explicit,
+};
+
+/**
+ * Amount of the memory currently allocated by HugePagesAllocator.
+ * The transparent huge pages are only advised, the kernel may still back a part of them by the regular pages.
+ * The fallback bytes are the buffers the huge pages were requested for but the regular allocation was used.
+ */
+struct HugePagesStats {
+    size_t explicitBytes = 0;
+    size_t transparentBytes = 0;
+    size_t fallbackBytes = 0;
+};
+
+/**
+ * Allocator of the large buffers (the graph workspace, the weights, the constants) backed by the huge pages, which
+ * reduces the TLB misses when the buffers are streamed. The mode is set for the allocations of the current thread
+ * by HugePagesScope. The explicit pages fall back to the transparent ones and those to the regular allocation,
+ * so allocate() fails only if the memory is exhausted.
+ */
+class HugePagesAllocator {
+public:
+    static HugePagesMode currentMode();
+    // the buffers smaller than a huge page are left to the regular allocation
+    static bool isEligible(size_t size);
+
+    static void* allocate(size_t size);
+    static void free(void* ptr);
+
+    static HugePagesStats stats();
+};
+
+// sets the huge pages mode of the allocations made by the current thread until the end of the scope
+class HugePagesScope {
+public:
+    explicit HugePagesScope(HugePagesMode mode);
+    ~HugePagesScope();
+
+    HugePagesScope(const HugePagesScope&) = delete;
+    HugePagesScope& operator=(const HugePagesScope&) = delete;
+
+private:
+    HugePagesMode previous;
+};
+
+}  // namespace MKLDNNPlugin
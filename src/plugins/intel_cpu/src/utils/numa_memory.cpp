@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <common/utils.hpp>
+#include <ie_system_conf.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+#ifdef __linux__
+// from linux/mempolicy.h, which is not shipped by every toolchain
+const int mpolPreferred = 1;
+const unsigned mpolMoveFlag = 1u << 1;
+#endif
+
+// the blobs start at a page, so their first page is placed as well
+const int blobAlignment = 4096;
+
+class NumaAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit NumaAllocator(int numaNodeId) : numaNodeId(numaNodeId) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        void* ptr = dnnl::impl::malloc(size, blobAlignment);
+        // the fresh pages are not touched yet, so they are placed without a migration
+        if (ptr)
+            bindToNumaNode(ptr, size, numaNodeId);
+        return ptr;
+    }
+
+    bool free(void* handle) noexcept override {
+        dnnl::impl::free(handle);
+        return true;
+    }
+
+private:
+    int numaNodeId;
+};
+
+}  // namespace
+
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+#ifdef __linux__
+    if (!ptr || numaNodeForBinding(numaNodeId, true) < 0)
+        return false;
+
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) / pageSize * pageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / pageSize * pageSize;
+    if (begin >= end)
+        return false;
+
+    const size_t bitsPerWord = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> nodeMask(numaNodeId / bitsPerWord + 1, 0);
+    nodeMask[numaNodeId / bitsPerWord] = 1ul << (numaNodeId % bitsPerWord);
+    // the kernel ignores the last bit of maxnode
+    const unsigned long maxNode = nodeMask.size() * bitsPerWord + 1;
+    return syscall(SYS_mbind, begin, end - begin, mpolPreferred, nodeMask.data(), maxNode, mpolMoveFlag) == 0;
+#else
+    return false;
+#endif
+}
+
+int numaNodeForBinding(int numaNodeId, bool bindingEnabled) {
+    if (!bindingEnabled || numaNodeId < 0)
+        return -1;
+    return InferenceEngine::getAvailableNUMANodes().size() > 1 ? numaNodeId : -1;
+}
+
+std::shared_ptr<InferenceEngine::IAllocator> createNumaAllocator(int numaNodeId) {
+    return std::make_shared<NumaAllocator>(numaNodeId);
+}
+
+}  // namespace MKLDNNPlugin
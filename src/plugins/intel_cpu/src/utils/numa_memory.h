@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <ie_allocator.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Places the pages of the memory region on the NUMA node, the pages already touched are migrated.
+ * Only the pages completely covered by the region are placed, so the neighbour allocations are not affected.
+ * The placement is a preference, the memory is taken from the other nodes if the node runs out of it.
+ * Returns false if the placement is not supported by the system (non-Linux, single NUMA node, restricted mbind)
+ * or the node does not exist.
+ */
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId);
+
+/**
+ * NUMA node the memory of a stream running on the node is bound to, -1 if the binding makes no sense:
+ * the binding is disabled or there is a single NUMA node.
+ */
+int numaNodeForBinding(int numaNodeId, bool bindingEnabled);
+
+/**
+ * Allocator of the blobs placed on the NUMA node, e.g. the input and output blobs of the infer requests
+ * running on the streams of the node. It is internal to the plugin, the blobs set by the user are not replaced.
+ */
+std::shared_ptr<InferenceEngine::IAllocator> createNumaAllocator(int numaNodeId);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,253 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_events.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <thread>
+
+#include "ie_common.h"
+#include "ie_parallel.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+#ifdef __linux__
+long currentThreadId() {
+    return static_cast<long>(syscall(SYS_gettid));
+}
+
+int openCounter(uint64_t config, long tid, int groupFd) {
+    perf_event_attr attr = {};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.disabled = groupFd == -1 ? 1 : 0;
+    // user space only, which is allowed with the default perf_event_paranoid level
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, groupFd, 0));
+}
+#endif
+
+std::string escapeJson(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            result += ' ';
+        } else {
+            result += c;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+// The arena is attached when the graph is inferred for the first time, which happens inside the graph's stream.
+// It is the first base, so it is created before and outlives the observer which keeps a pointer to it.
+namespace {
+struct AttachedArena {
+    tbb::task_arena arena{tbb::task_arena::attach()};
+};
+}  // namespace
+
+// Starts the counting when a thread joins the arena of the graph's stream and stops it when the thread leaves
+struct PerfEventsCounter::ArenaObserver : public AttachedArena, public tbb::task_scheduler_observer {
+    explicit ArenaObserver(PerfEventsCounter& counter)
+        : tbb::task_scheduler_observer(arena), counter(counter) {}
+
+    void on_scheduler_entry(bool) override {
+        counter.enableCurrentThread(true);
+    }
+
+    void on_scheduler_exit(bool) override {
+        counter.enableCurrentThread(false);
+    }
+
+    PerfEventsCounter& counter;
+};
+#else
+struct PerfEventsCounter::ArenaObserver {};
+#endif
+
+PerfEventsCounter::PerfEventsCounter() = default;
+
+PerfEventsCounter::~PerfEventsCounter() {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    // waits for the callbacks in progress, so the descriptors are not used after they are closed
+    if (observer)
+        observer->observe(false);
+#endif
+#ifdef __linux__
+    for (auto fd : memberFds)
+        close(fd);
+    for (auto fd : groupFds) {
+        if (fd >= 0)
+            close(fd);
+    }
+#endif
+}
+
+void PerfEventsCounter::registerThreads() {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (observer)
+        return;
+    std::unique_ptr<ArenaObserver> arenaObserver(new ArenaObserver(*this));
+    if (arenaObserver->arena.is_active()) {
+        // the threads which are already in the arena are not notified, they are registered explicitly below
+        arenaObserver->observe(true);
+        observer = std::move(arenaObserver);
+    }
+#endif
+    enableCurrentThread(true);
+    InferenceEngine::parallel_nt(0, [&](const int, const int) {
+        enableCurrentThread(true);
+    });
+}
+
+void PerfEventsCounter::enableCurrentThread(bool enable) {
+#ifdef __linux__
+    const long tid = currentThreadId();
+    std::lock_guard<std::mutex> lock(mutex);
+    int leader = -1;
+    auto thread = std::find(threadIds.begin(), threadIds.end(), tid);
+    if (thread != threadIds.end()) {
+        leader = groupFds[thread - threadIds.begin()];
+    } else {
+        if (!enable)
+            return;
+        leader = openCounter(PERF_COUNT_HW_CPU_CYCLES, tid, -1);
+        if (leader >= 0) {
+            const int instructions = openCounter(PERF_COUNT_HW_INSTRUCTIONS, tid, leader);
+            const int llcMisses = openCounter(PERF_COUNT_HW_CACHE_MISSES, tid, leader);
+            if (instructions >= 0 && llcMisses >= 0) {
+                memberFds.push_back(instructions);
+                memberFds.push_back(llcMisses);
+            } else {
+                if (instructions >= 0)
+                    close(instructions);
+                if (llcMisses >= 0)
+                    close(llcMisses);
+                close(leader);
+                leader = -1;
+            }
+        }
+        // the thread is remembered even if its counters are not available, so they are opened only once
+        threadIds.push_back(tid);
+        groupFds.push_back(leader);
+    }
+    if (leader >= 0)
+        ioctl(leader, enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+HwCounters PerfEventsCounter::read() const {
+    HwCounters result;
+#ifdef __linux__
+    struct {
+        uint64_t nr;
+        uint64_t values[3];
+    } data;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto fd : groupFds) {
+        if (fd < 0 || ::read(fd, &data, sizeof(data)) != sizeof(data) || data.nr != 3)
+            continue;
+        result.cycles += data.values[0];
+        result.instructions += data.values[1];
+        result.llcMisses += data.values[2];
+    }
+#endif
+    return result;
+}
+
+std::shared_ptr<ChromeTraceWriter> ChromeTraceWriter::get(const std::string& path) {
+    static std::mutex writersMutex;
+    static std::map<std::string, std::weak_ptr<ChromeTraceWriter>> writers;
+
+    std::lock_guard<std::mutex> lock(writersMutex);
+    auto writer = writers[path].lock();
+    if (!writer) {
+        writer = std::make_shared<ChromeTraceWriter>(path);
+        writers[path] = writer;
+    }
+    return writer;
+}
+
+ChromeTraceWriter::ChromeTraceWriter(const std::string& path) : stream(path, std::ios::out | std::ios::trunc) {
+    if (!stream.is_open())
+        IE_THROW() << "Cannot open trace file " << path;
+    stream << "[\n";
+}
+
+void ChromeTraceWriter::write(const std::vector<Event>& events, uint64_t inferId, bool withCounters) {
+#ifdef __linux__
+    const long pid = static_cast<long>(getpid());
+    const long tid = currentThreadId();
+#else
+    const long pid = 0;
+    const long tid = static_cast<long>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& event : events) {
+        stream << "{\"name\":\"" << escapeJson(*event.name) << "\",\"cat\":\"" << escapeJson(*event.type)
+               << "\",\"ph\":\"X\",\"ts\":" << event.startUs << ",\"dur\":" << event.durationUs
+               << ",\"pid\":" << pid << ",\"tid\":" << tid << ",\"args\":{\"infer\":" << inferId;
+        if (withCounters) {
+            stream << ",\"cycles\":" << event.counters.cycles << ",\"instructions\":" << event.counters.instructions
+                   << ",\"llc_misses\":" << event.counters.llcMisses;
+        }
+        stream << "}},\n";
+    }
+    stream.flush();
+}
+
+HwProfiler::HwProfiler(bool countEvents, const std::string& traceFile) {
+    if (countEvents)
+        events.reset(new PerfEventsCounter);
+    if (!traceFile.empty())
+        trace = ChromeTraceWriter::get(traceFile);
+}
+
+void HwProfiler::startInfer() {
+    if (events)
+        events->registerThreads();
+    traceEvents.clear();
+}
+
+void HwProfiler::finishInfer() {
+    if (trace)
+        trace->write(traceEvents, inferId, countsEvents());
+    inferId++;
+}
+
+void HwProfiler::addTraceEvent(const std::string& name, const std::string& type, uint64_t startUs, uint64_t durationUs,
+                               const HwCounters& counters) {
+    if (trace)
+        traceEvents.push_back({&name, &type, startUs, durationUs, counters});
+}
+
+uint64_t HwProfiler::nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Hardware event counts of a code region.
+ */
+struct HwCounters {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+
+    HwCounters& operator+=(const HwCounters& rhs) {
+        cycles += rhs.cycles;
+        instructions += rhs.instructions;
+        llcMisses += rhs.llcMisses;
+        return *this;
+    }
+
+    HwCounters operator-(const HwCounters& rhs) const {
+        HwCounters result;
+        result.cycles = cycles - rhs.cycles;
+        result.instructions = instructions - rhs.instructions;
+        result.llcMisses = llcMisses - rhs.llcMisses;
+        return result;
+    }
+
+    HwCounters operator/(uint64_t n) const {
+        HwCounters result;
+        result.cycles = cycles / n;
+        result.instructions = instructions / n;
+        result.llcMisses = llcMisses / n;
+        return result;
+    }
+};
+
+/**
+ * Counts hardware events of all threads executing a graph.
+ * With TBB the counter observes the arena of the graph's stream: a thread opens its own perf_event group when it
+ * joins the arena for the first time, and the group counts only while the thread stays in the arena, so the work a
+ * migrating worker does for the other streams is not accounted to the nodes of this graph. With the other threading
+ * runtimes the threads are registered by registerThreads(). read() sums the counters of all threads, so a region
+ * parallelized over the stream threads is accounted completely by the single thread which reads the counters before
+ * and after the region. The groups are closed and the observer is released when the counter is destroyed together
+ * with its graph.
+ * Counting is not available on non-Linux systems and when the kernel restricts perf_event
+ * (see /proc/sys/kernel/perf_event_paranoid), read() returns zeros in that case.
+ */
+class PerfEventsCounter {
+public:
+    PerfEventsCounter();
+    PerfEventsCounter(const PerfEventsCounter&) = delete;
+    PerfEventsCounter& operator=(const PerfEventsCounter&) = delete;
+    ~PerfEventsCounter();
+
+    void registerThreads();
+    HwCounters read() const;
+
+private:
+    struct ArenaObserver;
+
+    void enableCurrentThread(bool enable);
+
+    mutable std::mutex mutex;
+    std::vector<long> threadIds;
+    std::vector<int> groupFds;
+    std::vector<int> memberFds;
+    std::unique_ptr<ArenaObserver> observer;
+};
+
+/**
+ * Appends node execution events to a file in the Chrome tracing JSON array format.
+ * The array is never closed, which is allowed by the format, so the file stays valid for
+ * chrome://tracing and Perfetto at any moment. Graphs of all streams writing to the same file share one writer.
+ */
+class ChromeTraceWriter {
+public:
+    struct Event {
+        const std::string* name;
+        const std::string* type;
+        uint64_t startUs;
+        uint64_t durationUs;
+        HwCounters counters;
+    };
+
+    static std::shared_ptr<ChromeTraceWriter> get(const std::string& path);
+
+    explicit ChromeTraceWriter(const std::string& path);
+
+    void write(const std::vector<Event>& events, uint64_t inferId, bool withCounters);
+
+private:
+    std::mutex mutex;
+    std::ofstream stream;
+};
+
+/**
+ * Per-graph state of the hardware counters collection and the execution trace.
+ */
+class HwProfiler {
+public:
+    HwProfiler(bool countEvents, const std::string& traceFile);
+
+    void startInfer();
+    void finishInfer();
+
+    bool countsEvents() const {
+        return events != nullptr;
+    }
+
+    HwCounters readCounters() const {
+        return events ? events->read() : HwCounters{};
+    }
+
+    void addTraceEvent(const std::string& name, const std::string& type, uint64_t startUs, uint64_t durationUs,
+                       const HwCounters& counters);
+
+    static uint64_t nowUs();
+
+private:
+    std::unique_ptr<PerfEventsCounter> events;
+    std::shared_ptr<ChromeTraceWriter> trace;
+    std::vector<ChromeTraceWriter::Event> traceEvents;
+    uint64_t inferId = 0;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sample_independence.h"
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include <openvino/op/util/arithmetic_reduction.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <openvino/op/util/binary_elementwise_comparison.hpp>
+#include <openvino/op/util/binary_elementwise_logical.hpp>
+#include <openvino/op/util/broadcast_base.hpp>
+#include <openvino/op/util/deformable_convolution_base.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <openvino/op/util/logical_reduction.hpp>
+#include <openvino/op/util/max_pool_base.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/scaled_attention.hpp"
+#include "ngraph_transformations/op/swish_cpu.hpp"
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+bool isBatchAxis(int64_t axis, const ov::PartialShape& shape) {
+    return axis == 0 || (shape.rank().is_static() && axis + shape.rank().get_length() == 0);
+}
+
+// the integer axes given by the constant input, the ones not known at the compilation are taken as the batch axis.
+// The axis input is optional for CumSum, its default is the batch axis
+bool hasBatchAxis(const std::shared_ptr<const ov::Node>& node, size_t port, const ov::PartialShape& shape) {
+    if (port >= node->get_input_size())
+        return true;
+    const auto constant = ov::as_type_ptr<const ov::opset8::Constant>(node->get_input_node_shared_ptr(port));
+    if (!constant)
+        return true;
+    for (const auto axis : constant->cast_vector<int64_t>()) {
+        if (isBatchAxis(axis, shape))
+            return true;
+    }
+    return false;
+}
+
+// the integer values of the constant input at the batch axis, empty if they are not known at the compilation
+std::vector<int64_t> batchAxisValues(const std::shared_ptr<const ov::Node>& node, size_t port) {
+    if (port >= node->get_input_size())
+        return {};
+    const auto constant = ov::as_type_ptr<const ov::opset8::Constant>(node->get_input_node_shared_ptr(port));
+    if (!constant)
+        return {};
+    const auto values = constant->cast_vector<int64_t>();
+    return values.empty() ? values : std::vector<int64_t>{values.front()};
+}
+
+bool isElementwise(const std::shared_ptr<const ov::Node>& node) {
+    return ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseComparison>(node) ||
+           ov::is_type<ov::op::util::BinaryElementwiseLogical>(node) ||
+           ov::is_type<ov::opset8::LogicalNot>(node) || ov::is_type<ov::opset8::Clamp>(node) ||
+           ov::is_type<ov::opset8::Elu>(node) || ov::is_type<ov::opset8::Selu>(node) ||
+           ov::is_type<ov::opset8::PRelu>(node) || ov::is_type<ov::opset8::Gelu>(node) ||
+           ov::is_type<ov::opset8::Swish>(node) || ov::is_type<ov::opset8::Mish>(node) ||
+           ov::is_type<ov::opset8::SoftPlus>(node) || ov::is_type<ov::opset8::Convert>(node) ||
+           ov::is_type<ov::opset8::ConvertLike>(node) || ov::is_type<ov::opset8::Select>(node) ||
+           ov::is_type<ov::opset8::FakeQuantize>(node) || ov::is_type<LeakyReluNode>(node) ||
+           ov::is_type<PowerStaticNode>(node) || ov::is_type<SwishNode>(node);
+}
+
+// the operations applying their weights to each sample, the weights must not be computed from the samples
+bool appliesWeights(const std::shared_ptr<const ov::Node>& node) {
+    return ov::is_type<ov::opset8::Convolution>(node) || ov::is_type<ov::opset8::GroupConvolution>(node) ||
+           ov::is_type<ov::opset8::ConvolutionBackpropData>(node) ||
+           ov::is_type<ov::opset8::GroupConvolutionBackpropData>(node) ||
+           ov::is_type<ov::opset8::BinaryConvolution>(node) ||
+           ov::is_type<ov::op::util::DeformableConvolutionBase>(node) ||
+           ov::is_type<ov::op::util::MaxPoolBase>(node) || ov::is_type<ov::opset8::AvgPool>(node) ||
+           ov::is_type<ov::opset8::AdaptiveAvgPool>(node) || ov::is_type<ov::opset8::AdaptiveMaxPool>(node) ||
+           ov::is_type<ov::opset8::BatchNormInference>(node) || ov::is_type<ov::opset8::DepthToSpace>(node) ||
+           ov::is_type<ov::opset8::SpaceToDepth>(node) || ov::is_type<FullyConnectedNode>(node);
+}
+
+// the operations known to compute each sample of the outputs from the same sample of the inputs, provided
+// the outputs keep the batch as their first dimension. Any other operation is taken as mixing the samples
+bool isPerSample(const std::shared_ptr<const ov::Node>& node, const std::vector<bool>& batchInputs) {
+    const auto& shape = node->get_input_partial_shape(0);
+    if (isElementwise(node))
+        return true;
+    if (appliesWeights(node))
+        return std::none_of(batchInputs.begin() + 1, batchInputs.end(), [](bool batchInput) {
+            return batchInput;
+        });
+    // the shape changes are checked by their outputs
+    if (ov::is_type<ov::opset8::Reshape>(node) || ov::is_type<ov::opset8::Unsqueeze>(node) ||
+        ov::is_type<ov::op::util::BroadcastBase>(node))
+        return true;
+    if (const auto concat = ov::as_type_ptr<const ov::opset8::Concat>(node))
+        return !isBatchAxis(concat->get_axis(), shape);
+    if (const auto softmax = ov::as_type_ptr<const ov::opset1::Softmax>(node))
+        return !isBatchAxis(static_cast<int64_t>(softmax->get_axis()), shape);
+    if (const auto softmax = ov::as_type_ptr<const ov::opset8::Softmax>(node))
+        return !isBatchAxis(softmax->get_axis(), shape);
+    if (const auto softmax = ov::as_type_ptr<const ov::opset8::LogSoftmax>(node))
+        return !isBatchAxis(softmax->get_axis(), shape);
+    if (const auto shuffle = ov::as_type_ptr<const ov::opset8::ShuffleChannels>(node))
+        return !isBatchAxis(shuffle->get_axis(), shape);
+    if (const auto gather = ov::as_type_ptr<const ov::op::util::GatherBase>(node))
+        return !(batchInputs[0] && isBatchAxis(gather->get_axis(), shape));
+    if (ov::is_type<ov::op::util::ArithmeticReduction>(node) || ov::is_type<ov::op::util::LogicalReduction>(node) ||
+        ov::is_type<ov::opset8::Split>(node) || ov::is_type<ov::opset8::VariadicSplit>(node) ||
+        ov::is_type<ov::opset8::CumSum>(node) || ov::is_type<ov::opset8::MVN>(node) ||
+        ov::is_type<ov::opset8::NormalizeL2>(node) || ov::is_type<ov::opset8::LRN>(node) ||
+        ov::is_type<ov::opset8::Squeeze>(node))
+        return !hasBatchAxis(node, 1, shape);
+    if (ov::is_type<ov::opset8::Roll>(node))
+        return !hasBatchAxis(node, 2, shape);
+    if (ov::is_type<ov::opset8::Interpolate>(node))
+        return !hasBatchAxis(node, 3, shape);
+    if (ov::is_type<ov::opset8::Slice>(node))
+        return !hasBatchAxis(node, 4, shape);
+    if (const auto topK = ov::as_type_ptr<const ov::opset1::TopK>(node))
+        return !isBatchAxis(topK->get_provided_axis(), shape);
+    if (ov::is_type<ov::opset8::Pad>(node)) {
+        const std::vector<int64_t> noPads{0};
+        return batchAxisValues(node, 1) == noPads && batchAxisValues(node, 2) == noPads;
+    }
+    if (const auto stridedSlice = ov::as_type_ptr<const ov::opset8::StridedSlice>(node)) {
+        // the whole batch axis is taken
+        const auto firstMask = [](const std::vector<int64_t>& mask) {
+            return mask.empty() ? 0 : mask.front();
+        };
+        const bool defaultStride = node->get_input_size() < 4 || batchAxisValues(node, 3) == std::vector<int64_t>{1};
+        return firstMask(stridedSlice->get_begin_mask()) == 1 && firstMask(stridedSlice->get_end_mask()) == 1 &&
+               firstMask(stridedSlice->get_new_axis_mask()) == 0 &&
+               firstMask(stridedSlice->get_shrink_axis_mask()) == 0 &&
+               firstMask(stridedSlice->get_ellipsis_mask()) == 0 && defaultStride;
+    }
+    if (ov::is_type<ov::opset8::Transpose>(node))
+        return batchAxisValues(node, 1) == std::vector<int64_t>{0};
+    if (const auto matMul = ov::as_type_ptr<const ov::opset8::MatMul>(node)) {
+        // the batch of the matrices is the batch axis, the matrices themselves mix their rows and columns
+        const auto rankA = shape.rank();
+        const auto rankB = node->get_input_partial_shape(1).rank();
+        if (batchInputs[0] && (rankA.is_dynamic() || (rankA.get_length() <= 2 && matMul->get_transpose_a())))
+            return false;
+        if (batchInputs[1] && (rankB.is_dynamic() || rankB.get_length() <= 2))
+            return false;
+        return true;
+    }
+    if (ov::is_type<ScaledAttentionNode>(node)) {
+        // the attention is computed within the matrices of [..., L, D], the batch axis must be above them
+        for (size_t i = 0; i < node->get_input_size(); i++) {
+            const auto rank = node->get_input_partial_shape(i).rank();
+            if (batchInputs[i] && (rank.is_dynamic() || rank.get_length() <= 2))
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+bool areSamplesIndependent(const std::shared_ptr<const ov::Model>& model) {
+    // the outputs carrying the samples, from the inputs of the dynamic batch
+    std::unordered_set<const ov::descriptor::Tensor*> batchOutputs;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (ov::is_type<ov::opset8::Parameter>(op)) {
+            const auto& shape = op->get_output_partial_shape(0);
+            if (shape.rank().is_static() && shape.rank().get_length() > 0 && shape[0].is_dynamic())
+                batchOutputs.insert(&op->get_output_tensor(0));
+            continue;
+        }
+        if (ov::is_type<ov::opset8::Result>(op) || ov::is_type<ov::opset1::ShapeOf>(op) ||
+            ov::is_type<ov::opset8::ShapeOf>(op))
+            continue;
+
+        std::vector<bool> batchInputs(op->get_input_size());
+        bool onBatch = false;
+        for (size_t i = 0; i < op->get_input_size(); i++) {
+            batchInputs[i] = batchOutputs.count(&op->get_input_tensor(i)) != 0;
+            onBatch = onBatch || batchInputs[i];
+        }
+        if (!onBatch)
+            continue;
+        if (!isPerSample(op, batchInputs))
+            return false;
+        for (size_t i = 0; i < op->get_output_size(); i++) {
+            const auto& shape = op->get_output_partial_shape(i);
+            if (shape.rank().is_dynamic() || shape.rank().get_length() == 0 || shape[0].is_static())
+                return false;
+            batchOutputs.insert(&op->get_output_tensor(i));
+        }
+    }
+    return true;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <openvino/core/model.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Checks that the samples along the dynamic batch dimension of the inputs are computed independently, so the
+ * micro-batches of an inference give the results of the whole batch. Only the operations known to compute the samples
+ * independently are accepted: the elementwise ones, the convolutions, the poolings and the FullyConnected with the
+ * weights not computed from the samples, and the operations working along an axis (Concat, Softmax, Gather, Split,
+ * the reductions, MVN, TopK, Roll, Pad, Transpose, MatMul...) if the axis is not the batch one. Any other operation
+ * on the samples is taken as mixing them. The outputs must keep the batch as their dynamic first dimension.
+ * The shapes computed from the batch, as by ShapeOf, are not the samples.
+ */
+bool areSamplesIndependent(const std::shared_ptr<const ov::Model>& model);
+
+}  // namespace MKLDNNPlugin
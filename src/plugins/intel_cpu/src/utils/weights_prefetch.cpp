@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_prefetch.h"
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "mkldnn/ie_mkldnn.h"
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+const size_t cacheLineSize = 64;
+// the helper thread checks for a newer request after reading this many bytes
+const size_t pollingStep = 4096;
+
+#ifdef __linux__
+struct CoreMask {
+    cpu_set_t cores;
+    bool valid = false;
+};
+
+CoreMask getCoreMask() {
+    CoreMask mask;
+    CPU_ZERO(&mask.cores);
+    mask.valid = sched_getaffinity(0, sizeof(mask.cores), &mask.cores) == 0;
+    return mask;
+}
+
+void setCoreMask(const CoreMask& mask) {
+    if (mask.valid)
+        sched_setaffinity(0, sizeof(mask.cores), &mask.cores);
+}
+#else
+struct CoreMask {};
+
+CoreMask getCoreMask() {
+    return {};
+}
+
+void setCoreMask(const CoreMask&) {}
+#endif
+
+}  // namespace
+
+WeightsPrefetcher::WeightsPrefetcher(size_t budget) : budget(budget) {
+    // the cores of the stream thread, the new thread inherits the ones of the process otherwise
+    const auto mask = getCoreMask();
+    thread = std::thread([this, mask] {
+        setCoreMask(mask);
+        run();
+    });
+}
+
+WeightsPrefetcher::~WeightsPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+        requests++;
+    }
+    requested.notify_one();
+    thread.join();
+}
+
+size_t WeightsPrefetcher::defaultBudget() {
+    const int llcSize = mkldnn::utils::get_cache_size(3, false);
+    return llcSize > 0 ? static_cast<size_t>(llcSize) / 2 : 0;
+}
+
+void WeightsPrefetcher::prefetch(const std::vector<PrefetchRegion>& regions) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = &regions;
+        requests++;
+    }
+    requested.notify_one();
+}
+
+void WeightsPrefetcher::wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] {
+        return pending == nullptr && !busy;
+    });
+}
+
+void WeightsPrefetcher::cancel() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cancelling++;
+    pending = nullptr;
+    requests++;
+    idle.wait(lock, [this] {
+        return !busy;
+    });
+    cancelling--;
+    if (cancelling == 0 && pending != nullptr) {
+        lock.unlock();
+        requested.notify_one();
+    }
+}
+
+void WeightsPrefetcher::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        requested.wait(lock, [this] {
+            return stop || (pending != nullptr && cancelling == 0);
+        });
+        if (stop)
+            break;
+
+        const auto& regions = *pending;
+        const uint64_t request = requests;
+        pending = nullptr;
+        busy = true;
+        lock.unlock();
+        read(regions, request);
+        lock.lock();
+        busy = false;
+        if (pending == nullptr || cancelling != 0)
+            idle.notify_all();
+    }
+    busy = false;
+    idle.notify_all();
+}
+
+void WeightsPrefetcher::read(const std::vector<PrefetchRegion>& regions, uint64_t request) {
+    size_t left = budget;
+    for (const auto& region : regions) {
+        const size_t size = std::min(region.size, left);
+        for (size_t offset = 0; offset < size; offset += pollingStep) {
+            if (requests.load(std::memory_order_relaxed) != request)
+                return;
+            const size_t end = std::min(size, offset + pollingStep);
+            // the loads bring the lines into the caches shared with the threads of the stream
+            for (size_t line = offset; line < end; line += cacheLineSize)
+                static_cast<void>(*reinterpret_cast<const volatile uint8_t*>(region.data + line));
+            bytes += end - offset;
+        }
+        left -= size;
+        if (left == 0)
+            break;
+    }
+}
+
+}  // namespace MKLDNNPlugin
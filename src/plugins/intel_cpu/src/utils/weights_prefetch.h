@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * A buffer of the weights read by a node on each inference.
+ */
+struct PrefetchRegion {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+/**
+ * Reads the weights of the node executed next into the caches by a helper thread, while the current node computes,
+ * so the weights of the memory bound nodes are not streamed from the DRAM after their node started.
+ * prefetch() returns immediately, a new request abandons the one in progress as its node has started already.
+ * At most budget bytes of a request are read, so the weights of a node do not evict each other from the last level
+ * cache. The regions of the requests are owned by the caller and must outlive the requests, see cancel().
+ * The helper thread is bound to the cores of the thread constructing the prefetcher, so the one created by a stream
+ * reads into the caches of the stream. The graphs of a stream share its prefetcher, as they run one at a time.
+ */
+class WeightsPrefetcher {
+public:
+    explicit WeightsPrefetcher(size_t budget);
+    WeightsPrefetcher(const WeightsPrefetcher&) = delete;
+    WeightsPrefetcher& operator=(const WeightsPrefetcher&) = delete;
+    ~WeightsPrefetcher();
+
+    void prefetch(const std::vector<PrefetchRegion>& regions);
+    // waits until the helper thread is done with the requests made so far
+    void wait();
+    // abandons the pending request and the one in progress, so their regions can be released. The requests
+    // made meanwhile wait for it
+    void cancel();
+
+    // the bytes read by the helper thread, the abandoned requests count the part read before they were abandoned
+    uint64_t prefetchedBytes() const {
+        return bytes;
+    }
+
+    // half of the last level cache, the rest is left to the activations of the current node
+    static size_t defaultBudget();
+
+private:
+    void run();
+    // stops when a newer request is made
+    void read(const std::vector<PrefetchRegion>& regions, uint64_t request);
+
+    const size_t budget;
+    std::mutex mutex;
+    std::condition_variable requested;
+    std::condition_variable idle;
+    const std::vector<PrefetchRegion>* pending = nullptr;
+    bool busy = false;
+    bool stop = false;
+    size_t cancelling = 0;
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> bytes{0};
+    std::thread thread;
+};
+
+}  // namespace MKLDNNPlugin
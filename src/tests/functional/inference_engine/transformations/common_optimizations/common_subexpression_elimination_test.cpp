@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/common_subexpression_elimination.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST_F(TransformationTestsF, CommonSubexpressionEliminationMergesSubGraphs) {
+    ngraph::Shape input_shape { 1, 4, 16 };
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, input_shape);
+
+        // the same mask computation replicated per layer
+        auto make_layer = [&](const ngraph::Output<ngraph::Node>& data) {
+            auto order = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {0, 2, 1});
+            auto transpose = std::make_shared<ngraph::opset8::Transpose>(input, order);
+            auto convert = std::make_shared<ngraph::opset8::Convert>(transpose, ngraph::element::f16);
+            auto back = std::make_shared<ngraph::opset8::Convert>(convert, ngraph::element::f32);
+            auto pattern = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {1, 4, 16});
+            auto reshape = std::make_shared<ngraph::opset8::Reshape>(back, pattern, false);
+            return std::make_shared<ngraph::opset8::Add>(data, reshape);
+        };
+        auto layer1 = make_layer(input);
+        auto layer2 = make_layer(layer1);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ layer2 }, ngraph::ParameterVector{ input });
+        manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    }
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, input_shape);
+
+        auto order = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {0, 2, 1});
+        auto transpose = std::make_shared<ngraph::opset8::Transpose>(input, order);
+        auto convert = std::make_shared<ngraph::opset8::Convert>(transpose, ngraph::element::f16);
+        auto back = std::make_shared<ngraph::opset8::Convert>(convert, ngraph::element::f32);
+        auto pattern = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {1, 4, 16});
+        auto reshape = std::make_shared<ngraph::opset8::Reshape>(back, pattern, false);
+        auto layer1 = std::make_shared<ngraph::opset8::Add>(input, reshape);
+        auto layer2 = std::make_shared<ngraph::opset8::Add>(layer1, reshape);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ layer2 }, ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(TransformationTestsF, CommonSubexpressionEliminationKeepsDifferentNodes) {
+    ngraph::Shape input_shape { 2, 3 };
+    auto make_function = [&]() {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, input_shape);
+
+        // the constants differ by the value, the Converts by the destination type
+        auto add1 = std::make_shared<ngraph::opset8::Add>(input, ngraph::opset8::Constant::create(ngraph::element::f32, {}, {1}));
+        auto add2 = std::make_shared<ngraph::opset8::Add>(input, ngraph::opset8::Constant::create(ngraph::element::f32, {}, {2}));
+        auto convert1 = std::make_shared<ngraph::opset8::Convert>(add1, ngraph::element::f16);
+        auto convert2 = std::make_shared<ngraph::opset8::Convert>(add2, ngraph::element::i32);
+        auto convert3 = std::make_shared<ngraph::opset8::Convert>(convert2, ngraph::element::f16);
+        auto concat = std::make_shared<ngraph::opset8::Concat>(ngraph::OutputVector{ convert1, convert3 }, 0);
+
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ concat }, ngraph::ParameterVector{ input });
+    };
+    function = make_function();
+    manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    function_ref = make_function();
+}
+
+TEST(TransformationTests, CommonSubexpressionEliminationStatistics) {
+    auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 3 });
+    auto shift1 = ngraph::opset8::Constant::create(ngraph::element::f32, {}, {1});
+    auto shift2 = ngraph::opset8::Constant::create(ngraph::element::f32, {}, {1});
+    auto add1 = std::make_shared<ngraph::opset8::Add>(input, shift1);
+    auto add2 = std::make_shared<ngraph::opset8::Add>(input, shift2);
+    auto multiply = std::make_shared<ngraph::opset8::Multiply>(add1, add2);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ multiply }, ngraph::ParameterVector{ input });
+
+    ngraph::pass::Manager manager;
+    auto cse = manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    manager.run_passes(f);
+
+    EXPECT_EQ(f->get_ops().size(), 5u);
+    EXPECT_EQ(multiply->input_value(0), multiply->input_value(1));
+    const std::map<std::string, size_t> expected { { "Add", 1 }, { "Constant", 1 } };
+    EXPECT_EQ(cse->get_eliminated_nodes(), expected);
+}
@@ -52,6 +52,11 @@ TEST_F(OVClassConfigTestCPU, smoke_SetROPropertiesThrow) {
 
     for (auto it = properties.begin(); it != properties.end(); ++it) {
         ASSERT_TRUE(it != properties.end());
+        // the streams and the threads of the compiled model are reconfigured at runtime
+        if (*it == ov::num_streams.name() || *it == ov::inference_num_threads.name()) {
+            ASSERT_TRUE(it->is_mutable());
+            continue;
+        }
         ASSERT_FALSE(it->is_mutable());
         ASSERT_THROW(compiledModel.set_property({{*it, "DUMMY VALUE"}}), ov::Exception);
     }
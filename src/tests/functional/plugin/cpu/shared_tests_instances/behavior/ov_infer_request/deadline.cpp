@@ -0,0 +1,206 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset8.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/exception.hpp"
+#include "openvino/runtime/properties.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+const size_t deadlineChannels = 32;
+const size_t deadlineSpatial = 64;
+// long enough for the deadline to pass while the nodes run
+const size_t deadlineConvolutions = 64;
+const float deadlineSentinel = -12345.f;
+
+using AbortedInferences = std::map<std::string, uint64_t>;
+
+class OVInferRequestDeadlineTestCPU : public ::testing::Test {
+public:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED();
+        auto core = ov::test::utils::PluginCache::get().core();
+        // a single stream, so the inferences of the requests are run one after another
+        compiledModel = core->compile_model(makeConvolutionChain(), "CPU", {ov::num_streams(1)});
+    }
+
+protected:
+    static std::shared_ptr<ov::Model> makeConvolutionChain() {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(
+            ngraph::element::f32, ngraph::Shape{1, deadlineChannels, deadlineSpatial, deadlineSpatial});
+        input->get_output_tensor(0).set_names({"input"});
+        std::shared_ptr<ngraph::Node> output = input;
+        const std::vector<float> weights(deadlineChannels * deadlineChannels * 3 * 3, 1.f / (deadlineChannels * 9));
+        for (size_t i = 0; i < deadlineConvolutions; i++) {
+            auto constant = ngraph::opset8::Constant::create(ngraph::element::f32,
+                                                             ngraph::Shape{deadlineChannels, deadlineChannels, 3, 3},
+                                                             weights);
+            output = std::make_shared<ngraph::opset8::Convolution>(output,
+                                                                   constant,
+                                                                   ngraph::Strides{1, 1},
+                                                                   ngraph::CoordinateDiff{1, 1},
+                                                                   ngraph::CoordinateDiff{1, 1},
+                                                                   ngraph::Strides{1, 1});
+        }
+        auto result = std::make_shared<ngraph::opset8::Result>(output);
+        result->get_output_tensor(0).set_names({"output"});
+        return std::make_shared<ov::Model>(ngraph::ResultVector{result}, ngraph::ParameterVector{input});
+    }
+
+    // the output of the user is written by the last node directly, so it keeps the sentinel if the graph is aborted
+    ov::InferRequest createRequest() {
+        auto request = compiledModel.create_infer_request();
+        const auto& shape = compiledModel.output().get_shape();
+        ov::Tensor output(ov::element::f32, shape);
+        std::fill_n(output.data<float>(), output.get_size(), deadlineSentinel);
+        request.set_tensor("output", output);
+        auto input = request.get_tensor("input");
+        std::fill_n(input.data<float>(), input.get_size(), 1.f);
+        return request;
+    }
+
+    static bool keepsTheSentinel(ov::InferRequest& request) {
+        auto output = request.get_tensor("output");
+        const auto* data = output.data<float>();
+        return std::all_of(data, data + output.get_size(), [](float value) {
+            return value == deadlineSentinel;
+        });
+    }
+
+    AbortedInferences abortedInferences() {
+        return compiledModel.get_property("CPU_ABORTED_INFERENCES").as<AbortedInferences>();
+    }
+
+    ov::CompiledModel compiledModel;
+};
+
+TEST_F(OVInferRequestDeadlineTestCPU, expiredInferenceIsDroppedBeforeTheGraph) {
+    auto request = createRequest();
+    request.set_deadline(std::chrono::steady_clock::now() - std::chrono::milliseconds(1));
+    ASSERT_THROW(request.infer(), ov::Cancelled);
+    ASSERT_TRUE(keepsTheSentinel(request));
+
+    request.start_async();
+    ASSERT_THROW(request.wait(), ov::Cancelled);
+    ASSERT_TRUE(keepsTheSentinel(request));
+
+    const auto aborted = abortedInferences();
+    ASSERT_EQ(2u, aborted.at("EXPIRED"));
+    ASSERT_EQ(0u, aborted.at("CANCELLED"));
+
+    // the request without the deadline runs to the end
+    request.set_deadline(std::chrono::steady_clock::time_point::max());
+    request.infer();
+    ASSERT_FALSE(keepsTheSentinel(request));
+    ASSERT_EQ(2u, abortedInferences().at("EXPIRED"));
+}
+
+TEST_F(OVInferRequestDeadlineTestCPU, inferenceIsAbortedBetweenTheNodes) {
+    auto request = createRequest();
+    // the duration of the whole inference, the deadline passes well before its end
+    const auto start = std::chrono::steady_clock::now();
+    request.infer();
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    auto aborted = createRequest();
+    aborted.set_deadline(std::chrono::steady_clock::now() + duration / 10);
+    ASSERT_THROW(aborted.infer(), ov::Cancelled);
+    // the last node was not executed
+    ASSERT_TRUE(keepsTheSentinel(aborted));
+    ASSERT_EQ(1u, abortedInferences().at("EXPIRED"));
+    ASSERT_EQ(0u, abortedInferences().at("CANCELLED"));
+}
+
+TEST_F(OVInferRequestDeadlineTestCPU, abortedInferencesAreCountedByTheReason) {
+    auto running = createRequest();
+    auto waiting = createRequest();
+    auto expired = createRequest();
+    expired.set_deadline(std::chrono::steady_clock::now() - std::chrono::milliseconds(1));
+
+    // the inference waiting behind the running one of the single stream is cancelled before it starts,
+    // the one finished meanwhile is not counted
+    uint64_t cancelled = 0;
+    for (int i = 0; i < 10 && cancelled == 0; i++) {
+        running.start_async();
+        waiting.start_async();
+        waiting.cancel();
+        running.wait();
+        try {
+            waiting.wait();
+        } catch (const ov::Cancelled&) {
+            cancelled++;
+        }
+    }
+    ASSERT_NE(0u, cancelled);
+
+    ASSERT_THROW(expired.infer(), ov::Cancelled);
+
+    const auto aborted = abortedInferences();
+    ASSERT_EQ(1u, aborted.at("EXPIRED"));
+    ASSERT_EQ(cancelled, aborted.at("CANCELLED"));
+}
+
+// the devices wrapping the CPU pass the deadline and the hints of the request to the CPU requests
+class OVInferRequestDeadlineWrappersTestCPU : public OVInferRequestDeadlineTestCPU,
+                                              public ::testing::WithParamInterface<std::string> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<std::string>& obj) {
+        auto device = obj.param;
+        std::replace(device.begin(), device.end(), ':', '_');
+        return device;
+    }
+
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED();
+        auto core = ov::test::utils::PluginCache::get().core();
+        compiledModel = core->compile_model(makeConvolutionChain(), GetParam());
+    }
+};
+
+TEST_P(OVInferRequestDeadlineWrappersTestCPU, deadlineAndHintsAreForwarded) {
+    auto request = createRequest();
+    request.set_deadline(std::chrono::steady_clock::now() - std::chrono::milliseconds(1));
+    ASSERT_THROW(request.infer(), ov::Cancelled);
+    ASSERT_TRUE(keepsTheSentinel(request));
+
+    request.start_async();
+    ASSERT_THROW(request.wait(), ov::Cancelled);
+    ASSERT_TRUE(keepsTheSentinel(request));
+
+    request.set_deadline(std::chrono::steady_clock::time_point::max());
+    request.infer();
+    ASSERT_FALSE(keepsTheSentinel(request));
+    auto output = request.get_tensor("output");
+    const std::vector<float> expected(output.data<float>(), output.data<float>() + output.get_size());
+
+    // the hints do not change the results
+    request.set_input_ready("input");
+    request.infer();
+    request.release_tensors();
+    request.infer();
+    output = request.get_tensor("output");
+    ASSERT_EQ(expected, std::vector<float>(output.data<float>(), output.data<float>() + output.get_size()));
+
+    ASSERT_THROW(request.set_input_ready("output"), ov::Exception);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests,
+                         OVInferRequestDeadlineWrappersTestCPU,
+                         ::testing::Values("HETERO:CPU", "MULTI:CPU", "AUTO:CPU"),
+                         OVInferRequestDeadlineWrappersTestCPU::getTestCaseName);
+
+}  // namespace
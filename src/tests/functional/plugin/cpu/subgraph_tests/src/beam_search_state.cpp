@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+const size_t beamRowSize = 3;
+const float beamInitValue = 0.5f;
+
+// the state of every beam as the rows appended to it
+using BeamRows = std::vector<std::vector<float>>;
+
+struct BeamStep {
+    std::vector<int32_t> beamIdx;
+    size_t rows;
+};
+
+}  // namespace
+
+// A beam search keeps the past tokens in the state [beams, length, rowSize] and reorders it by the selected beams
+// before the new tokens are appended: ReadValue -> Gather(beam_idx, axis 0) -> Concat(input, axis 1) -> Assign.
+// The Gather followed by the in place append only updates the beam table of the state, the Relu between the ReadValue
+// and the Gather keeps the state out of the in place append, so the same steps run through the copying Gather and
+// Concat. The state values are positive so the Relu is identity.
+class BeamSearchStateTest : public ::testing::Test {
+protected:
+    static std::shared_ptr<ov::Model> createBeamSearchModel(bool inPlaceReorder) {
+        const ov::PartialShape shape{ov::Dimension::dynamic(), ov::Dimension::dynamic(), beamRowSize};
+        auto input = std::make_shared<opset8::Parameter>(element::f32, shape);
+        input->get_output_tensor(0).set_names({"input"});
+        auto beamIdx = std::make_shared<opset8::Parameter>(element::i32, ov::PartialShape{ov::Dimension::dynamic()});
+        beamIdx->get_output_tensor(0).set_names({"beam_idx"});
+
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, element::f32, "cache"});
+        auto init = opset8::Constant::create(element::f32, Shape{1, 1, beamRowSize},
+                                             std::vector<float>(beamRowSize, beamInitValue));
+        auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+        std::shared_ptr<Node> state = readValue;
+        if (!inPlaceReorder)
+            state = std::make_shared<opset8::Relu>(state);
+
+        auto axis = opset8::Constant::create(element::i32, Shape{}, {0});
+        auto gather = std::make_shared<opset8::Gather>(state, beamIdx, axis);
+        auto concat = std::make_shared<opset8::Concat>(OutputVector{gather, input}, 1);
+        auto assign = std::make_shared<opset8::Assign>(concat, variable);
+        auto result = std::make_shared<opset8::Result>(concat);
+        result->get_output_tensor(0).set_names({"output"});
+
+        return std::make_shared<ov::Model>(ResultVector{result}, ov::SinkVector{assign}, ParameterVector{input, beamIdx});
+    }
+
+    // the reference of the step: the beams are gathered by the indices and the new rows are appended to every beam
+    static void referenceStep(BeamRows& beams, const std::vector<int32_t>& beamIdx, const std::vector<float>& input) {
+        BeamRows gathered;
+        for (auto index : beamIdx) {
+            if (index < 0)
+                index += static_cast<int32_t>(beams.size());
+            gathered.push_back(beams.at(index));
+        }
+        const size_t beamInputSize = input.size() / beamIdx.size();
+        for (size_t b = 0; b < gathered.size(); b++)
+            gathered[b].insert(gathered[b].end(), input.begin() + b * beamInputSize, input.begin() + (b + 1) * beamInputSize);
+        beams = gathered;
+    }
+
+    static void checkTensor(const ov::Tensor& tensor, const BeamRows& expected) {
+        const size_t length = expected.front().size() / beamRowSize;
+        ASSERT_EQ((Shape{expected.size(), length, beamRowSize}), tensor.get_shape());
+        const auto* data = tensor.data<float>();
+        for (size_t b = 0; b < expected.size(); b++) {
+            for (size_t i = 0; i < expected[b].size(); i++)
+                ASSERT_EQ(expected[b][i], data[b * expected[b].size() + i]) << "beam " << b << " element " << i;
+        }
+    }
+
+    static void inferStep(ov::InferRequest& request, const BeamStep& step, std::vector<float> input) {
+        auto beamIdx = step.beamIdx;
+        request.set_tensor("input", ov::Tensor(element::f32, Shape{beamIdx.size(), step.rows, beamRowSize}, input.data()));
+        request.set_tensor("beam_idx", ov::Tensor(element::i32, Shape{beamIdx.size()}, beamIdx.data()));
+        request.infer();
+    }
+
+    static ov::Tensor getState(ov::InferRequest& request) {
+        auto states = request.query_state();
+        EXPECT_EQ(1u, states.size());
+        return states.front().get_state();
+    }
+};
+
+TEST_F(BeamSearchStateTest, InPlaceReorderMatchesCopiedState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto inPlaceRequest = core->compile_model(createBeamSearchModel(true), "CPU").create_infer_request();
+    auto copiedRequest = core->compile_model(createBeamSearchModel(false), "CPU").create_infer_request();
+
+    // the first step expands the init value to the beams, the next ones permute, duplicate and drop the beams,
+    // take the negative indices and change the number of the beams
+    const std::vector<BeamStep> steps{
+        {{0, 0, 0}, 1},
+        {{2, 0, 1}, 1},
+        {{1, 1, 2}, 2},
+        {{0, 2, 1}, 1},
+        {{-1, 0, -2}, 3},
+        {{2, 2, 2}, 1},
+        {{1, 0}, 1},
+        {{1, 0, 1, 0}, 2},
+        {{3, 2, 1, 0}, 1},
+        {{0, 1, 2, 3}, 1},
+    };
+
+    BeamRows expected{std::vector<float>(beamRowSize, beamInitValue)};
+    float first = 1.f;
+    for (size_t s = 0; s < steps.size(); s++) {
+        SCOPED_TRACE("step " + std::to_string(s));
+        const auto& step = steps[s];
+        std::vector<float> input(step.beamIdx.size() * step.rows * beamRowSize);
+        for (auto& value : input)
+            value = first++;
+
+        inferStep(inPlaceRequest, step, input);
+        inferStep(copiedRequest, step, input);
+        referenceStep(expected, step.beamIdx, input);
+
+        checkTensor(copiedRequest.get_tensor("output"), expected);
+        checkTensor(inPlaceRequest.get_tensor("output"), expected);
+        // the state read through the beam table is the dense reordered state
+        checkTensor(getState(copiedRequest), expected);
+        checkTensor(getState(inPlaceRequest), expected);
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
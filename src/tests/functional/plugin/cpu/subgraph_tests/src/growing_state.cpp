@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+const size_t rowSize = 4;
+const float initValue = 0.5f;
+
+}  // namespace
+
+// the state grows along the axis 1 by the rows of the input on each inference
+using GrowingStateParams = bool;  // the Concat appends to the state in place
+
+class GrowingStateTest : public ::testing::TestWithParam<GrowingStateParams> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<GrowingStateParams> obj) {
+        return obj.param ? "inPlaceAppend" : "copiedState";
+    }
+
+protected:
+    // ReadValue -> Concat(input) -> Assign, the concatenated state is a Result too. A Relu between the ReadValue and
+    // the Concat keeps the state out of the in place append, the state values are positive so the Relu is identity.
+    std::shared_ptr<ov::Model> createGrowingStateModel(bool inPlaceAppend) {
+        const ov::PartialShape shape{1, ov::Dimension::dynamic(), rowSize};
+        auto input = std::make_shared<opset8::Parameter>(element::f32, shape);
+        input->get_output_tensor(0).set_names({"input"});
+
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, element::f32, "cache"});
+        auto init = opset8::Constant::create(element::f32, Shape{1, 1, rowSize}, std::vector<float>(rowSize, initValue));
+        auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+        std::shared_ptr<Node> state = readValue;
+        if (!inPlaceAppend)
+            state = std::make_shared<opset8::Relu>(state);
+
+        auto concat = std::make_shared<opset8::Concat>(OutputVector{state, input}, 1);
+        auto assign = std::make_shared<opset8::Assign>(concat, variable);
+        auto result = std::make_shared<opset8::Result>(concat);
+        result->get_output_tensor(0).set_names({"output"});
+
+        return std::make_shared<ov::Model>(ResultVector{result}, ov::SinkVector{assign}, ParameterVector{input});
+    }
+
+    static std::vector<float> makeRows(size_t rows, float first) {
+        std::vector<float> data(rows * rowSize);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = first + static_cast<float>(i);
+        return data;
+    }
+
+    static ov::VariableState getState(ov::InferRequest& request) {
+        auto states = request.query_state();
+        EXPECT_EQ(1u, states.size());
+        EXPECT_EQ("cache", states.front().get_name());
+        return states.front();
+    }
+
+    static void checkTensor(const ov::Tensor& tensor, const std::vector<float>& expected) {
+        ASSERT_EQ((Shape{1, expected.size() / rowSize, rowSize}), tensor.get_shape());
+        const auto* data = tensor.data<float>();
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_EQ(expected[i], data[i]) << "element " << i;
+    }
+
+    // runs the request on the rows appended to the expected state, the output and the state read back by the request
+    // are the whole accumulated state
+    static void inferRows(ov::InferRequest& request, const std::vector<float>& rows, std::vector<float>& expected) {
+        auto input = rows;
+        request.set_tensor("input", ov::Tensor(element::f32, Shape{1, input.size() / rowSize, rowSize}, input.data()));
+        request.infer();
+
+        expected.insert(expected.end(), rows.begin(), rows.end());
+        checkTensor(request.get_tensor("output"), expected);
+        checkTensor(getState(request).get_state(), expected);
+    }
+
+    void Run() {
+        auto core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel = core->compile_model(createGrowingStateModel(GetParam()), "CPU");
+        auto request = compiledModel.create_infer_request();
+
+        // the first inference takes the init value of the ReadValue, the next ones append the inputs of varying length
+        std::vector<float> expected(rowSize, initValue);
+        float first = 1.f;
+        for (size_t rows : {1, 3, 2, 1, 5, 1}) {
+            inferRows(request, makeRows(rows, first), expected);
+            first += static_cast<float>(rows * rowSize);
+        }
+
+        // the states of the requests are independent
+        auto otherRequest = compiledModel.create_infer_request();
+        std::vector<float> otherExpected(rowSize, initValue);
+        inferRows(otherRequest, makeRows(2, 500.f), otherExpected);
+        inferRows(request, makeRows(1, first), expected);
+
+        // the reset state is taken from the init value again
+        getState(request).reset();
+        expected.assign(rowSize, initValue);
+        inferRows(request, makeRows(2, 100.f), expected);
+        inferRows(request, makeRows(1, 200.f), expected);
+
+        // the set state is appended to by the next inferences, the request does not keep a reference to the tensor
+        auto newState = makeRows(3, 1000.f);
+        getState(request).set_state(ov::Tensor(element::f32, Shape{1, 3, rowSize}, newState.data()));
+        expected = newState;
+        std::fill(newState.begin(), newState.end(), 0.f);
+        inferRows(request, makeRows(1, 2000.f), expected);
+        inferRows(request, makeRows(4, 3000.f), expected);
+
+        // the other request is not affected by the reset and the set state
+        inferRows(otherRequest, makeRows(1, 600.f), otherExpected);
+    }
+};
+
+TEST_P(GrowingStateTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GrowingState,
+                         GrowingStateTest,
+                         ::testing::Bool(),
+                         GrowingStateTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,197 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+const size_t readyInputSize = 16;
+
+}  // namespace
+
+class InputReadyTest : public ::testing::Test {
+protected:
+    // the SoftMax depends on the input "a" only, the input "b" is passed to its output without the executable nodes,
+    // so marking "a" ready executes the whole graph and marking "b" ready executes nothing
+    std::shared_ptr<ov::Model> createModel() {
+        auto a = std::make_shared<opset8::Parameter>(element::f32, Shape{1, readyInputSize});
+        a->get_output_tensor(0).set_names({"a"});
+        auto b = std::make_shared<opset8::Parameter>(element::f32, Shape{1, readyInputSize});
+        b->get_output_tensor(0).set_names({"b"});
+        auto softmax = std::make_shared<opset8::Softmax>(a, 1);
+        auto resultA = std::make_shared<opset8::Result>(softmax);
+        resultA->get_output_tensor(0).set_names({"softmax"});
+        auto resultB = std::make_shared<opset8::Result>(b);
+        resultB->get_output_tensor(0).set_names({"copy"});
+        return std::make_shared<ov::Model>(ResultVector{resultA, resultB}, ParameterVector{a, b});
+    }
+
+    void SetUp() override {
+        auto core = ov::test::utils::PluginCache::get().core();
+        // the executions and the inferences of the single stream share its graph
+        compiledModel = core->compile_model(createModel(), "CPU", {{"CPU_THROUGHPUT_STREAMS", "1"}});
+    }
+
+    // the tensors of the user, so the nodes executed for the ready inputs write the outputs of the request directly
+    void bindTensors(ov::InferRequest& request, float scaleA, float scaleB) {
+        for (const auto& name : {"a", "b", "softmax", "copy"}) {
+            ov::Tensor tensor(element::f32, Shape{1, readyInputSize});
+            std::fill_n(tensor.data<float>(), readyInputSize, 0.f);
+            request.set_tensor(name, tensor);
+        }
+        fillInput(request.get_tensor("a"), scaleA);
+        fillInput(request.get_tensor("b"), scaleB);
+    }
+
+    // the inferences of the network of a single stream are run in the order they are started. The expired inference
+    // is dropped before it takes the graph, so it waits for the executions queued before it without using the graph.
+    void waitQueuedExecutions() {
+        auto request = compiledModel.create_infer_request();
+        request.set_deadline(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+        request.start_async();
+        ASSERT_THROW(request.wait(), ov::Cancelled);
+    }
+
+    static void fillInput(const ov::Tensor& tensor, float scale) {
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < readyInputSize; i++)
+            data[i] = scale * static_cast<float>(i) / readyInputSize;
+    }
+
+    static void checkSoftmax(const ov::Tensor& tensor, float scale) {
+        // the input is monotonic in the index, so its maximum is at the end or at the start
+        const float max = std::max(0.f, scale * static_cast<float>(readyInputSize - 1) / readyInputSize);
+        std::vector<float> expected(readyInputSize);
+        float sum = 0.f;
+        for (size_t i = 0; i < readyInputSize; i++) {
+            expected[i] = std::exp(scale * static_cast<float>(i) / readyInputSize - max);
+            sum += expected[i];
+        }
+        const auto* data = tensor.data<float>();
+        for (size_t i = 0; i < readyInputSize; i++)
+            ASSERT_NEAR(expected[i] / sum, data[i], 1e-5f) << "element " << i;
+    }
+
+    static void checkCopy(const ov::Tensor& tensor, float scale) {
+        const auto* data = tensor.data<float>();
+        for (size_t i = 0; i < readyInputSize; i++)
+            ASSERT_EQ(scale * static_cast<float>(i) / readyInputSize, data[i]) << "element " << i;
+    }
+
+    static bool isZero(const ov::Tensor& tensor) {
+        const auto* data = tensor.data<float>();
+        return std::all_of(data, data + readyInputSize, [](float value) {
+            return value == 0.f;
+        });
+    }
+
+    ov::CompiledModel compiledModel;
+};
+
+TEST_F(InputReadyTest, nodesOfReadyInputsAreExecutedEarly) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = compiledModel.create_infer_request();
+    bindTensors(request, 1.f, 2.f);
+
+    request.set_input_ready("a");
+    waitQueuedExecutions();
+    // the SoftMax is executed before the inference, the input "b" is not copied yet
+    checkSoftmax(request.get_tensor("softmax"), 1.f);
+    ASSERT_TRUE(isZero(request.get_tensor("copy")));
+
+    request.infer();
+    checkSoftmax(request.get_tensor("softmax"), 1.f);
+    checkCopy(request.get_tensor("copy"), 2.f);
+}
+
+TEST_F(InputReadyTest, nodesOfNotReadyInputsWaitForTheInference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = compiledModel.create_infer_request();
+    bindTensors(request, 1.f, 2.f);
+
+    request.set_input_ready("b");
+    waitQueuedExecutions();
+    ASSERT_TRUE(isZero(request.get_tensor("softmax")));
+
+    request.infer();
+    checkSoftmax(request.get_tensor("softmax"), 1.f);
+    checkCopy(request.get_tensor("copy"), 2.f);
+}
+
+TEST_F(InputReadyTest, inferenceResumesFromTheReadyPosition) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = compiledModel.create_infer_request();
+    bindTensors(request, 1.f, 2.f);
+
+    request.set_input_ready("a");
+    waitQueuedExecutions();
+    // the ready input must not change until the inference, it is changed here to see the SoftMax is not executed again
+    fillInput(request.get_tensor("a"), -3.f);
+
+    request.infer();
+    checkSoftmax(request.get_tensor("softmax"), 1.f);
+    checkCopy(request.get_tensor("copy"), 2.f);
+
+    // the next inference executes the whole graph
+    request.infer();
+    checkSoftmax(request.get_tensor("softmax"), -3.f);
+}
+
+TEST_F(InputReadyTest, graphUsedByAnotherRequestIsExecutedAgain) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = compiledModel.create_infer_request();
+    bindTensors(request, 1.f, 2.f);
+    auto otherRequest = compiledModel.create_infer_request();
+    bindTensors(otherRequest, 5.f, 6.f);
+
+    request.set_input_ready("a");
+    waitQueuedExecutions();
+    otherRequest.infer();
+    checkSoftmax(otherRequest.get_tensor("softmax"), 5.f);
+    checkCopy(otherRequest.get_tensor("copy"), 6.f);
+
+    // the nodes executed early are executed again on the changed input, as the other request used the graph
+    fillInput(request.get_tensor("a"), -3.f);
+    request.infer();
+    checkSoftmax(request.get_tensor("softmax"), -3.f);
+    checkCopy(request.get_tensor("copy"), 2.f);
+    checkSoftmax(otherRequest.get_tensor("softmax"), 5.f);
+}
+
+TEST_F(InputReadyTest, setTensorInvalidatesTheReadyInputs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = compiledModel.create_infer_request();
+    bindTensors(request, 1.f, 2.f);
+
+    request.set_input_ready("a");
+    waitQueuedExecutions();
+    checkSoftmax(request.get_tensor("softmax"), 1.f);
+
+    ov::Tensor input(element::f32, Shape{1, readyInputSize});
+    fillInput(input, -3.f);
+    request.set_tensor("a", input);
+    request.infer();
+    checkSoftmax(request.get_tensor("softmax"), -3.f);
+    checkCopy(request.get_tensor("copy"), 2.f);
+}
+
+TEST_F(InputReadyTest, unknownInputThrows) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = compiledModel.create_infer_request();
+    ASSERT_THROW(request.set_input_ready("softmax"), ov::Exception);
+    ASSERT_THROW(request.set_input_ready("unknown"), ov::Exception);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+const size_t sampleSize = 16;
+const char* microBatchSize = "4";
+
+enum class MicroBatchModel {
+    // the samples are computed independently
+    Independent,
+    // an output flattens the batch, so it does not follow the batch of the micro-batches and the whole batch is run
+    FlattenedOutput,
+    // the Softmax mixes the samples along the batch axis, so the batch is not split
+    BatchSoftmax,
+};
+
+}  // namespace
+
+using MicroBatchParams = std::tuple<MicroBatchModel, size_t>;  // the model, the batch of the inference
+
+class MicroBatchTest : public ::testing::TestWithParam<MicroBatchParams> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<MicroBatchParams> obj) {
+        MicroBatchModel model;
+        size_t batch;
+        std::tie(model, batch) = obj.param;
+        std::ostringstream result;
+        switch (model) {
+        case MicroBatchModel::Independent:
+            result << "independent";
+            break;
+        case MicroBatchModel::FlattenedOutput:
+            result << "flattenedOutput";
+            break;
+        case MicroBatchModel::BatchSoftmax:
+            result << "batchSoftmax";
+            break;
+        }
+        result << "_batch=" << batch;
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<ov::Model> createModel(MicroBatchModel type) {
+        auto input = std::make_shared<opset8::Parameter>(element::f32, ov::PartialShape{ov::Dimension::dynamic(), sampleSize});
+        input->get_output_tensor(0).set_names({"input"});
+        std::vector<float> weights(sampleSize * sampleSize);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(static_cast<int>(i % 9) - 4) / sampleSize;
+        auto constant = opset8::Constant::create(element::f32, Shape{sampleSize, sampleSize}, weights);
+        std::shared_ptr<Node> output = std::make_shared<opset8::MatMul>(input, constant);
+        output = std::make_shared<opset8::Relu>(output);
+        if (type == MicroBatchModel::BatchSoftmax)
+            output = std::make_shared<opset8::Softmax>(output, 0);
+
+        ResultVector results{std::make_shared<opset8::Result>(output)};
+        results.back()->get_output_tensor(0).set_names({"output"});
+        if (type == MicroBatchModel::FlattenedOutput) {
+            auto shape = opset8::Constant::create(element::i64, Shape{1}, std::vector<int64_t>{-1});
+            results.push_back(std::make_shared<opset8::Result>(std::make_shared<opset8::Reshape>(output, shape, false)));
+            results.back()->get_output_tensor(0).set_names({"flattened"});
+        }
+        return std::make_shared<ov::Model>(results, ParameterVector{input});
+    }
+
+    static std::map<std::string, std::vector<float>> infer(const std::shared_ptr<ov::Model>& model,
+                                                           const ov::AnyMap& config,
+                                                           size_t batch) {
+        auto core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel = core->compile_model(model, "CPU", config);
+        auto request = compiledModel.create_infer_request();
+        std::map<std::string, std::vector<float>> outputs;
+        // the same request infers the batch twice, so the second inference reuses the replicas and the outputs
+        for (int i = 0; i < 2; i++) {
+            ov::Tensor input(element::f32, Shape{batch, sampleSize});
+            auto* data = input.data<float>();
+            for (size_t j = 0; j < input.get_size(); j++)
+                data[j] = static_cast<float>(static_cast<int>((j * 5 + i) % 17) - 8) / 4.f;
+            request.set_tensor("input", input);
+            request.infer();
+
+            for (const auto& output : compiledModel.outputs()) {
+                auto tensor = request.get_tensor(output);
+                const auto* values = tensor.data<float>();
+                outputs[output.get_any_name()].assign(values, values + tensor.get_size());
+            }
+        }
+        return outputs;
+    }
+
+    void Run() {
+        MicroBatchModel type;
+        size_t batch;
+        std::tie(type, batch) = GetParam();
+
+        const auto expected = infer(createModel(type), {}, batch);
+        const auto actual = infer(createModel(type), {{"CPU_MICRO_BATCH", microBatchSize}}, batch);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (const auto& output : expected) {
+            const auto& values = actual.at(output.first);
+            ASSERT_EQ(output.second.size(), values.size()) << output.first;
+            for (size_t i = 0; i < values.size(); i++)
+                ASSERT_NEAR(output.second[i], values[i], 1e-5f) << output.first << ", element " << i;
+        }
+    }
+};
+
+TEST_P(MicroBatchTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+// the batches of the whole micro-batches, of a shorter last one, and not larger than a micro-batch
+INSTANTIATE_TEST_SUITE_P(smoke_MicroBatch,
+                         MicroBatchTest,
+                         ::testing::Combine(::testing::Values(MicroBatchModel::Independent,
+                                                              MicroBatchModel::FlattenedOutput,
+                                                              MicroBatchModel::BatchSoftmax),
+                                            ::testing::ValuesIn(std::vector<size_t>{16, 10, 4, 1})),
+                         MicroBatchTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
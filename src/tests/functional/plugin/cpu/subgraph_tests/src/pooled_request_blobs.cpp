@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+const size_t pooledInputSize = 16;
+// the output is 4 times larger than the input, so the pool never gives the buffer of an output to an input
+const size_t pooledCopies = 4;
+
+}  // namespace
+
+class PooledRequestBlobsTest : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> createModel() {
+        auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, pooledInputSize});
+        input->get_output_tensor(0).set_names({"input"});
+        auto concat = std::make_shared<opset8::Concat>(OutputVector(pooledCopies, input), 1);
+        auto result = std::make_shared<opset8::Result>(concat);
+        result->get_output_tensor(0).set_names({"output"});
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{input});
+    }
+
+    ov::CompiledModel compileModel(bool pooled) {
+        auto core = ov::test::utils::PluginCache::get().core();
+        return core->compile_model(createModel(), "CPU", {{"CPU_POOLED_REQUEST_BLOBS", pooled ? "YES" : "NO"}});
+    }
+
+    static void fillInput(const ov::Tensor& tensor, float first) {
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < pooledInputSize; i++)
+            data[i] = first + static_cast<float>(i);
+    }
+
+    static void checkOutput(const ov::Tensor& tensor, float first) {
+        ASSERT_EQ(pooledInputSize * pooledCopies, tensor.get_size());
+        const auto* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            ASSERT_EQ(first + static_cast<float>(i % pooledInputSize), data[i]) << "element " << i;
+    }
+};
+
+TEST_F(PooledRequestBlobsTest, releasedOutputIsLeasedByAnotherRequest) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel(true);
+    auto first = compiledModel.create_infer_request();
+    auto second = compiledModel.create_infer_request();
+
+    fillInput(first.get_tensor("input"), 1.f);
+    first.infer();
+    const void* outputBuffer = nullptr;
+    {
+        auto output = first.get_tensor("output");
+        checkOutput(output, 1.f);
+        outputBuffer = output.data();
+    }
+    // the user does not hold the output, so its buffer is given back to the pool
+    first.release_tensors();
+
+    fillInput(second.get_tensor("input"), 100.f);
+    second.infer();
+    auto output = second.get_tensor("output");
+    ASSERT_EQ(outputBuffer, output.data());
+    checkOutput(output, 100.f);
+}
+
+TEST_F(PooledRequestBlobsTest, heldTensorsAreTakenBackWithTheirData) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel(true);
+    auto request = compiledModel.create_infer_request();
+
+    auto input = request.get_tensor("input");
+    fillInput(input, 1.f);
+    request.infer();
+    auto output = request.get_tensor("output");
+    checkOutput(output, 1.f);
+
+    request.release_tensors();
+    // the released tensors still held by the user keep their data and are leased again
+    checkOutput(output, 1.f);
+    ASSERT_EQ(output.data(), request.get_tensor("output").data());
+    ASSERT_EQ(input.data(), request.get_tensor("input").data());
+
+    // the input given back after the inference is taken back by the next one
+    request.infer();
+    ASSERT_EQ(output.data(), request.get_tensor("output").data());
+    checkOutput(output, 1.f);
+}
+
+TEST_F(PooledRequestBlobsTest, tensorsOfTheUserAreNotLeased) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel(true);
+    auto request = compiledModel.create_infer_request();
+
+    // the leased tensors are replaced by the ones of the user
+    auto leasedInput = request.get_tensor("input");
+    auto leasedOutput = request.get_tensor("output");
+    ov::Tensor input(element::f32, Shape{1, pooledInputSize});
+    ov::Tensor output(element::f32, Shape{1, pooledInputSize * pooledCopies});
+    request.set_tensor("input", input);
+    request.set_tensor("output", output);
+    fillInput(input, 1.f);
+    fillInput(leasedInput, -1.f);
+
+    request.infer();
+    checkOutput(output, 1.f);
+
+    request.release_tensors();
+    ASSERT_EQ(input.data(), request.get_tensor("input").data());
+    ASSERT_EQ(output.data(), request.get_tensor("output").data());
+
+    fillInput(input, 10.f);
+    request.infer();
+    checkOutput(output, 10.f);
+    ASSERT_NE(leasedOutput.data(), request.get_tensor("output").data());
+}
+
+TEST_F(PooledRequestBlobsTest, releaseDoesNothingWithoutThePool) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel(false);
+    auto request = compiledModel.create_infer_request();
+
+    fillInput(request.get_tensor("input"), 1.f);
+    request.infer();
+    const void* outputBuffer = request.get_tensor("output").data();
+
+    request.release_tensors();
+    ASSERT_EQ(outputBuffer, request.get_tensor("output").data());
+    checkOutput(request.get_tensor("output"), 1.f);
+
+    request.infer();
+    checkOutput(request.get_tensor("output"), 1.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
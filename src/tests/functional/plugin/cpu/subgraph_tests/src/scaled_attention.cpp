@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Query     Key
+ *      \      /
+ *       MatMul
+ *         |
+ *      Multiply    Mask
+ *          \      /
+ *            Add
+ *             |
+ *          Softmax    Value
+ *              \      /
+ *               MatMul
+ *                 |
+ *               Result
+ *
+ * The whole subgraph is fused into the single ScaledDotProductAttention node.
+ */
+
+class ScaledAttentionTest : public testing::WithParamInterface<InferenceEngine::Precision>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<InferenceEngine::Precision> obj) {
+        std::ostringstream result;
+        result << "ScaledAttentionTest" << obj.param.name();
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        if (Precision::BF16 == (inPrc = outPrc = this->GetParam()))
+            configuration.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
+        else
+            configuration.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+
+        const std::vector<size_t> qkvShape = {1, 4, 77, 32};
+        const std::vector<size_t> maskShape = {1, 1, 1, 77};
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {qkvShape, qkvShape, qkvShape, maskShape});
+
+        auto qk = std::make_shared<ngraph::opset8::MatMul>(params[0], params[1], false, true);
+        auto scale = ngraph::opset8::Constant::create(ngraph::element::f32, {}, {0.17677669f});
+        auto scaled = std::make_shared<ngraph::opset8::Multiply>(qk, scale);
+        auto masked = std::make_shared<ngraph::opset8::Add>(scaled, params[3]);
+        auto softmax = std::make_shared<ngraph::opset8::Softmax>(masked, -1);
+        auto attention = std::make_shared<ngraph::opset8::MatMul>(softmax, params[2]);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(attention)};
+        function = std::make_shared<ngraph::Function>(results, params, "ScaledAttention");
+    }
+};
+
+namespace {
+    TEST_P(ScaledAttentionTest, CompareWithRefs) {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        Run();
+        CheckNumberOfNodesWithType(executableNetwork, "ScaledDotProductAttention", 1);
+        CheckNumberOfNodesWithType(executableNetwork, "Softmax", 0);
+    }
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttention_CPU, ScaledAttentionTest,
+    testing::Values(Precision::FP32, Precision::BF16),
+    ScaledAttentionTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include <ie_core.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+// the rows are large enough for the Concat executed by the dynamic graph to take a measurable time
+const size_t bucketRowSize = 16384;
+const char* shapeBuckets = "a[1,4,16384],b[1,4,16384];a[1,2,16384],b[1,3,16384]";
+
+}  // namespace
+
+class ShapeBucketsTest : public ::testing::Test {
+protected:
+    // the Concat along the axis 1 is done in place by the static graphs, the dynamic graph executes it
+    static std::shared_ptr<ov::Model> createModel(const ov::PartialShape& shape) {
+        ParameterVector parameters;
+        OutputVector relus;
+        for (const auto& name : {"a", "b"}) {
+            parameters.push_back(std::make_shared<opset8::Parameter>(element::f32, shape));
+            parameters.back()->set_friendly_name(name);
+            parameters.back()->get_output_tensor(0).set_names({name});
+            relus.push_back(std::make_shared<opset8::Relu>(parameters.back()));
+        }
+        auto concat = std::make_shared<opset8::Concat>(relus, 1);
+        concat->set_friendly_name("concat");
+        auto result = std::make_shared<opset8::Result>(concat);
+        result->get_output_tensor(0).set_names({"output"});
+        return std::make_shared<ov::Model>(ResultVector{result}, parameters);
+    }
+
+    static std::shared_ptr<ov::Model> createDynamicModel() {
+        return createModel(ov::PartialShape{1, ov::Dimension::dynamic(), bucketRowSize});
+    }
+
+    static ov::CompiledModel compileModel(const std::shared_ptr<ov::Model>& model, const std::string& buckets) {
+        auto core = ov::test::utils::PluginCache::get().core();
+        return core->compile_model(model, "CPU", {{"CPU_SHAPE_BUCKETS", buckets}, ov::enable_profiling(true)});
+    }
+
+    static std::vector<float> fillInput(ov::InferRequest& request, const std::string& name, size_t rows, float first) {
+        ov::Tensor tensor(element::f32, Shape{1, rows, bucketRowSize});
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            data[i] = first + static_cast<float>(static_cast<int>(i % 7) - 3);
+        request.set_tensor(name, tensor);
+        return {data, data + tensor.get_size()};
+    }
+
+    // returns true if the request was run by the static graph of a bucket
+    static bool inferRows(ov::InferRequest& request, size_t rowsA, size_t rowsB, float first) {
+        auto expected = fillInput(request, "a", rowsA, first);
+        const auto inputB = fillInput(request, "b", rowsB, -first);
+        expected.insert(expected.end(), inputB.begin(), inputB.end());
+        for (auto& value : expected)
+            value = std::max(0.f, value);
+
+        request.infer();
+        auto output = request.get_tensor("output");
+        EXPECT_EQ((Shape{1, rowsA + rowsB, bucketRowSize}), output.get_shape());
+        const auto* data = output.data<float>();
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_EQ(expected[i], data[i]) << "element " << i;
+
+        for (const auto& info : request.get_profiling_info()) {
+            if (info.node_name == "concat")
+                return info.status == ov::ProfilingInfo::Status::NOT_RUN;
+        }
+        ADD_FAILURE() << "The Concat is not found in the profiling information";
+        return false;
+    }
+};
+
+TEST_F(ShapeBucketsTest, wrongBucketsThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const auto model = createDynamicModel();
+    for (const auto& buckets : {"a[1,4,16384", "a1,4,16384]", "a]1,4,16384[", "[1,4,16384]", "a[1,x,16384]",
+                                "a[1,-4,16384]", "a[1,,16384]", "a[1,4,16384]b[1,4,16384]",
+                                "a[1,4,16384],a[1,4,16384]", ";", "a[1,4,16384];;b[1,4,16384]",
+                                "a[1,99999999999999999999999999,16384]"}) {
+        ASSERT_THROW(compileModel(model, buckets), ov::Exception) << buckets;
+    }
+}
+
+TEST_F(ShapeBucketsTest, bucketsAreCheckedAgainstTheInputs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const auto model = createDynamicModel();
+    // the unknown input, the rank and the static dimensions the input does not have
+    ASSERT_THROW(compileModel(model, "c[1,4,16384]"), ov::Exception);
+    ASSERT_THROW(compileModel(model, "a[1,4]"), ov::Exception);
+    ASSERT_THROW(compileModel(model, "a[2,4,16384]"), ov::Exception);
+    ASSERT_THROW(compileModel(model, "a[1,4,8],b[1,4,16384]"), ov::Exception);
+    ASSERT_NO_THROW(compileModel(model, shapeBuckets));
+    // the inputs not listed keep their shapes
+    ASSERT_NO_THROW(compileModel(model, "a[1,4,16384]"));
+}
+
+TEST_F(ShapeBucketsTest, bucketsThrowForTheLegacyApi) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    const auto model = createModel(Shape{1, 4, bucketRowSize});
+    ASSERT_NO_THROW(compileModel(model, "a[1,4,16384]"));
+
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork network(model);
+    ASSERT_THROW(ie.LoadNetwork(network, "CPU", {{"CPU_SHAPE_BUCKETS", "a[1,4,16384]"}}), InferenceEngine::Exception);
+}
+
+TEST_F(ShapeBucketsTest, bucketShapesAreInferredByTheStaticGraphs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel(createDynamicModel(), shapeBuckets);
+    auto request = compiledModel.create_infer_request();
+
+    ASSERT_TRUE(inferRows(request, 4, 4, 1.f));
+    ASSERT_TRUE(inferRows(request, 2, 3, 2.f));
+    // the shapes of the inputs match different buckets
+    ASSERT_FALSE(inferRows(request, 4, 3, 3.f));
+    ASSERT_FALSE(inferRows(request, 2, 4, 4.f));
+    // the shapes of no bucket
+    ASSERT_FALSE(inferRows(request, 5, 1, 5.f));
+    ASSERT_FALSE(inferRows(request, 1, 1, 6.f));
+
+    // the request switches between the graphs
+    ASSERT_TRUE(inferRows(request, 4, 4, 7.f));
+    ASSERT_FALSE(inferRows(request, 3, 3, 8.f));
+    ASSERT_TRUE(inferRows(request, 2, 3, 9.f));
+
+    // the other request uses the same static graphs
+    auto otherRequest = compiledModel.create_infer_request();
+    ASSERT_TRUE(inferRows(otherRequest, 2, 3, 10.f));
+    ASSERT_FALSE(inferRows(otherRequest, 6, 2, 11.f));
+}
+
+}  // namespace SubgraphTestsDefinitions
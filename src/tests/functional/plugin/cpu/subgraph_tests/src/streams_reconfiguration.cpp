@@ -0,0 +1,187 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+const size_t reconfiguredSize = 32;
+// more requests than the streams, so the inferences run on all the replicas of the graph at once
+const size_t reconfiguredRequests = 8;
+
+}  // namespace
+
+class StreamsReconfigurationTest : public ::testing::Test {
+protected:
+    static float weight(size_t i, size_t j) {
+        return static_cast<float>(static_cast<int>((i * 7 + j * 3) % 11) - 5) / reconfiguredSize;
+    }
+
+    std::shared_ptr<ov::Model> createModel() {
+        auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, reconfiguredSize});
+        input->get_output_tensor(0).set_names({"input"});
+        std::vector<float> weights(reconfiguredSize * reconfiguredSize);
+        for (size_t i = 0; i < reconfiguredSize; i++) {
+            for (size_t j = 0; j < reconfiguredSize; j++)
+                weights[i * reconfiguredSize + j] = weight(i, j);
+        }
+        auto constant = opset8::Constant::create(element::f32, Shape{reconfiguredSize, reconfiguredSize}, weights);
+        auto matMul = std::make_shared<opset8::MatMul>(input, constant);
+        auto relu = std::make_shared<opset8::Relu>(matMul);
+        auto result = std::make_shared<opset8::Result>(relu);
+        result->get_output_tensor(0).set_names({"output"});
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{input});
+    }
+
+    ov::CompiledModel compileModel(const ov::AnyMap& config) {
+        auto core = ov::test::utils::PluginCache::get().core();
+        return core->compile_model(createModel(), "CPU", config);
+    }
+
+    static void fillInput(const ov::Tensor& tensor, float first) {
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < reconfiguredSize; i++)
+            data[i] = first + static_cast<float>(i % 5);
+    }
+
+    static void checkOutput(const ov::Tensor& tensor, float first) {
+        const auto* data = tensor.data<float>();
+        for (size_t j = 0; j < reconfiguredSize; j++) {
+            float expected = 0.f;
+            for (size_t i = 0; i < reconfiguredSize; i++)
+                expected += (first + static_cast<float>(i % 5)) * weight(i, j);
+            ASSERT_NEAR(std::max(0.f, expected), data[j], 1e-4f) << "element " << j;
+        }
+    }
+
+    // the requests run at once, each of them on its own input
+    static void inferAsync(std::vector<ov::InferRequest>& requests) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            fillInput(requests[i].get_tensor("input"), static_cast<float>(i));
+            requests[i].start_async();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            requests[i].wait();
+            checkOutput(requests[i].get_tensor("output"), static_cast<float>(i));
+        }
+    }
+
+    static void inferSync(ov::InferRequest& request, float first) {
+        fillInput(request.get_tensor("input"), first);
+        request.infer();
+        checkOutput(request.get_tensor("output"), first);
+    }
+
+    static std::vector<ov::InferRequest> createRequests(ov::CompiledModel& compiledModel) {
+        std::vector<ov::InferRequest> requests;
+        for (size_t i = 0; i < reconfiguredRequests; i++)
+            requests.push_back(compiledModel.create_infer_request());
+        return requests;
+    }
+};
+
+TEST_F(StreamsReconfigurationTest, streamsGrowAndShrink) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel({ov::num_streams(1)});
+    ASSERT_EQ(1, compiledModel.get_property(ov::num_streams).num);
+    auto requests = createRequests(compiledModel);
+    inferAsync(requests);
+
+    // the replicas of the new streams are created on their first use
+    compiledModel.set_property({ov::num_streams(4)});
+    ASSERT_EQ(4, compiledModel.get_property(ov::num_streams).num);
+    inferAsync(requests);
+
+    compiledModel.set_property({ov::num_streams(2)});
+    ASSERT_EQ(2, compiledModel.get_property(ov::num_streams).num);
+    inferAsync(requests);
+
+    // the retired replicas are used again
+    compiledModel.set_property({ov::num_streams(4)});
+    ASSERT_EQ(4, compiledModel.get_property(ov::num_streams).num);
+    inferAsync(requests);
+
+    compiledModel.set_property({ov::inference_num_threads(2)});
+    ASSERT_EQ(2, compiledModel.get_property(ov::inference_num_threads));
+    inferAsync(requests);
+}
+
+TEST_F(StreamsReconfigurationTest, requestsCreatedBeforeKeepWorking) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel({ov::num_streams(2)});
+    auto before = createRequests(compiledModel);
+    inferAsync(before);
+    inferSync(before.front(), 10.f);
+
+    compiledModel.set_property({ov::num_streams(3)});
+    auto after = createRequests(compiledModel);
+    inferAsync(before);
+    inferAsync(after);
+    inferSync(before.front(), 20.f);
+    inferSync(after.front(), 30.f);
+
+    compiledModel.set_property({ov::num_streams(1)});
+    inferAsync(before);
+    inferAsync(after);
+    inferSync(before.back(), 40.f);
+}
+
+TEST_F(StreamsReconfigurationTest, reconfigurationWaitsForTheSyncInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel({ov::num_streams(2)});
+    auto request = compiledModel.create_infer_request();
+
+    // the synchronous inferences are run by the caller, not by the streams being reconfigured
+    std::atomic<bool> done{false};
+    std::thread thread([&] {
+        float first = 0.f;
+        while (!done) {
+            inferSync(request, first);
+            first += 1.f;
+        }
+    });
+    for (int streams : {4, 1, 3, 2})
+        compiledModel.set_property({ov::num_streams(streams)});
+    done = true;
+    thread.join();
+
+    auto requests = createRequests(compiledModel);
+    inferAsync(requests);
+}
+
+TEST_F(StreamsReconfigurationTest, otherKeysThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto compiledModel = compileModel({ov::num_streams(2)});
+    ASSERT_THROW(compiledModel.set_property({ov::enable_profiling(true)}), ov::Exception);
+    ASSERT_THROW(compiledModel.set_property({{"CPU_BIND_THREAD", "NO"}}), ov::Exception);
+    // the rejected keys do not change the streams
+    ASSERT_THROW(compiledModel.set_property({ov::num_streams(4), ov::enable_profiling(true)}), ov::Exception);
+    ASSERT_EQ(2, compiledModel.get_property(ov::num_streams).num);
+
+    auto requests = createRequests(compiledModel);
+    inferAsync(requests);
+}
+
+TEST_F(StreamsReconfigurationTest, exclusiveAsyncRequestsThrow) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    // the executor is shared by the networks of the exclusive async requests
+    auto compiledModel = compileModel({ov::num_streams(1), {"EXCLUSIVE_ASYNC_REQUESTS", "YES"}});
+    ASSERT_THROW(compiledModel.set_property({ov::num_streams(2)}), ov::Exception);
+
+    auto requests = createRequests(compiledModel);
+    inferAsync(requests);
+}
+
+}  // namespace SubgraphTestsDefinitions
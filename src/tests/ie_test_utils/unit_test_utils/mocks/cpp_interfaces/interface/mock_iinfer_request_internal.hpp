@@ -28,6 +28,9 @@ public:
     MOCK_METHOD1(SetBatch, void(int));
     MOCK_METHOD0(QueryState, std::vector<InferenceEngine::IVariableStateInternal::Ptr>());
     MOCK_METHOD0(Cancel, void());
+    MOCK_METHOD1(SetDeadline, void(const std::chrono::steady_clock::time_point&));
+    MOCK_METHOD0(ReleaseBlobs, void());
+    MOCK_METHOD1(SetInputReady, void(const std::string&));
     MOCK_METHOD0(StartAsyncImpl, void());
     MOCK_METHOD0(InferImpl, void());
     MOCK_METHOD0(checkBlobs, void());
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "blob_pool.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(BlobPoolTests, BuffersAreReused) {
+    BlobPool pool;
+    auto allocator = pool.getAllocator();
+
+    void* first = allocator->alloc(1000);
+    void* second = allocator->alloc(1000);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(first, second);
+    ASSERT_EQ(pool.leasedBytes(), 2000u);
+    ASSERT_EQ(pool.pooledBytes(), 0u);
+
+    allocator->free(first);
+    ASSERT_EQ(pool.leasedBytes(), 1000u);
+    ASSERT_EQ(pool.pooledBytes(), 1000u);
+
+    // the next lease of a fitting size takes the given back buffer
+    void* third = allocator->alloc(600);
+    ASSERT_EQ(third, first);
+    ASSERT_EQ(pool.leasedBytes(), 2000u);
+    ASSERT_EQ(pool.pooledBytes(), 0u);
+
+    allocator->free(second);
+    allocator->free(third);
+    ASSERT_EQ(pool.leasedBytes(), 0u);
+    ASSERT_EQ(pool.pooledBytes(), 2000u);
+}
+
+TEST(BlobPoolTests, MuchLargerBuffersAreKept) {
+    BlobPool pool;
+    auto allocator = pool.getAllocator();
+
+    void* large = allocator->alloc(1 << 20);
+    allocator->free(large);
+
+    void* small = allocator->alloc(100);
+    ASSERT_NE(small, large);
+    ASSERT_EQ(pool.pooledBytes(), 1u << 20);
+    allocator->free(small);
+}
+
+TEST(BlobPoolTests, LeasesOutliveThePool) {
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
+    void* buffer = nullptr;
+    {
+        BlobPool pool;
+        allocator = pool.getAllocator();
+        buffer = allocator->alloc(64);
+    }
+    // the storage is kept alive by the allocator of the blobs still holding the buffers
+    ASSERT_TRUE(allocator->free(buffer));
+}
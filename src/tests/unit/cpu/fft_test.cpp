@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "nodes/common/fft.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::vector<std::complex<double>> referenceDFT(const std::vector<float>& data, size_t n, bool inverse) {
+    const double pi = std::acos(-1.0);
+    std::vector<std::complex<double>> result(n);
+    for (size_t k = 0; k < n; k++) {
+        for (size_t j = 0; j < n; j++) {
+            const double angle = (inverse ? 2.0 : -2.0) * pi * static_cast<double>((j * k) % n) / static_cast<double>(n);
+            result[k] += std::complex<double>(data[2 * j], data[2 * j + 1]) * std::polar(1.0, angle);
+        }
+    }
+    return result;
+}
+
+std::vector<float> randomData(size_t size) {
+    std::mt19937 generator(static_cast<unsigned>(size));
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> data(size);
+    for (auto& value : data)
+        value = distribution(generator);
+    return data;
+}
+
+}  // namespace
+
+class FFTPlanTests : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(FFTPlanTests, MatchesReferenceDFT) {
+    const size_t n = GetParam();
+    const auto plan = getFFTPlan(n);
+    ASSERT_EQ(plan->size(), n);
+    std::vector<float> scratch(plan->scratchSize());
+
+    for (bool inverse : {false, true}) {
+        const auto input = randomData(2 * n);
+        auto output = input;
+        plan->execute(output.data(), inverse, scratch.data());
+
+        const auto expected = referenceDFT(input, n, inverse);
+        const double tolerance = 1e-5 * n;
+        for (size_t k = 0; k < n; k++) {
+            ASSERT_NEAR(output[2 * k], expected[k].real(), tolerance) << "n = " << n << ", k = " << k;
+            ASSERT_NEAR(output[2 * k + 1], expected[k].imag(), tolerance) << "n = " << n << ", k = " << k;
+        }
+    }
+}
+
+TEST_P(FFTPlanTests, RealTransformRoundTrip) {
+    const size_t n = GetParam();
+    const auto plan = getRealFFTPlan(n);
+    std::vector<float> scratch(plan->scratchSize());
+
+    const auto input = randomData(n);
+    std::vector<float> spectrum(2 * (n / 2 + 1));
+    plan->forward(input.data(), spectrum.data(), scratch.data());
+
+    std::vector<float> complexInput(2 * n, 0.f);
+    for (size_t i = 0; i < n; i++)
+        complexInput[2 * i] = input[i];
+    const auto expected = referenceDFT(complexInput, n, false);
+    const double tolerance = 1e-5 * n;
+    for (size_t k = 0; k <= n / 2; k++) {
+        ASSERT_NEAR(spectrum[2 * k], expected[k].real(), tolerance) << "n = " << n << ", k = " << k;
+        ASSERT_NEAR(spectrum[2 * k + 1], expected[k].imag(), tolerance) << "n = " << n << ", k = " << k;
+    }
+
+    std::vector<float> restored(n);
+    plan->inverse(spectrum.data(), restored.data(), scratch.data());
+    for (size_t i = 0; i < n; i++)
+        ASSERT_NEAR(restored[i] / n, input[i], 1e-5) << "n = " << n << ", i = " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FFT, FFTPlanTests,
+                         ::testing::Values(1, 2, 3, 4, 5, 6, 8, 12, 15, 16, 30, 64, 97, 100, 243, 400, 480, 1021, 2048));
+
+TEST(FFTPlanCacheTests, SharedPlans) {
+    ASSERT_EQ(getFFTPlan(120), getFFTPlan(120));
+    ASSERT_NE(getFFTPlan(120), getFFTPlan(60));
+    ASSERT_EQ(getRealFFTPlan(120), getRealFFTPlan(120));
+}
@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_blob.h>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include "mkldnn_graph.h"
+#include "mkldnn_extension_mngr.h"
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "graph_test_utils.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace CPUUnitTestUtils;
+
+namespace {
+
+const size_t replayWidth = 16;
+
+// Parameter -> Relu -> Softmax -> Result, the Softmax runs a primitive and the Eltwise runs the JIT executor
+CNNNetwork makeReplayNetwork() {
+    auto parameter = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, replayWidth});
+    parameter->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset8::Relu>(parameter);
+    auto softmax = std::make_shared<ngraph::opset8::Softmax>(relu, 1);
+    softmax->set_friendly_name("softmax");
+    auto result = std::make_shared<ngraph::opset8::Result>(softmax);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{parameter}));
+}
+
+const size_t replayChannels = 16;
+const size_t replaySpatial = 4;
+const size_t replayOutputs = 8;
+
+// Parameter -> Convolution -> Reshape -> FullyConnected -> Result, the blocked layout of the Convolution
+// is reordered from the planar input and to the planar input of the FullyConnected
+std::shared_ptr<ngraph::Function> makeReplayLayersFunction() {
+    auto parameter = std::make_shared<ngraph::opset8::Parameter>(
+        ngraph::element::f32, ngraph::Shape{1, replayChannels, replaySpatial, replaySpatial});
+    parameter->set_friendly_name("input");
+    std::vector<float> convolutionWeights(replayChannels * replayChannels);
+    for (size_t i = 0; i < convolutionWeights.size(); i++)
+        convolutionWeights[i] = static_cast<float>(static_cast<int>(i % 5) - 2) / replayChannels;
+    auto convolution = std::make_shared<ngraph::opset8::Convolution>(
+        parameter,
+        ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{replayChannels, replayChannels, 1, 1},
+                                         convolutionWeights),
+        ngraph::Strides{1, 1},
+        ngraph::CoordinateDiff{0, 0},
+        ngraph::CoordinateDiff{0, 0},
+        ngraph::Strides{1, 1});
+    const size_t features = replayChannels * replaySpatial * replaySpatial;
+    auto reshape = std::make_shared<ngraph::opset8::Reshape>(
+        convolution,
+        ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, static_cast<int64_t>(features)}),
+        false);
+    std::vector<float> fullyConnectedWeights(replayOutputs * features);
+    for (size_t i = 0; i < fullyConnectedWeights.size(); i++)
+        fullyConnectedWeights[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / features;
+    auto fullyConnected = std::make_shared<FullyConnectedNode>(
+        reshape,
+        ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{replayOutputs, features},
+                                         fullyConnectedWeights),
+        ngraph::Rank(2));
+    fullyConnected->set_friendly_name("output");
+    auto result = std::make_shared<ngraph::opset8::Result>(fullyConnected);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{parameter});
+}
+
+std::vector<float> referenceSoftmaxOfRelu(const std::vector<float>& input) {
+    std::vector<float> output(input.size());
+    float sum = 0.f;
+    for (size_t i = 0; i < input.size(); i++) {
+        output[i] = std::exp(std::max(input[i], 0.f));
+        sum += output[i];
+    }
+    for (auto& value : output)
+        value /= sum;
+    return output;
+}
+
+std::vector<float> inferReplayGraph(MKLDNNGraph& graph, std::vector<float> input) {
+    const TensorDesc desc{Precision::FP32, {1, replayWidth}, Layout::NC};
+    graph.PushInputData("input", make_shared_blob<float>(desc, input.data()));
+    graph.Infer();
+
+    std::vector<float> output(replayWidth);
+    BlobMap outputs;
+    outputs[graph.GetOutputNodesMap().begin()->first] = make_shared_blob<float>(desc, output.data());
+    graph.PullOutputData(outputs);
+    return output;
+}
+
+}  // namespace
+
+TEST(GraphReplayTests, replayedInferencesReadTheNewInputs) {
+    Config config;
+    config.graphReplay = true;
+    MKLDNNGraph graph;
+    graph.setConfig(config);
+    auto network = makeReplayNetwork();
+    MKLDNNWeightsSharing::Ptr weightsCache;
+    graph.CreateGraph(network, std::make_shared<MKLDNNExtensionManager>(), weightsCache);
+    ASSERT_EQ(0u, graph.GetReplayedNodesCount());
+
+    for (int i = 0; i < 3; i++) {
+        std::vector<float> input(replayWidth);
+        for (size_t j = 0; j < replayWidth; j++)
+            input[j] = static_cast<float>((j * 7 + i * 3) % 11) - 5.f;
+
+        const auto output = inferReplayGraph(graph, input);
+        const auto expected = referenceSoftmaxOfRelu(input);
+        for (size_t j = 0; j < replayWidth; j++)
+            ASSERT_NEAR(expected[j], output[j], 1e-5f) << "inference " << i << ", element " << j;
+    }
+    // the kernels of the Softmax and the Relu were recorded on the first inference and replayed by the next ones
+    const bool jitEltwise = mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::sse41);
+    ASSERT_EQ(jitEltwise ? 2u : 1u, graph.GetReplayedNodesCount());
+}
+
+TEST(GraphReplayTests, reordersAndFullyConnectedAreReplayed) {
+    Config replayConfig;
+    replayConfig.graphReplay = true;
+    MKLDNNGraph replayed;
+    createGraph(replayed, makeReplayLayersFunction(), replayConfig);
+    MKLDNNGraph executed;
+    createGraph(executed, makeReplayLayersFunction(), Config{});
+
+    for (int i = 0; i < 3; i++) {
+        std::vector<float> input(replayChannels * replaySpatial * replaySpatial);
+        for (size_t j = 0; j < input.size(); j++)
+            input[j] = static_cast<float>((j * 5 + i * 3) % 13) - 6.f;
+
+        const auto expected = inferGraph(executed, {{"input", input}});
+        const auto output = inferGraph(replayed, {{"input", input}});
+        ASSERT_EQ(expected.size(), output.size());
+        const auto& expectedOutput = expected.begin()->second;
+        const auto& replayedOutput = output.begin()->second;
+        ASSERT_EQ(expectedOutput.size(), replayedOutput.size());
+        for (size_t j = 0; j < expectedOutput.size(); j++)
+            ASSERT_NEAR(expectedOutput[j], replayedOutput[j], 1e-4f) << "inference " << i << ", element " << j;
+    }
+    // the Convolution, the FullyConnected and the Reorders around the blocked layout are replayed
+    ASSERT_EQ(countRuntimeReorders(replayed) + 2, replayed.GetReplayedNodesCount());
+    ASSERT_EQ(0u, executed.GetReplayedNodesCount());
+}
+
+TEST(GraphReplayTests, primitiveNodesCaptureTheirKernels) {
+    MKLDNNGraph graph;
+    graph.setConfig(Config{});
+    auto network = makeReplayNetwork();
+    MKLDNNWeightsSharing::Ptr weightsCache;
+    graph.CreateGraph(network, std::make_shared<MKLDNNExtensionManager>(), weightsCache);
+
+    for (const auto& node : graph.GetNodes()) {
+        MKLDNNNode::Kernel kernel;
+        const bool captured = node->captureKernel(kernel);
+        if (node->getType() == Softmax) {
+            ASSERT_TRUE(captured);
+            ASSERT_NE(nullptr, kernel.function);
+            ASSERT_NE(nullptr, kernel.kernel);
+        } else if (node->getType() == Eltwise) {
+            // the reference executor is run by execute()
+            ASSERT_EQ(mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::sse41), captured);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_algorithm.hpp>
+#include <ie_blob.h>
+#include <ngraph/function.hpp>
+
+#include "mkldnn_graph.h"
+#include "mkldnn_extension_mngr.h"
+
+namespace CPUUnitTestUtils {
+
+using GraphTensors = std::map<std::string, std::vector<float>>;
+
+// compiles the function of the f32 inputs and outputs into the graph, as the executable network does for a stream
+inline void createGraph(MKLDNNPlugin::MKLDNNGraph& graph,
+                        const std::shared_ptr<ngraph::Function>& function,
+                        const MKLDNNPlugin::Config& config) {
+    InferenceEngine::CNNNetwork network(function);
+    MKLDNNPlugin::MKLDNNWeightsSharing::Ptr weightsCache;
+    graph.setConfig(config);
+    graph.CreateGraph(network, std::make_shared<MKLDNNPlugin::MKLDNNExtensionManager>(), weightsCache);
+}
+
+inline InferenceEngine::TensorDesc planarDesc(const InferenceEngine::SizeVector& dims) {
+    return {InferenceEngine::Precision::FP32, dims, InferenceEngine::TensorDesc::getLayoutByDims(dims)};
+}
+
+// runs the graph on the planar inputs by the input names, returns the planar outputs by the output names
+inline GraphTensors inferGraph(MKLDNNPlugin::MKLDNNGraph& graph, GraphTensors inputs) {
+    for (auto& input : inputs) {
+        const auto& dims = graph.GetInputNodesMap().at(input.first)->getChildEdgeAt(0)->getMemory().getStaticDims();
+        graph.PushInputData(input.first, InferenceEngine::make_shared_blob<float>(planarDesc(dims), input.second.data()));
+    }
+    graph.Infer();
+
+    GraphTensors outputs;
+    InferenceEngine::BlobMap blobs;
+    for (const auto& output : graph.GetOutputNodesMap()) {
+        const auto& dims = output.second->getParentEdgeAt(0)->getMemory().getStaticDims();
+        auto& data = outputs[output.first];
+        data.resize(InferenceEngine::details::product(dims));
+        blobs[output.first] = InferenceEngine::make_shared_blob<float>(planarDesc(dims), data.data());
+    }
+    graph.PullOutputData(blobs);
+    return outputs;
+}
+
+// the Reorder nodes run on each inference, the constant ones run once on the graph creation
+inline size_t countRuntimeReorders(const MKLDNNPlugin::MKLDNNGraph& graph) {
+    size_t count = 0;
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() == MKLDNNPlugin::Reorder && !node->isConstant())
+            count++;
+    }
+    return count;
+}
+
+}  // namespace CPUUnitTestUtils
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "utils/huge_pages.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+size_t totalBytes(const HugePagesStats& stats) {
+    return stats.explicitBytes + stats.transparentBytes + stats.fallbackBytes;
+}
+
+}  // namespace
+
+TEST(HugePagesTests, ScopeSetsThreadMode) {
+    ASSERT_EQ(HugePagesAllocator::currentMode(), HugePagesMode::Disabled);
+    {
+        HugePagesScope scope(HugePagesMode::Transparent);
+        ASSERT_EQ(HugePagesAllocator::currentMode(), HugePagesMode::Transparent);
+        {
+            HugePagesScope nested(HugePagesMode::Explicit);
+            ASSERT_EQ(HugePagesAllocator::currentMode(), HugePagesMode::Explicit);
+        }
+        ASSERT_EQ(HugePagesAllocator::currentMode(), HugePagesMode::Transparent);
+    }
+    ASSERT_EQ(HugePagesAllocator::currentMode(), HugePagesMode::Disabled);
+}
+
+TEST(HugePagesTests, OnlyLargeBuffersAreEligible) {
+    ASSERT_FALSE(HugePagesAllocator::isEligible(64ul << 20));
+
+    HugePagesScope scope(HugePagesMode::Transparent);
+    ASSERT_FALSE(HugePagesAllocator::isEligible(4096));
+    ASSERT_TRUE(HugePagesAllocator::isEligible(2ul << 20));
+}
+
+// the huge pages may be unavailable on the machine, so the allocation is checked to be accounted and usable only
+TEST(HugePagesTests, AllocationsAreAccounted) {
+    for (auto mode : {HugePagesMode::Transparent, HugePagesMode::Explicit}) {
+        HugePagesScope scope(mode);
+        const auto before = HugePagesAllocator::stats();
+
+        const size_t size = (4ul << 20) + 100;
+        auto ptr = static_cast<uint8_t*>(HugePagesAllocator::allocate(size));
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0u);
+        std::memset(ptr, 1, size);
+        ASSERT_EQ(ptr[size - 1], 1);
+        ASSERT_GE(totalBytes(HugePagesAllocator::stats()), totalBytes(before) + size);
+
+        HugePagesAllocator::free(ptr);
+        ASSERT_EQ(totalBytes(HugePagesAllocator::stats()), totalBytes(before));
+    }
+}
@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_blob.h>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
+#include "mkldnn_plugin.h"
+#include "mkldnn_exec_network.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+
+// the allocations are counted on the thread of the test only, the workers of the threading runtime allocate on their own
+thread_local bool countAllocations = false;
+thread_local size_t allocations = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (countAllocations)
+        allocations++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+// the synchronous request of the network compiled by the plugin, Parameter -> Result when empty,
+// Parameter -> Relu -> Result otherwise
+class StaticRequest {
+public:
+    explicit StaticRequest(bool empty) {
+        auto parameter = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16});
+        parameter->set_friendly_name("input");
+        parameter->get_output_tensor(0).set_names({"input"});
+        std::shared_ptr<ngraph::Node> output = parameter;
+        if (!empty) {
+            output = std::make_shared<ngraph::opset8::Relu>(parameter);
+            output->set_friendly_name("relu");
+            output->get_output_tensor(0).set_names({"relu"});
+        }
+        auto result = std::make_shared<ngraph::opset8::Result>(output);
+        CNNNetwork network(std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                              ngraph::ParameterVector{parameter}));
+
+        core = std::make_shared<NiceMock<MockICore>>();
+        ON_CALL(*core, isNewAPI()).WillByDefault(Return(true));
+        plugin = std::make_shared<Engine>();
+        plugin->SetCore(core);
+        execNetwork = std::dynamic_pointer_cast<MKLDNNExecNetwork>(plugin->LoadNetwork(network, {}));
+        request = execNetwork->CreateInferRequestImpl(execNetwork->getInputs(), execNetwork->getOutputs());
+
+        auto input = request->GetBlob("input");
+        std::fill_n(input->buffer().as<float*>(), input->size(), 1.f);
+    }
+
+    // checkBlobs, the choice of the graph, the pointers of the user blobs, the inputs, the nodes and the outputs
+    void infer() {
+        request->Infer();
+    }
+
+private:
+    std::shared_ptr<MockICore> core;
+    std::shared_ptr<Engine> plugin;
+    std::shared_ptr<MKLDNNExecNetwork> execNetwork;
+    IInferRequestInternal::Ptr request;
+};
+
+size_t countInferAllocations(StaticRequest& request) {
+    // the first inference may initialize the lazy state
+    request.infer();
+    allocations = 0;
+    countAllocations = true;
+    for (int i = 0; i < 100; i++)
+        request.infer();
+    countAllocations = false;
+    return allocations;
+}
+
+}  // namespace
+
+TEST(InferOverheadTests, emptyModelInferDoesNotAllocate) {
+    StaticRequest request{true};
+    ASSERT_EQ(0u, countInferAllocations(request));
+}
+
+TEST(InferOverheadTests, tinyModelInferDoesNotAllocate) {
+    // the reference Eltwise executor is not tuned for the steady state
+    if (!mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::sse41))
+        GTEST_SKIP();
+    StaticRequest request{false};
+    ASSERT_EQ(0u, countInferAllocations(request));
+}
+
+// Overhead of the inference of the empty and the tiny models, run it with --gtest_also_run_disabled_tests
+TEST(InferOverheadTests, DISABLED_benchmark) {
+    for (bool empty : {true, false}) {
+        StaticRequest request{empty};
+        request.infer();
+        const int iterations = 100000;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            request.infer();
+        const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::cout << (empty ? "empty model: " : "tiny model: ") << ns / iterations << " ns per inference" << std::endl;
+    }
+}
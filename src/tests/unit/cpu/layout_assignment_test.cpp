@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include "graph_test_utils.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace CPUUnitTestUtils;
+
+namespace {
+
+const size_t layoutChannels = 16;
+
+std::shared_ptr<ngraph::Node> makeLayoutConvolution(const std::shared_ptr<ngraph::Node>& input, float scale) {
+    std::vector<float> weights(layoutChannels * layoutChannels * 3 * 3);
+    for (size_t i = 0; i < weights.size(); i++)
+        weights[i] = scale * static_cast<float>(static_cast<int>(i % 7) - 3) / weights.size();
+    auto constant = ngraph::opset8::Constant::create(ngraph::element::f32,
+                                                     ngraph::Shape{layoutChannels, layoutChannels, 3, 3},
+                                                     weights);
+    return std::make_shared<ngraph::opset8::Convolution>(input,
+                                                         constant,
+                                                         ngraph::Strides{1, 1},
+                                                         ngraph::CoordinateDiff{1, 1},
+                                                         ngraph::CoordinateDiff{1, 1},
+                                                         ngraph::Strides{1, 1});
+}
+
+// The planar input feeds a Relu consumed by two Convolutions of the blocked layouts. The greedy selection keeps
+// the Relu planar after its parent and reorders both of its outputs, running the Relu in the blocked layout needs
+// a single reorder of its input. The input is a Result too, so the Relu is not in place.
+std::shared_ptr<ngraph::Function> makeMixedLayoutChain() {
+    auto parameter = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32,
+                                                                 ngraph::Shape{1, layoutChannels, 8, 8});
+    parameter->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset8::Relu>(parameter);
+    auto first = makeLayoutConvolution(relu, 1.f);
+    first->set_friendly_name("first");
+    auto second = makeLayoutConvolution(relu, -2.f);
+    second->set_friendly_name("second");
+    ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(first),
+                                 std::make_shared<ngraph::opset8::Result>(second),
+                                 std::make_shared<ngraph::opset8::Result>(parameter)};
+    return std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{parameter});
+}
+
+GraphTensors makeLayoutChainInputs() {
+    std::vector<float> input(layoutChannels * 8 * 8);
+    for (size_t i = 0; i < input.size(); i++)
+        input[i] = static_cast<float>(static_cast<int>(i % 13) - 6) / 4.f;
+    return {{"input", input}};
+}
+
+}  // namespace
+
+TEST(LayoutAssignmentTests, mixedLayoutChainHasFewerReorders) {
+    // the Convolutions without the JIT kernels run in the planar layout, there are no reorders to eliminate
+    if (!mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::sse41))
+        GTEST_SKIP();
+
+    Config greedyConfig;
+    greedyConfig.globalLayoutAssignment = false;
+    MKLDNNGraph greedy;
+    createGraph(greedy, makeMixedLayoutChain(), greedyConfig);
+    ASSERT_FALSE(greedy.getLayoutAssignmentStats().applied);
+
+    Config globalConfig;
+    globalConfig.globalLayoutAssignment = true;
+    MKLDNNGraph global;
+    createGraph(global, makeMixedLayoutChain(), globalConfig);
+
+    const auto& stats = global.getLayoutAssignmentStats();
+    ASSERT_TRUE(stats.applied);
+    ASSERT_LT(stats.reorders, stats.greedyReorders);
+    ASSERT_LT(stats.reorderBytes, stats.greedyReorderBytes);
+    ASSERT_NE(0u, stats.reselectedNodes);
+    ASSERT_LT(countRuntimeReorders(global), countRuntimeReorders(greedy));
+}
+
+TEST(LayoutAssignmentTests, mixedLayoutChainKeepsTheAccuracy) {
+    Config greedyConfig;
+    greedyConfig.globalLayoutAssignment = false;
+    MKLDNNGraph greedy;
+    createGraph(greedy, makeMixedLayoutChain(), greedyConfig);
+
+    Config globalConfig;
+    globalConfig.globalLayoutAssignment = true;
+    MKLDNNGraph global;
+    createGraph(global, makeMixedLayoutChain(), globalConfig);
+
+    const auto expected = inferGraph(greedy, makeLayoutChainInputs());
+    const auto actual = inferGraph(global, makeLayoutChainInputs());
+    ASSERT_EQ(expected.size(), actual.size());
+    for (const auto& output : expected) {
+        const auto& values = actual.at(output.first);
+        ASSERT_EQ(output.second.size(), values.size());
+        for (size_t i = 0; i < values.size(); i++)
+            ASSERT_NEAR(output.second[i], values[i], 1e-5f) << output.first << ", element " << i;
+    }
+}
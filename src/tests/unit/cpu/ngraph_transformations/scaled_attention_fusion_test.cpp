@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/scaled_attention_fusion.hpp>
+#include <ngraph_transformations/op/scaled_attention.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+
+TEST(TransformationTests, ScaledAttentionFusionWithMask) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 12, 128, 64 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 12, 128, 64 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 12, 128, 64 });
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 128 });
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 0.125f });
+        auto scaled = std::make_shared<ngraph::opset1::Multiply>(qk, scale);
+        auto masked = std::make_shared<ngraph::opset1::Add>(scaled, mask);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(masked, 3);
+        auto attention = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ attention }, ngraph::ParameterVector{ query, key, value, mask });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ScaledAttentionFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 12, 128, 64 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 12, 128, 64 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 12, 128, 64 });
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 128 });
+        auto attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(query, key, value, mask, 0.125f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ attention }, ngraph::ParameterVector{ query, key, value, mask });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledAttentionFusionTransposedKey) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 100, 32 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 32, 60 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 60, 16 });
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1 }, { 4.f });
+        auto scaled = std::make_shared<ngraph::opset1::Divide>(qk, scale);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(scaled, 2);
+        auto attention = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ attention }, ngraph::ParameterVector{ query, key, value });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ScaledAttentionFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 100, 32 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 32, 60 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 60, 16 });
+        auto attention = std::make_shared<MKLDNNPlugin::ScaledAttentionNode>(query, key, value, 0.25f, true);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ attention }, ngraph::ParameterVector{ query, key, value });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ScaledAttentionFusionNotLastAxis) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto query = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 60, 32 });
+        auto key = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 60, 32 });
+        auto value = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 60, 16 });
+        auto qk = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(qk, 1);
+        auto attention = std::make_shared<ngraph::opset1::MatMul>(softmax, value);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ attention }, ngraph::ParameterVector{ query, key, value });
+        f_ref = ngraph::clone_function(*f);
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ScaledAttentionFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_system_conf.h>
+
+#include "mkldnn_weights_cache.hpp"
+#include "utils/numa_memory.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const size_t numaTestPageSize = 4096;
+
+bool isMultiNumaSystem() {
+    return InferenceEngine::getAvailableNUMANodes().size() > 1;
+}
+
+// the region covers whole pages whatever the alignment of the allocation is
+std::vector<uint8_t> makeNumaTestBuffer() {
+    return std::vector<uint8_t>(4 * numaTestPageSize, 7);
+}
+
+}  // namespace
+
+TEST(NumaMemoryTests, nodeForBindingIsDisabledByConfig) {
+    for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes())
+        ASSERT_EQ(-1, numaNodeForBinding(numaNodeId, false));
+    ASSERT_EQ(-1, numaNodeForBinding(0, false));
+}
+
+TEST(NumaMemoryTests, nodeForBindingOfAvailableNodes) {
+    ASSERT_EQ(-1, numaNodeForBinding(-1, true));
+    for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes()) {
+        const int expected = isMultiNumaSystem() && numaNodeId >= 0 ? numaNodeId : -1;
+        ASSERT_EQ(expected, numaNodeForBinding(numaNodeId, true)) << "node " << numaNodeId;
+    }
+}
+
+TEST(NumaMemoryTests, bindingOfInvalidRegionsFails) {
+    auto buffer = makeNumaTestBuffer();
+    ASSERT_FALSE(bindToNumaNode(nullptr, buffer.size(), 0));
+    ASSERT_FALSE(bindToNumaNode(buffer.data(), buffer.size(), -1));
+    // no page is completely covered by the region
+    ASSERT_FALSE(bindToNumaNode(buffer.data() + 1, numaTestPageSize - 2, 0));
+}
+
+TEST(NumaMemoryTests, bindingOnSingleNodeOrUnknownNodeFails) {
+    auto buffer = makeNumaTestBuffer();
+    if (!isMultiNumaSystem()) {
+        for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes())
+            ASSERT_FALSE(bindToNumaNode(buffer.data(), buffer.size(), numaNodeId));
+    }
+    ASSERT_FALSE(bindToNumaNode(buffer.data(), buffer.size(), 1 << 16));
+
+    // the failed binding leaves the memory usable
+    for (auto value : buffer)
+        ASSERT_EQ(7, value);
+}
+
+// the placement is not observable without the NUMA library, the bound memory is checked to keep its data only
+TEST(NumaMemoryTests, boundMemoryKeepsTheData) {
+    if (!isMultiNumaSystem())
+        GTEST_SKIP();
+
+    auto buffer = makeNumaTestBuffer();
+    for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes()) {
+        bindToNumaNode(buffer.data(), buffer.size(), numaNodeId);
+        for (auto value : buffer)
+            ASSERT_EQ(7, value) << "node " << numaNodeId;
+        std::memset(buffer.data(), 7, buffer.size());
+    }
+}
+
+TEST(NumaMemoryTests, weightsCacheFollowsTheBindingConfig) {
+    NumaNodesWeights weights;
+    for (auto numaNodeId : InferenceEngine::getAvailableNUMANodes()) {
+        ASSERT_EQ(-1, weights.get(numaNodeId, false)->getNumaNodeId()) << "node " << numaNodeId;
+        ASSERT_EQ(numaNodeForBinding(numaNodeId, true), weights.get(numaNodeId, true)->getNumaNodeId()) << "node " << numaNodeId;
+        ASSERT_EQ(weights[numaNodeId], weights.get(numaNodeId, true));
+        // the objects are shared by all the networks when there is nothing to bind
+        if (!isMultiNumaSystem())
+            ASSERT_EQ(weights.get(numaNodeId, true), weights.get(numaNodeId, false));
+    }
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "utils/perf_events.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(HwCountersTests, Arithmetic) {
+    HwCounters a;
+    a.cycles = 100;
+    a.instructions = 250;
+    a.llcMisses = 10;
+
+    HwCounters total;
+    total += a;
+    total += a;
+    ASSERT_EQ(total.cycles, 200u);
+    ASSERT_EQ(total.instructions, 500u);
+    ASSERT_EQ(total.llcMisses, 20u);
+
+    const auto diff = total - a;
+    ASSERT_EQ(diff.cycles, 100u);
+    ASSERT_EQ(diff.instructions, 250u);
+    ASSERT_EQ(diff.llcMisses, 10u);
+
+    const auto avg = total / 2;
+    ASSERT_EQ(avg.cycles, 100u);
+    ASSERT_EQ(avg.instructions, 250u);
+    ASSERT_EQ(avg.llcMisses, 10u);
+}
+
+TEST(HwProfilerTests, NoCountersReadZeros) {
+    HwProfiler profiler(false, "");
+    ASSERT_FALSE(profiler.countsEvents());
+    ASSERT_NO_THROW(profiler.startInfer());
+    const auto counters = profiler.readCounters();
+    ASSERT_EQ(counters.cycles, 0u);
+    ASSERT_EQ(counters.instructions, 0u);
+    ASSERT_EQ(counters.llcMisses, 0u);
+    ASSERT_NO_THROW(profiler.finishInfer());
+}
+
+TEST(HwProfilerTests, TraceFormat) {
+    const std::string path = "cpu_perf_trace_test.json";
+    const std::string name = "conv\"1";
+    const std::string type = "Convolution";
+    {
+        HwProfiler profiler(false, path);
+        for (int i = 0; i < 2; i++) {
+            profiler.startInfer();
+            profiler.addTraceEvent(name, type, 10, 5, HwCounters{});
+            profiler.finishInfer();
+        }
+    }
+
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    file.close();
+    std::remove(path.c_str());
+
+    const auto trace = content.str();
+    ASSERT_EQ(trace.find("[\n"), 0);
+    ASSERT_NE(trace.find("\"name\":\"conv\\\"1\",\"cat\":\"Convolution\",\"ph\":\"X\",\"ts\":10,\"dur\":5"),
+              std::string::npos);
+    ASSERT_NE(trace.find("\"args\":{\"infer\":0}"), std::string::npos);
+    ASSERT_NE(trace.find("\"args\":{\"infer\":1}"), std::string::npos);
+    ASSERT_EQ(trace.find("cycles"), std::string::npos);
+}
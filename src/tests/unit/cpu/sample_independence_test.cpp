@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "utils/sample_independence.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const size_t independenceSize = 8;
+
+std::shared_ptr<ov::opset8::Parameter> makeBatchParameter(size_t rank = 2) {
+    ov::PartialShape shape(std::vector<ov::Dimension>(rank, independenceSize));
+    shape[0] = ov::Dimension::dynamic();
+    return std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+}
+
+std::shared_ptr<ov::Model> makeIndependenceModel(const std::shared_ptr<ov::Node>& output,
+                                                 const ov::ParameterVector& parameters) {
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(output)}, parameters);
+}
+
+std::shared_ptr<ov::Node> makeIndependenceAxes(std::vector<int64_t> axes) {
+    return ov::opset8::Constant::create(ov::element::i64, ov::Shape{axes.size()}, axes);
+}
+
+}  // namespace
+
+TEST(SampleIndependenceTests, elementwiseAndMatMulAreIndependent) {
+    auto input = makeBatchParameter();
+    auto weights = ov::opset8::Constant::create(ov::element::f32,
+                                                ov::Shape{independenceSize, independenceSize},
+                                                std::vector<float>(independenceSize * independenceSize, 1.f));
+    auto matMul = std::make_shared<ov::opset8::MatMul>(input, weights);
+    auto relu = std::make_shared<ov::opset8::Relu>(matMul);
+    auto softmax = std::make_shared<ov::opset8::Softmax>(relu, 1);
+    ASSERT_TRUE(areSamplesIndependent(makeIndependenceModel(softmax, {input})));
+}
+
+TEST(SampleIndependenceTests, shapesOfTheBatchAreNotSamples) {
+    auto input = makeBatchParameter();
+    auto shape = std::make_shared<ov::opset8::ShapeOf>(input);
+    auto reshaped = std::make_shared<ov::opset8::Reshape>(std::make_shared<ov::opset8::Relu>(input), shape, false);
+    ASSERT_TRUE(areSamplesIndependent(makeIndependenceModel(reshaped, {input})));
+}
+
+TEST(SampleIndependenceTests, operationsAlongTheBatchAxisAreRejected) {
+    {
+        auto input = makeBatchParameter();
+        auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{input, input}, 0);
+        ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(concat, {input})));
+    }
+    {
+        auto input = makeBatchParameter();
+        auto softmax = std::make_shared<ov::opset8::Softmax>(input, -2);
+        ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(softmax, {input})));
+    }
+    {
+        auto input = makeBatchParameter();
+        auto reduce = std::make_shared<ov::opset8::ReduceSum>(input, makeIndependenceAxes({0}), false);
+        ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(reduce, {input})));
+    }
+    {
+        auto input = makeBatchParameter();
+        auto gather = std::make_shared<ov::opset8::Gather>(input, makeIndependenceAxes({1, 0}), makeIndependenceAxes({0}));
+        ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(gather, {input})));
+    }
+    {
+        auto input = makeBatchParameter(3);
+        auto transpose = std::make_shared<ov::opset8::Transpose>(input, makeIndependenceAxes({1, 0, 2}));
+        ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(transpose, {input})));
+    }
+    {
+        // the samples of both inputs are multiplied with each other
+        auto first = makeBatchParameter();
+        auto second = makeBatchParameter();
+        auto matMul = std::make_shared<ov::opset8::MatMul>(first, second, false, true);
+        ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(matMul, {first, second})));
+    }
+}
+
+TEST(SampleIndependenceTests, operationsAlongTheOtherAxesAreIndependent) {
+    auto input = makeBatchParameter(3);
+    auto reduce = std::make_shared<ov::opset8::ReduceMean>(input, makeIndependenceAxes({-1}), true);
+    auto transpose = std::make_shared<ov::opset8::Transpose>(reduce, makeIndependenceAxes({0, 2, 1}));
+    auto concat = std::make_shared<ov::opset8::Concat>(ov::OutputVector{transpose, transpose}, 1);
+    ASSERT_TRUE(areSamplesIndependent(makeIndependenceModel(concat, {input})));
+}
+
+TEST(SampleIndependenceTests, outputsLosingTheBatchAreRejected) {
+    auto input = makeBatchParameter();
+    // the batch becomes a static dimension
+    auto reduce = std::make_shared<ov::opset8::ReduceMax>(input, makeIndependenceAxes({0}), true);
+    ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(reduce, {input})));
+
+    auto other = makeBatchParameter();
+    auto reshaped = std::make_shared<ov::opset8::Reshape>(other,
+                                                          makeIndependenceAxes({2, -1}),
+                                                          false);
+    ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(reshaped, {other})));
+}
+
+TEST(SampleIndependenceTests, rollAlongTheBatchAxisIsRejected) {
+    {
+        auto input = makeBatchParameter();
+        auto roll = std::make_shared<ov::opset8::Roll>(input, makeIndependenceAxes({1}), makeIndependenceAxes({0}));
+        ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(roll, {input})));
+    }
+    {
+        auto input = makeBatchParameter();
+        auto roll = std::make_shared<ov::opset8::Roll>(input, makeIndependenceAxes({1}), makeIndependenceAxes({1}));
+        ASSERT_TRUE(areSamplesIndependent(makeIndependenceModel(roll, {input})));
+    }
+}
+
+TEST(SampleIndependenceTests, unknownOperationsAreRejected) {
+    // the operation keeps the batch as the first dimension, but it is not known to compute the samples independently
+    auto input = makeBatchParameter();
+    auto tile = std::make_shared<ov::opset8::Tile>(input, makeIndependenceAxes({1, 2}));
+    ASSERT_FALSE(areSamplesIndependent(makeIndependenceModel(tile, {input})));
+}
@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "nodes/common/attention_kernels.hpp"
+
+using InferenceEngine::Extensions::Cpu::XARCH::scaled_attention_rows;
+
+namespace {
+
+std::vector<float> randomData(size_t size, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> data(size);
+    for (auto& value : data)
+        value = distribution(generator);
+    return data;
+}
+
+// materializes the whole scores matrix like the unfused MatMul -> Multiply -> Add -> Softmax -> MatMul chain
+std::vector<float> referenceAttention(const std::vector<float>& query, const std::vector<float>& key, const std::vector<float>& value,
+                                      const float* mask, size_t maskRowStride, size_t maskColStride,
+                                      size_t rows, size_t seqLen, size_t headSize, size_t valueSize, float scale) {
+    std::vector<float> scores(rows * seqLen);
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < seqLen; j++) {
+            float sum = 0.f;
+            for (size_t d = 0; d < headSize; d++)
+                sum += query[i * headSize + d] * key[j * headSize + d];
+            scores[i * seqLen + j] = sum * scale + (mask ? mask[i * maskRowStride + j * maskColStride] : 0.f);
+        }
+        const float max = *std::max_element(scores.begin() + i * seqLen, scores.begin() + (i + 1) * seqLen);
+        float sum = 0.f;
+        for (size_t j = 0; j < seqLen; j++) {
+            scores[i * seqLen + j] = std::exp(scores[i * seqLen + j] - max);
+            sum += scores[i * seqLen + j];
+        }
+        for (size_t j = 0; j < seqLen; j++)
+            scores[i * seqLen + j] /= sum;
+    }
+
+    std::vector<float> output(rows * valueSize, 0.f);
+    for (size_t i = 0; i < rows; i++) {
+        for (size_t j = 0; j < seqLen; j++) {
+            for (size_t d = 0; d < valueSize; d++)
+                output[i * valueSize + d] += scores[i * seqLen + j] * value[j * valueSize + d];
+        }
+    }
+    return output;
+}
+
+struct AttentionShape {
+    size_t rows;
+    size_t seqLen;
+    size_t headSize;
+    size_t valueSize;
+};
+
+}  // namespace
+
+class ScaledAttentionKernelTests : public ::testing::TestWithParam<AttentionShape> {};
+
+TEST_P(ScaledAttentionKernelTests, MatchesReference) {
+    const auto shape = GetParam();
+    const float scale = 1.f / std::sqrt(static_cast<float>(shape.headSize));
+    const auto query = randomData(shape.rows * shape.headSize, 1);
+    const auto key = randomData(shape.seqLen * shape.headSize, 2);
+    const auto value = randomData(shape.seqLen * shape.valueSize, 3);
+    // the causal mask also masks out whole blocks of the keys for the first rows
+    std::vector<float> mask(shape.rows * shape.seqLen);
+    for (size_t i = 0; i < shape.rows; i++) {
+        for (size_t j = 0; j < shape.seqLen; j++)
+            mask[i * shape.seqLen + j] = j > i ? -std::numeric_limits<float>::infinity() : 0.f;
+    }
+    const auto paddingMask = randomData(shape.seqLen, 4);
+
+    std::vector<float> output(shape.rows * shape.valueSize);
+    std::vector<float> scratch(2 * shape.rows + shape.seqLen);
+
+    struct MaskCase {
+        const float* data;
+        size_t rowStride;
+        size_t colStride;
+    };
+    for (const auto& maskCase : {MaskCase{nullptr, 0, 0}, MaskCase{mask.data(), shape.seqLen, 1}, MaskCase{paddingMask.data(), 0, 1}}) {
+        scaled_attention_rows(query.data(), shape.rows, key.data(), value.data(), maskCase.data, maskCase.rowStride, maskCase.colStride,
+                              shape.seqLen, shape.headSize, shape.valueSize, scale, output.data(), scratch.data());
+        const auto expected = referenceAttention(query, key, value, maskCase.data, maskCase.rowStride, maskCase.colStride,
+                                                 shape.rows, shape.seqLen, shape.headSize, shape.valueSize, scale);
+        for (size_t i = 0; i < output.size(); i++)
+            ASSERT_NEAR(output[i], expected[i], 1e-5f) << "index " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledAttention, ScaledAttentionKernelTests,
+                         ::testing::Values(AttentionShape{1, 1, 8, 8},
+                                           AttentionShape{4, 7, 3, 5},
+                                           AttentionShape{32, 64, 64, 64},
+                                           AttentionShape{17, 130, 80, 40},
+                                           AttentionShape{32, 200, 128, 128}));
+
+// Fused kernel against the materialized scores, run it with --gtest_also_run_disabled_tests
+TEST(ScaledAttentionKernelTests, DISABLED_benchmark) {
+    auto measure_ms = [](const std::function<void()>& function) {
+        function();
+        const auto start = std::chrono::steady_clock::now();
+        const int iterations = 5;
+        for (int i = 0; i < iterations; i++)
+            function();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+    };
+
+    const size_t queryBlock = 32;
+    for (size_t headSize : {32, 64, 128}) {
+        for (size_t seqLen : {128, 256, 512, 1024, 2048}) {
+            const auto query = randomData(seqLen * headSize, 1);
+            const auto key = randomData(seqLen * headSize, 2);
+            const auto value = randomData(seqLen * headSize, 3);
+            const float scale = 1.f / std::sqrt(static_cast<float>(headSize));
+            std::vector<float> output(seqLen * headSize);
+            std::vector<float> scratch(2 * queryBlock + seqLen);
+
+            const double fused = measure_ms([&] {
+                for (size_t row = 0; row < seqLen; row += queryBlock) {
+                    scaled_attention_rows(query.data() + row * headSize, std::min(queryBlock, seqLen - row), key.data(), value.data(),
+                                          nullptr, 0, 0, seqLen, headSize, headSize, scale, output.data() + row * headSize, scratch.data());
+                }
+            });
+            const double materialized = measure_ms([&] {
+                referenceAttention(query, key, value, nullptr, 0, 0, seqLen, seqLen, headSize, headSize, scale);
+            });
+            std::cout << "seq " << seqLen << " head " << headSize << ": fused " << fused << " ms, materialized scores "
+                      << materialized << " ms" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,210 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_common.h>
+
+#include "nodes/common/state_buffer.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::vector<float> iota(size_t size, float start) {
+    std::vector<float> data(size);
+    std::iota(data.begin(), data.end(), start);
+    return data;
+}
+
+std::vector<float> read(const StateBuffer& buffer) {
+    const auto& dims = buffer.getDims();
+    std::vector<float> data(std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>()));
+    buffer.read(data.data());
+    return data;
+}
+
+// Gather of the dense [beams, length, inner] tensor along the beams
+std::vector<float> gatherBeams(const std::vector<float>& data, size_t beams, const std::vector<int32_t>& indices) {
+    const size_t row = data.size() / beams;
+    std::vector<float> gathered(indices.size() * row, 0.f);
+    for (size_t b = 0; b < indices.size(); b++) {
+        if (indices[b] >= 0 && static_cast<size_t>(indices[b]) < beams)
+            std::copy_n(data.begin() + indices[b] * row, row, gathered.begin() + b * row);
+    }
+    return gathered;
+}
+
+// appends the slice of the dense [beams, length, inner] tensor along the length
+std::vector<float> appendTokens(const std::vector<float>& data, const std::vector<float>& slice, size_t beams) {
+    const size_t row = data.size() / beams;
+    const size_t sliceRow = slice.size() / beams;
+    std::vector<float> appended;
+    for (size_t b = 0; b < beams; b++) {
+        appended.insert(appended.end(), data.begin() + b * row, data.begin() + (b + 1) * row);
+        appended.insert(appended.end(), slice.begin() + b * sliceRow, slice.begin() + (b + 1) * sliceRow);
+    }
+    return appended;
+}
+
+}  // namespace
+
+TEST(StateBufferTests, AppendAlongInnerAxis) {
+    // [batch, heads, tokens, head size] keys of a decoder
+    StateBuffer buffer(sizeof(float), 2);
+    buffer.reset({2, 3, 0, 4});
+
+    std::vector<float> expected(2 * 3 * 0 * 4);
+    size_t length = 0;
+    for (size_t step = 0; step < 10; step++) {
+        const size_t tokens = step == 0 ? 5 : 1;
+        const auto slice = iota(2 * 3 * tokens * 4, 100.f * step);
+        buffer.append(slice.data(), {2, 3, tokens, 4});
+
+        std::vector<float> concatenated(2 * 3 * (length + tokens) * 4);
+        for (size_t o = 0; o < 2 * 3; o++) {
+            std::copy_n(expected.begin() + o * length * 4, length * 4, concatenated.begin() + o * (length + tokens) * 4);
+            std::copy_n(slice.begin() + o * tokens * 4, tokens * 4, concatenated.begin() + (o * (length + tokens) + length) * 4);
+        }
+        expected = concatenated;
+        length += tokens;
+
+        ASSERT_EQ(buffer.getDims(), (VectorDims{2, 3, length, 4}));
+        ASSERT_GE(buffer.capacity(), length);
+        ASSERT_EQ(read(buffer), expected);
+    }
+}
+
+TEST(StateBufferTests, CapacityGrowsGeometrically) {
+    StateBuffer buffer(sizeof(float), 0);
+    buffer.reset({0, 8});
+
+    size_t reallocations = 0;
+    size_t capacity = buffer.capacity();
+    const auto slice = iota(8, 0.f);
+    for (size_t step = 0; step < 1000; step++) {
+        buffer.append(slice.data(), {1, 8});
+        if (buffer.capacity() != capacity) {
+            reallocations++;
+            capacity = buffer.capacity();
+        }
+    }
+    ASSERT_EQ(buffer.getDims(), (VectorDims{1000, 8}));
+    ASSERT_LE(reallocations, 11);
+}
+
+TEST(StateBufferTests, TrimKeepsPrefix) {
+    StateBuffer buffer(sizeof(float), 1);
+    const auto data = iota(2 * 6 * 3, 0.f);
+    buffer.assign(data.data(), {2, 6, 3});
+    buffer.trim(2);
+    ASSERT_EQ(buffer.getDims(), (VectorDims{2, 2, 3}));
+    ASSERT_EQ(read(buffer), (std::vector<float>{0, 1, 2, 3, 4, 5, 18, 19, 20, 21, 22, 23}));
+
+    // the trimmed tail is overwritten by the next append
+    const auto slice = iota(2 * 1 * 3, -6.f);
+    buffer.append(slice.data(), {2, 1, 3});
+    ASSERT_EQ(read(buffer), (std::vector<float>{0, 1, 2, 3, 4, 5, -6, -5, -4, 18, 19, 20, 21, 22, 23, -3, -2, -1}));
+
+    ASSERT_THROW(buffer.trim(4), InferenceEngine::Exception);
+}
+
+TEST(StateBufferTests, EmptyStateTakesSliceDims) {
+    StateBuffer buffer(sizeof(float), 1);
+    buffer.reset({0, 0, 4});
+    const auto slice = iota(3 * 2 * 4, 0.f);
+    buffer.append(slice.data(), {3, 2, 4});
+    ASSERT_EQ(buffer.getDims(), (VectorDims{3, 2, 4}));
+    ASSERT_EQ(read(buffer), slice);
+
+    ASSERT_THROW(buffer.append(slice.data(), {2, 3, 4}), InferenceEngine::Exception);
+}
+
+TEST(StateBufferTests, AssignAndReset) {
+    StateBuffer buffer(sizeof(float), 0);
+    const auto data = iota(12, 1.f);
+    buffer.assign(data.data(), {3, 4});
+    ASSERT_EQ(read(buffer), data);
+
+    buffer.assign(data.data(), {2, 6});
+    ASSERT_EQ(buffer.getDims(), (VectorDims{2, 6}));
+    ASSERT_EQ(read(buffer), data);
+
+    buffer.reset({3, 4});
+    ASSERT_EQ(read(buffer), std::vector<float>(12, 0.f));
+}
+
+TEST(StateBufferTests, ReorderBeamsFollowsTable) {
+    // [beams, tokens, head size] with the beams reordered before each new token
+    const size_t beams = 4;
+    StateBuffer buffer(sizeof(float), 1);
+    auto expected = iota(beams * 16 * 2, 0.f);
+    buffer.assign(expected.data(), {beams, 16, 2});
+
+    const std::vector<std::vector<int32_t>> orders = {{0, 0, 1, 1}, {3, 2, 1, 0}, {1, 1, 1, 1}, {2, 0, 3, 1}};
+    for (size_t step = 0; step < orders.size(); step++) {
+        buffer.reorderBeams(0, orders[step].data(), beams);
+        expected = gatherBeams(expected, beams, orders[step]);
+        if (step == 0)
+            ASSERT_TRUE(buffer.hasBeamTable());
+        ASSERT_EQ(read(buffer), expected);
+
+        const auto slice = iota(beams * 1 * 2, 1000.f * (step + 1));
+        buffer.append(slice.data(), {beams, 1, 2});
+        expected = appendTokens(expected, slice, beams);
+        ASSERT_EQ(read(buffer), expected);
+    }
+
+    // the table keeps up with the trimmed state
+    buffer.trim(10);
+    std::vector<float> trimmed;
+    for (size_t b = 0; b < beams; b++)
+        trimmed.insert(trimmed.end(), expected.begin() + b * 20 * 2, expected.begin() + (b * 20 + 10) * 2);
+    ASSERT_EQ(read(buffer), trimmed);
+}
+
+TEST(StateBufferTests, ReorderBeamsCompactsFragmentedTable) {
+    const size_t beams = 2;
+    StateBuffer buffer(sizeof(float), 1);
+    auto expected = iota(beams * 1 * 3, 0.f);
+    buffer.assign(expected.data(), {beams, 1, 3});
+
+    // swapping the beams after every token makes every run a single token long
+    const std::vector<int32_t> swap = {1, 0};
+    bool compacted = false;
+    for (size_t step = 0; step < 16; step++) {
+        const auto slice = iota(beams * 1 * 3, 100.f * (step + 1));
+        buffer.append(slice.data(), {beams, 1, 3});
+        expected = appendTokens(expected, slice, beams);
+
+        buffer.reorderBeams(0, swap.data(), swap.size());
+        expected = gatherBeams(expected, beams, swap);
+        compacted |= !buffer.hasBeamTable();
+        ASSERT_EQ(read(buffer), expected);
+    }
+    ASSERT_TRUE(compacted);
+}
+
+TEST(StateBufferTests, ReorderBeamsChangesBeamCount) {
+    // [batch, beams, tokens, head size], the first step expands the single beam
+    StateBuffer buffer(sizeof(float), 2);
+    auto expected = iota(1 * 1 * 5 * 2, 0.f);
+    buffer.assign(expected.data(), {1, 1, 5, 2});
+
+    const std::vector<int32_t> expand = {0, 0, 0};
+    buffer.reorderBeams(1, expand.data(), expand.size());
+    expected = gatherBeams(expected, 1, expand);
+    ASSERT_EQ(buffer.getDims(), (VectorDims{1, 3, 5, 2}));
+    ASSERT_EQ(read(buffer), expected);
+
+    // an index out of the beams gives zeros
+    const std::vector<int32_t> order = {2, 5, -1};
+    buffer.reorderBeams(1, order.data(), order.size());
+    expected = gatherBeams(expected, 3, order);
+    ASSERT_EQ(read(buffer), expected);
+
+    ASSERT_THROW(buffer.reorderBeams(2, order.data(), order.size()), InferenceEngine::Exception);
+}
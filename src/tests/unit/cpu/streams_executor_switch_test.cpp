@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "streams_executor_switch.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// runs the tasks on the caller thread, the submitted ones when asked, and counts the stream ids queried
+// by the threads not running its tasks, as such a query makes a real streams executor create a new stream
+class SwitchTargetExecutor : public IStreamsExecutor {
+public:
+    explicit SwitchTargetExecutor(int streamId) : streamId(streamId) {}
+
+    void run(Task task) override {
+        submitted.push_back(std::move(task));
+    }
+
+    void Execute(Task task) override {
+        running = true;
+        task();
+        running = false;
+    }
+
+    void runSubmitted() {
+        auto tasks = std::move(submitted);
+        submitted.clear();
+        for (auto& task : tasks)
+            Execute(std::move(task));
+    }
+
+    int GetStreamId() override {
+        if (!running)
+            foreignQueries++;
+        return streamId;
+    }
+
+    int GetNumaNodeId() override {
+        return streamId * 10;
+    }
+
+    const int streamId;
+    bool running = false;
+    int foreignQueries = 0;
+    std::vector<Task> submitted;
+};
+
+}  // namespace
+
+// the request created before the reconfiguration keeps the switch as its executor, as the synchronous pipeline
+// does, and takes the stream of the executor running its inference, which selects the graph replica
+TEST(StreamsExecutorSwitchTests, RequestCreatedBeforeReconfigurationRunsOnNewStreams) {
+    auto oldExecutor = std::make_shared<SwitchTargetExecutor>(1);
+    auto newExecutor = std::make_shared<SwitchTargetExecutor>(2);
+    auto executorSwitch = std::make_shared<StreamsExecutorSwitch>(oldExecutor);
+    IStreamsExecutor::Ptr requestExecutor = executorSwitch;
+
+    int streamId = -1;
+    int numaNodeId = -1;
+    auto inference = [&] {
+        streamId = executorSwitch->GetStreamId();
+        numaNodeId = executorSwitch->GetNumaNodeId();
+    };
+    requestExecutor->Execute(inference);
+    ASSERT_EQ(1, streamId);
+    ASSERT_EQ(10, numaNodeId);
+
+    executorSwitch->setTarget(newExecutor);
+    requestExecutor->Execute(inference);
+    ASSERT_EQ(2, streamId);
+    ASSERT_EQ(20, numaNodeId);
+
+    requestExecutor->run(inference);
+    ASSERT_TRUE(oldExecutor->submitted.empty());
+    ASSERT_EQ(1u, newExecutor->submitted.size());
+    streamId = -1;
+    newExecutor->runSubmitted();
+    ASSERT_EQ(2, streamId);
+
+    ASSERT_EQ(0, oldExecutor->foreignQueries);
+    ASSERT_EQ(0, newExecutor->foreignQueries);
+}
+
+TEST(StreamsExecutorSwitchTests, TaskSubmittedBeforeSwitchKeepsItsExecutor) {
+    auto oldExecutor = std::make_shared<SwitchTargetExecutor>(1);
+    auto newExecutor = std::make_shared<SwitchTargetExecutor>(2);
+    auto executorSwitch = std::make_shared<StreamsExecutorSwitch>(oldExecutor);
+
+    int streamId = -1;
+    executorSwitch->run([&] {
+        streamId = executorSwitch->GetStreamId();
+    });
+    executorSwitch->setTarget(newExecutor);
+    oldExecutor->runSubmitted();
+    ASSERT_EQ(1, streamId);
+    ASSERT_EQ(0, newExecutor->foreignQueries);
+
+    // the callers outside of the tasks get the stream of the current target
+    ASSERT_EQ(2, executorSwitch->GetStreamId());
+}
+
+TEST(StreamsExecutorSwitchTests, NestedSwitchesReportTheirOwnExecutors) {
+    auto outerExecutor = std::make_shared<SwitchTargetExecutor>(1);
+    auto innerExecutor = std::make_shared<SwitchTargetExecutor>(2);
+    auto outerSwitch = std::make_shared<StreamsExecutorSwitch>(outerExecutor);
+    auto innerSwitch = std::make_shared<StreamsExecutorSwitch>(innerExecutor);
+
+    std::vector<int> streamIds;
+    // the inference of a network run from the task of another one
+    outerSwitch->Execute([&] {
+        innerSwitch->Execute([&] {
+            streamIds.push_back(innerSwitch->GetStreamId());
+        });
+        streamIds.push_back(outerSwitch->GetStreamId());
+    });
+    ASSERT_EQ((std::vector<int>{2, 1}), streamIds);
+    ASSERT_EQ(0, outerExecutor->foreignQueries);
+    ASSERT_EQ(0, innerExecutor->foreignQueries);
+}
@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include "cache/tuning_cache.h"
+#include "graph_test_utils.hpp"
+#include "mkldnn/iml_type_mapper.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// a 1x1 Convolution, which usually has several implementations of the same layouts
+std::shared_ptr<ngraph::Function> makeTunedConvolution() {
+    const size_t channels = 32;
+    auto parameter = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels, 14, 14});
+    parameter->set_friendly_name("input");
+    auto weights = ngraph::opset8::Constant::create(ngraph::element::f32,
+                                                    ngraph::Shape{channels, channels, 1, 1},
+                                                    std::vector<float>(channels * channels, 0.01f));
+    auto convolution = std::make_shared<ngraph::opset8::Convolution>(parameter,
+                                                                     weights,
+                                                                     ngraph::Strides{1, 1},
+                                                                     ngraph::CoordinateDiff{0, 0},
+                                                                     ngraph::CoordinateDiff{0, 0},
+                                                                     ngraph::Strides{1, 1});
+    convolution->set_friendly_name("convolution");
+    auto result = std::make_shared<ngraph::opset8::Result>(convolution);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{parameter});
+}
+
+std::string getTunedImplementation(MKLDNNGraph& graph) {
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() == Convolution)
+            return impl_type_to_string(node->getSelectedPrimitiveDescriptor()->getImplementationType());
+    }
+    return {};
+}
+
+std::vector<std::pair<std::string, std::string>> readTuningRecords(const std::string& path) {
+    std::vector<std::pair<std::string, std::string>> records;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        const auto pos = line.find('\t');
+        if (pos != std::string::npos)
+            records.emplace_back(line.substr(0, pos), line.substr(pos + 1));
+    }
+    return records;
+}
+
+// the key lists the signatures "implementation:ports" of all the candidates compared
+std::vector<std::string> getKeyCandidates(const std::string& key) {
+    std::vector<std::string> candidates;
+    std::stringstream stream(key);
+    std::string field;
+    while (std::getline(stream, field, ';')) {
+        if (field.find(':') != std::string::npos)
+            candidates.push_back(field);
+    }
+    return candidates;
+}
+
+}  // namespace
+
+TEST(TuningCacheTests, InMemory) {
+    TuningCache cache("");
+    std::string value;
+    ASSERT_FALSE(cache.find("conv", value));
+    cache.put("conv", "jit_avx512");
+    ASSERT_TRUE(cache.find("conv", value));
+    ASSERT_EQ(value, "jit_avx512");
+}
+
+TEST(TuningCacheTests, Persistence) {
+    const std::string path = "cpu_tuning_cache_test.txt";
+    std::remove(path.c_str());
+    {
+        TuningCache cache(path);
+        cache.put("conv", "jit_avx512");
+        cache.put("fc", "brgemm_avx512");
+        cache.put("conv", "gemm_avx512");
+    }
+
+    TuningCache cache(path);
+    std::string value;
+    ASSERT_TRUE(cache.find("conv", value));
+    ASSERT_EQ(value, "gemm_avx512");
+    ASSERT_TRUE(cache.find("fc", value));
+    ASSERT_EQ(value, "brgemm_avx512");
+    std::remove(path.c_str());
+}
+
+TEST(TuningCacheTests, SharedInstance) {
+    auto first = TuningCache::get("cpu_tuning_cache_shared.txt");
+    auto second = TuningCache::get("cpu_tuning_cache_shared.txt");
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, TuningCache::get(""));
+}
+
+TEST(TuningCacheTests, TunedSelectionIsAppliedAndReloaded) {
+    const std::string path = "cpu_tuning_cache_graph_test.txt";
+    std::remove(path.c_str());
+
+    Config config;
+    config.primitiveTuning = true;
+    config.tuningCacheFile = path;
+
+    std::string tuned;
+    {
+        MKLDNNGraph graph;
+        CPUUnitTestUtils::createGraph(graph, makeTunedConvolution(), config);
+        tuned = getTunedImplementation(graph);
+    }
+
+    const auto records = readTuningRecords(path);
+    if (records.empty()) {
+        std::remove(path.c_str());
+        GTEST_SKIP() << "The Convolution has a single implementation of the selected layouts on this CPU";
+    }
+    ASSERT_EQ(1u, records.size());
+    // the measured selection is applied
+    const auto& value = records.front().second;
+    ASSERT_EQ(tuned, value.substr(0, value.find(':')));
+
+    // the later record wins, so another candidate is selected by the graphs reloading the file
+    std::string other;
+    for (const auto& candidate : getKeyCandidates(records.front().first)) {
+        if (candidate != value)
+            other = candidate;
+    }
+    ASSERT_FALSE(other.empty());
+    {
+        std::ofstream file(path, std::ios::out | std::ios::app);
+        file << records.front().first << '\t' << other << '\n';
+    }
+
+    MKLDNNGraph graph;
+    CPUUnitTestUtils::createGraph(graph, makeTunedConvolution(), config);
+    ASSERT_EQ(other.substr(0, other.find(':')), getTunedImplementation(graph));
+    // the selection was found in the cache, nothing was measured and recorded
+    ASSERT_EQ(2u, readTuningRecords(path).size());
+    std::remove(path.c_str());
+}
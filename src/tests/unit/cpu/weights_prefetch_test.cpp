@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_blob.h>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include "mkldnn_graph.h"
+#include "mkldnn_extension_mngr.h"
+#include "utils/weights_prefetch.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<PrefetchRegion> makePrefetchRegions(const std::vector<uint8_t>& buffer) {
+    std::vector<PrefetchRegion> regions(1);
+    regions[0].data = buffer.data();
+    regions[0].size = buffer.size();
+    return regions;
+}
+
+// a chain of the 1x1 Convolutions, so the graph streams the weights of each node once per inference
+CNNNetwork makeWeightsStreamingNetwork(size_t channels, size_t layers) {
+    auto parameter = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels, 1, 1});
+    parameter->set_friendly_name("input");
+    std::shared_ptr<ngraph::Node> output = parameter;
+    for (size_t i = 0; i < layers; i++) {
+        std::vector<float> weights(channels * channels, 1.f / channels);
+        auto constant = ngraph::opset8::Constant::create(ngraph::element::f32, ngraph::Shape{channels, channels, 1, 1}, weights);
+        output = std::make_shared<ngraph::opset8::Convolution>(output,
+                                                               constant,
+                                                               ngraph::Strides{1, 1},
+                                                               ngraph::CoordinateDiff{0, 0},
+                                                               ngraph::CoordinateDiff{0, 0},
+                                                               ngraph::Strides{1, 1});
+    }
+    auto result = std::make_shared<ngraph::opset8::Result>(output);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{parameter}));
+}
+
+}  // namespace
+
+TEST(WeightsPrefetchTests, requestsAreReadUpToTheBudget) {
+    const std::vector<uint8_t> buffer(1 << 20, 1);
+    const auto regions = makePrefetchRegions(buffer);
+
+    WeightsPrefetcher prefetcher{10000};
+    prefetcher.prefetch(regions);
+    prefetcher.wait();
+    ASSERT_EQ(10000u, prefetcher.prefetchedBytes());
+
+    prefetcher.prefetch(regions);
+    prefetcher.wait();
+    ASSERT_EQ(20000u, prefetcher.prefetchedBytes());
+}
+
+TEST(WeightsPrefetchTests, regionsOfARequestShareTheBudget) {
+    const std::vector<uint8_t> first(6000, 1);
+    const std::vector<uint8_t> second(6000, 2);
+    auto regions = makePrefetchRegions(first);
+    regions.push_back(makePrefetchRegions(second).front());
+
+    WeightsPrefetcher prefetcher{10000};
+    prefetcher.prefetch(regions);
+    prefetcher.wait();
+    ASSERT_EQ(10000u, prefetcher.prefetchedBytes());
+}
+
+TEST(WeightsPrefetchTests, requestsMadeAfterCancelAreServed) {
+    const std::vector<uint8_t> cancelled(1 << 24, 1);
+    const std::vector<uint8_t> next(10000, 2);
+
+    WeightsPrefetcher prefetcher{cancelled.size()};
+    const auto cancelledRegions = makePrefetchRegions(cancelled);
+    prefetcher.prefetch(cancelledRegions);
+    prefetcher.cancel();
+    const auto cancelledBytes = prefetcher.prefetchedBytes();
+    ASSERT_LE(cancelledBytes, cancelled.size());
+
+    const auto regions = makePrefetchRegions(next);
+    prefetcher.prefetch(regions);
+    prefetcher.wait();
+    ASSERT_EQ(cancelledBytes + next.size(), prefetcher.prefetchedBytes());
+}
+
+TEST(WeightsPrefetchTests, graphsShareThePrefetcherOfTheirStream) {
+    const size_t channels = 128;
+    std::vector<float> input(channels, 1.f);
+    const TensorDesc desc{Precision::FP32, {1, channels, 1, 1}, Layout::NCHW};
+    Config config;
+    config.weightsPrefetch = true;
+    auto prefetcher = std::make_shared<WeightsPrefetcher>(WeightsPrefetcher::defaultBudget());
+
+    auto createGraph = [&](MKLDNNGraph& graph, bool shared) {
+        graph.setConfig(config);
+        if (shared)
+            graph.setWeightsPrefetcher(prefetcher);
+        auto network = makeWeightsStreamingNetwork(channels, 3);
+        MKLDNNWeightsSharing::Ptr weightsCache;
+        graph.CreateGraph(network, std::make_shared<MKLDNNExtensionManager>(), weightsCache);
+    };
+    auto infer = [&](MKLDNNGraph& graph) {
+        graph.PushInputData("input", make_shared_blob<float>(desc, input.data()));
+        graph.Infer();
+    };
+
+    // the graph without the prefetcher of a stream, as a micro-batch replica, does not prefetch
+    MKLDNNGraph replica;
+    createGraph(replica, false);
+    infer(replica);
+    prefetcher->wait();
+    ASSERT_EQ(0u, prefetcher->prefetchedBytes());
+
+    auto bucket = std::unique_ptr<MKLDNNGraph>(new MKLDNNGraph());
+    createGraph(*bucket, true);
+    infer(*bucket);
+    prefetcher->wait();
+    const auto bucketBytes = prefetcher->prefetchedBytes();
+    ASSERT_GT(bucketBytes, 0u);
+
+    // the graph released while the prefetcher may still read its weights for the next inference detaches from it
+    infer(*bucket);
+    bucket.reset();
+
+    MKLDNNGraph graph;
+    createGraph(graph, true);
+    const auto graphStartBytes = prefetcher->prefetchedBytes();
+    infer(graph);
+    prefetcher->wait();
+    ASSERT_GT(prefetcher->prefetchedBytes(), graphStartBytes);
+}
+
+// Memory bound inference with and without the prefetch, run it with --gtest_also_run_disabled_tests
+TEST(WeightsPrefetchTests, DISABLED_benchmark) {
+    const size_t channels = 2048;
+    const size_t layers = 16;
+    auto network = makeWeightsStreamingNetwork(channels, layers);
+    std::vector<float> input(channels, 1.f);
+    const TensorDesc desc{Precision::FP32, {1, channels, 1, 1}, Layout::NCHW};
+
+    for (bool prefetch : {false, true}) {
+        Config config;
+        config.weightsPrefetch = prefetch;
+        MKLDNNGraph graph;
+        graph.setConfig(config);
+        graph.setWeightsPrefetcher(std::make_shared<WeightsPrefetcher>(WeightsPrefetcher::defaultBudget()));
+        MKLDNNWeightsSharing::Ptr weightsCache;
+        graph.CreateGraph(network, std::make_shared<MKLDNNExtensionManager>(), weightsCache);
+
+        auto infer = [&] {
+            graph.PushInputData("input", make_shared_blob<float>(desc, input.data()));
+            graph.Infer();
+        };
+        infer();
+        const int iterations = 50;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            infer();
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << (prefetch ? "with prefetch: " : "without prefetch: ") << ms / iterations << " ms per inference of "
+                  << layers * channels * channels * sizeof(float) / (1 << 20) << " MB of weights" << std::endl;
+    }
+}
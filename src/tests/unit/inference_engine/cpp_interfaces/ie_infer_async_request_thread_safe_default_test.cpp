@@ -159,6 +159,52 @@ TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetCompletionCallb
     taskExecutor->executeAll();
 }
 
+// SetDeadline
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetDeadline) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetDeadline(std::chrono::steady_clock::now()), RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, setDeadlineIsForwardedToSyncRequest) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds{10};
+    EXPECT_CALL(*mockInferRequestInternal, SetDeadline(deadline)).Times(1);
+    ASSERT_NO_THROW(testRequest->SetDeadline(deadline));
+}
+
+// ReleaseBlobs
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnReleaseBlobs) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->ReleaseBlobs(), RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, releaseBlobsIsForwardedToSyncRequest) {
+    EXPECT_CALL(*mockInferRequestInternal, ReleaseBlobs()).Times(1);
+    ASSERT_NO_THROW(testRequest->ReleaseBlobs());
+}
+
+// SetInputReady
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetInputReady) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetInputReady("input"), RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, setInputReadyIsForwardedToSyncRequest) {
+    EXPECT_CALL(*mockInferRequestInternal, SetInputReady("input")).Times(1);
+    ASSERT_NO_THROW(testRequest->SetInputReady("input"));
+}
+
 TEST_F(InferRequestThreadSafeDefaultTests, callbackTakesOKIfAsyncRequestWasOK) {
     auto taskExecutor = std::make_shared<DeferedExecutor>();
     testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
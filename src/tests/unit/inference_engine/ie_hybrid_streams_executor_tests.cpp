@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_hybrid_streams_executor.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+// keeps the tasks until they are run explicitly, all of them in the stream 0
+class ManualStreamsExecutor : public IStreamsExecutor {
+public:
+    void run(Task task) override {
+        tasks.push_back(std::move(task));
+    }
+
+    void Execute(Task task) override {
+        task();
+    }
+
+    int GetStreamId() override {
+        return 0;
+    }
+
+    int GetNumaNodeId() override {
+        return 0;
+    }
+
+    void runAll() {
+        auto ready = std::move(tasks);
+        tasks.clear();
+        for (auto& task : ready)
+            task();
+    }
+
+    std::vector<Task> tasks;
+};
+
+IStreamsExecutor::Config throughputConfig(int streams, int threadsPerStream) {
+    IStreamsExecutor::Config config{"Test", streams, threadsPerStream, IStreamsExecutor::ThreadBindingType::HYBRID_AWARE};
+    config._threadPreferredCoreType = IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN;
+    return config;
+}
+
+}  // namespace
+
+TEST(HybridStreamsExecutorTests, latencyStreamsUseBigCoresOnly) {
+    HybridStreamsExecutor::Topology topology;
+    topology.bigCores = 8;
+    topology.bigLogicalCores = 16;
+    topology.littleCores = 8;
+
+    const auto pools = HybridStreamsExecutor::MakePools(throughputConfig(1, 16), true, topology);
+    ASSERT_EQ(1, pools.big._streams);
+    ASSERT_EQ(8, pools.big._threadsPerStream);
+    ASSERT_EQ(IStreamsExecutor::Config::PreferredCoreType::BIG, pools.big._threadPreferredCoreType);
+    ASSERT_EQ(0, pools.little._streams);
+}
+
+TEST(HybridStreamsExecutorTests, throughputStreamsOverflowToLittleCores) {
+    HybridStreamsExecutor::Topology topology;
+    topology.bigCores = 8;
+    topology.bigLogicalCores = 16;
+    topology.littleCores = 8;
+
+    const auto pools = HybridStreamsExecutor::MakePools(throughputConfig(4, 4), false, topology);
+    ASSERT_EQ(2, pools.big._streams);
+    ASSERT_EQ(4, pools.big._threadsPerStream);
+    ASSERT_EQ(2, pools.little._streams);
+    ASSERT_EQ(4, pools.little._threadsPerStream);
+    ASSERT_EQ(IStreamsExecutor::Config::PreferredCoreType::LITTLE, pools.little._threadPreferredCoreType);
+}
+
+TEST(HybridStreamsExecutorTests, nonHybridTopologyKeepsAllStreamsTogether) {
+    HybridStreamsExecutor::Topology topology;
+    topology.bigCores = 8;
+    topology.bigLogicalCores = 16;
+
+    const auto pools = HybridStreamsExecutor::MakePools(throughputConfig(4, 2), false, topology);
+    ASSERT_EQ(4, pools.big._streams);
+    ASSERT_EQ(2, pools.big._threadsPerStream);
+    ASSERT_EQ(0, pools.little._streams);
+}
+
+TEST(HybridStreamsExecutorTests, tasksSpillOverToLittleCoresWhenBigOnesAreBusy) {
+    auto big = std::make_shared<ManualStreamsExecutor>();
+    auto little = std::make_shared<ManualStreamsExecutor>();
+    HybridStreamsExecutor executor{big, 2, little, 1};
+
+    std::vector<int> streamIds;
+    for (int i = 0; i < 4; i++) {
+        executor.run([&] {
+            streamIds.push_back(executor.GetStreamId());
+        });
+    }
+    // the last task waits for the Big cores as the Little ones are busy too
+    ASSERT_EQ(3, big->tasks.size());
+    ASSERT_EQ(1, little->tasks.size());
+    ASSERT_EQ(3, executor.GetUtilization(IStreamsExecutor::Config::PreferredCoreType::BIG).running);
+
+    little->runAll();
+    big->runAll();
+    // the streams of the Little cores follow the ones of the Big cores
+    ASSERT_EQ((std::vector<int>{2, 0, 0, 0}), streamIds);
+
+    const auto bigUtilization = executor.GetUtilization(IStreamsExecutor::Config::PreferredCoreType::BIG);
+    const auto littleUtilization = executor.GetUtilization(IStreamsExecutor::Config::PreferredCoreType::LITTLE);
+    ASSERT_EQ(3, bigUtilization.tasks);
+    ASSERT_EQ(0, bigUtilization.running);
+    ASSERT_EQ(1, littleUtilization.tasks);
+    ASSERT_EQ(1, littleUtilization.streams);
+}
@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <thread>
+#include <threading/ie_priority_scheduler.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+// keeps the tasks until they are run explicitly, the overdue tasks are submitted by the timer thread of the scheduler
+class ManualExecutor : public ITaskExecutor {
+public:
+    void run(Task task) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+
+    void runAll() {
+        std::vector<Task> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready = std::move(tasks);
+            tasks.clear();
+        }
+        for (auto& task : ready)
+            task();
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return tasks.size();
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<Task> tasks;
+};
+
+}  // namespace
+
+TEST(PrioritySchedulerTests, higherPriorityDefersLowerOne) {
+    auto scheduler = std::make_shared<PriorityScheduler>();
+    auto lowExecutor = std::make_shared<ManualExecutor>();
+    auto highExecutor = std::make_shared<ManualExecutor>();
+    auto low = scheduler->makeExecutor("low", 0, std::chrono::milliseconds{0}, lowExecutor, 1);
+    auto high = scheduler->makeExecutor("high", 2, std::chrono::milliseconds{0}, highExecutor, 1);
+
+    std::vector<std::string> order;
+    high->run([&] { order.push_back("high"); });
+    low->run([&] { order.push_back("low"); });
+    ASSERT_EQ(1, highExecutor->size());
+    ASSERT_EQ(0, lowExecutor->size());
+
+    highExecutor->runAll();
+    ASSERT_EQ(1, lowExecutor->size());
+    lowExecutor->runAll();
+    ASSERT_EQ((std::vector<std::string>{"high", "low"}), order);
+
+    const auto statistics = scheduler->getStatistics();
+    ASSERT_EQ(1, statistics.at("low").submitted);
+    ASSERT_EQ(1, statistics.at("low").deferred);
+    ASSERT_EQ(0, statistics.at("high").deferred);
+    ASSERT_EQ(0, statistics.at("low").running);
+}
+
+TEST(PrioritySchedulerTests, concurrencyLimitsTasksInFlight) {
+    auto scheduler = std::make_shared<PriorityScheduler>();
+    auto executor = std::make_shared<ManualExecutor>();
+    auto scheduled = scheduler->makeExecutor("model", 1, std::chrono::milliseconds{0}, executor, 2);
+
+    for (int i = 0; i < 3; i++)
+        scheduled->run([] {});
+    ASSERT_EQ(2, executor->size());
+    ASSERT_EQ(1, scheduler->getStatistics(scheduled).queued);
+
+    executor->runAll();
+    ASSERT_EQ(1, executor->size());
+    ASSERT_EQ(0, scheduler->getStatistics(scheduled).queued);
+    ASSERT_EQ(1, scheduler->getStatistics(scheduled).running);
+}
+
+TEST(PrioritySchedulerTests, sloBoundsStarvation) {
+    auto scheduler = std::make_shared<PriorityScheduler>();
+    auto lowExecutor = std::make_shared<ManualExecutor>();
+    auto highExecutor = std::make_shared<ManualExecutor>();
+    auto low = scheduler->makeExecutor("low", 0, std::chrono::milliseconds{50}, lowExecutor, 1);
+    auto high = scheduler->makeExecutor("high", 2, std::chrono::milliseconds{0}, highExecutor, 1);
+
+    high->run([] {});
+    low->run([] {});
+    ASSERT_EQ(0, lowExecutor->size());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{60});
+    // the high priority model is still busy, but the low priority task waits longer than its SLO
+    high->run([] {});
+    ASSERT_EQ(1, lowExecutor->size());
+    ASSERT_EQ(1, scheduler->getStatistics(low).overdue);
+    ASSERT_GE(scheduler->getStatistics(low).maxQueueing, std::chrono::milliseconds{50});
+}
+
+TEST(PrioritySchedulerTests, resumedModelRunsTasksByNewExecutor) {
+    auto scheduler = std::make_shared<PriorityScheduler>();
+    auto oldExecutor = std::make_shared<ManualExecutor>();
+    auto newExecutor = std::make_shared<ManualExecutor>();
+    auto scheduled = scheduler->makeExecutor("model", 1, std::chrono::milliseconds{0}, oldExecutor, 1);
+
+    scheduled->run([] {});
+    // the admitted task is completed while the model is suspended
+    std::thread drain([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        oldExecutor->runAll();
+    });
+    scheduler->suspend(scheduled);
+    drain.join();
+    ASSERT_EQ(0, scheduler->getStatistics(scheduled).running);
+
+    scheduled->run([] {});
+    scheduled->run([] {});
+    ASSERT_EQ(0, oldExecutor->size());
+    ASSERT_EQ(2, scheduler->getStatistics(scheduled).queued);
+
+    scheduler->resume(scheduled, newExecutor, 2);
+    ASSERT_EQ(0, oldExecutor->size());
+    ASSERT_EQ(2, newExecutor->size());
+}
+
+TEST(PrioritySchedulerTests, modelIsUnregisteredWithItsExecutor) {
+    auto scheduler = std::make_shared<PriorityScheduler>();
+    auto executor = std::make_shared<ManualExecutor>();
+    auto scheduled = scheduler->makeExecutor("model", 1, std::chrono::milliseconds{0}, executor, 1);
+    ASSERT_EQ(1, scheduler->getStatistics().size());
+
+    scheduled.reset();
+    ASSERT_EQ(0, scheduler->getStatistics().size());
+}
+
+TEST(PrioritySchedulerTests, overdueTaskIsAdmittedWithoutNewEvents) {
+    auto scheduler = std::make_shared<PriorityScheduler>();
+    auto lowExecutor = std::make_shared<ManualExecutor>();
+    auto highExecutor = std::make_shared<ManualExecutor>();
+    auto low = scheduler->makeExecutor("low", 0, std::chrono::milliseconds{50}, lowExecutor, 1);
+    auto high = scheduler->makeExecutor("high", 2, std::chrono::milliseconds{0}, highExecutor, 1);
+
+    high->run([] {});
+    low->run([] {});
+    ASSERT_EQ(0, lowExecutor->size());
+
+    // the high priority task keeps running and nothing else is submitted
+    const auto start = std::chrono::steady_clock::now();
+    while (lowExecutor->size() == 0 && std::chrono::steady_clock::now() - start < std::chrono::seconds{10})
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    ASSERT_EQ(1, lowExecutor->size());
+    ASSERT_EQ(1, scheduler->getStatistics(low).overdue);
+    ASSERT_GE(scheduler->getStatistics(low).maxQueueing, std::chrono::milliseconds{50});
+
+    highExecutor->runAll();
+    lowExecutor->runAll();
+    ASSERT_EQ(0, scheduler->getStatistics(low).running);
+}